@@ -4,66 +4,50 @@
 #include <stdint.h>
 #include <time.h>
 
+#include "6502.h"
+#include "core.h"
+#include "platform.h"
+#include "trace.h"
+#include "profile.h"
+#include "vic.h"
+
 /*
 	TO DO:
-		- addressing modes, page boundary crossing (machine cycles + 1 in some cases)
-		- Rewrite the statusregister struct to something easier
-		- define the constant addresses for the ROMS and memory banks
 		- make macros from the mnemnonic functions
 
 */
-typedef struct StatusRegisters {
-	uint8_t C:1;  // Carry           1=true
-	uint8_t Z:1;  // Zero Result     1=result zero
-	uint8_t I:1;  // IRQ Disable     1=Disable
-	uint8_t D:1;  // Decimal mode    1=true
-	uint8_t B:1;  // BRK Command
-	uint8_t dc:1; // Expansion
-	uint8_t V:1;  // Overflow        1=true
-	uint8_t N:1;  // Negative Result 1=Negative
-} StatusRegisters;
-
-typedef struct State6510 {
-	uint8_t  A;  // Accumulator A
-	uint8_t  X;  // Index Register X
-	uint8_t  Y;  // Index Register Y
-	uint16_t PC; // Program Counter Points to the current address
-	uint16_t SP; // Stack Pointer points to the next available location in the stack.
-	uint8_t  *memory;
-	struct   StatusRegisters sr;
-} State6510;
-
-State6510* state;
-uint8_t *pBasicROM;
-uint8_t *pKernalROM;
-uint8_t *pCharROM;
-
 /***************************************************************************** 
  ***  Addressing modes                                                     ***
  *****************************************************************************/
-#define tZEROPAGE(op1)				(state->memory[(uint8_t) op1])
-#define tZEROPAGEX(op1)				(state->memory[(uint16_t) (op1 + state->X)])
-#define tZEROPAGEY(op1)				(state->memory[(uint16_t) (op1 + state->Y)])
-#define tABSOLUTE(op1, op2)			(state->memory[(uint16_t) (op1 | (op2 << 8))])
-#define tABSOLUTEX(op1, op2)		(state->memory[(uint16_t) ((op1 | (op2 << 8)) + state->X)])
-#define tABSOLUTEY(op1, op2)		(state->memory[(uint16_t) ((op1 | (op2 << 8)) + state->Y)])
-#define tINDIRECTX(IAL)				(state->memory[(uint16_t) (state->memory[IAL+state->X] | (state->memory[IAL+state->X+1] << 8))])
-#define tINDIRECTY(IAL)				(state->memory[(uint16_t) (state->memory[IAL] | (state->memory[IAL+1] << 8)) + state->Y])
-
+// Effective address, used for the writes
+// Zero page indexing and the pointers of the indirect modes wrap around inside page zero: $F0,X with X = $20 is $10
+#define aZEROPAGE(op1)				((uint8_t) op1)
+#define aZEROPAGEX(op1)				((uint8_t) (op1 + state->X))
+#define aZEROPAGEY(op1)				((uint8_t) (op1 + state->Y))
+#define aABSOLUTE(op1, op2)			((uint16_t) (op1 | (op2 << 8)))
+#define aABSOLUTEX(op1, op2)		((uint16_t) ((op1 | (op2 << 8)) + state->X))
+#define aABSOLUTEY(op1, op2)		((uint16_t) ((op1 | (op2 << 8)) + state->Y))
+#define aINDIRECTX(IAL)				((uint16_t) (Peek(state, (uint8_t) (IAL+state->X)) | (Peek(state, (uint8_t) (IAL+1+state->X)) << 8)))
+#define aINDIRECTY(IAL)				((uint16_t) ((Peek(state, (uint8_t) IAL) | (Peek(state, (uint8_t) (IAL+1)) << 8)) + state->Y))
+// The stack is page 1, SP + offset wraps around inside it: a push at $0100 goes on at $01FF
+#define aSTACK(offset)				((uint16_t) (0x0100 | (uint8_t) (state->SP + (offset))))
+#define SP_ADD(offset)				(state->SP = aSTACK(offset))
+
+// Memory content, used for the reads
 #define IMMEDIATE(op1)             (op1)
-#define ZEROPAGE(op1)              (Peek(op1))
-#define ZEROPAGEX(op1)             (Peek(op1 + state->X))
-#define ZEROPAGEY(op1)             (Peek(op1 + state->Y))
-#define ABSOLUTE(op1, op2)         (Peek(op1 | (op2 << 8)))
-#define ABSOLUTEX(op1, op2)        (Peek((op1 | (op2 << 8)) + state->X))
-#define ABSOLUTEY(op1, op2)        (Peek((op1 | (op2 << 8)) + state->Y))
+#define ZEROPAGE(op1)              (Peek(state, aZEROPAGE(op1)))
+#define ZEROPAGEX(op1)             (Peek(state, aZEROPAGEX(op1)))
+#define ZEROPAGEY(op1)             (Peek(state, aZEROPAGEY(op1)))
+#define ABSOLUTE(op1, op2)         (Peek(state, aABSOLUTE(op1, op2)))
+#define ABSOLUTEX(op1, op2)        (Peek(state, aABSOLUTEX(op1, op2)))
+#define ABSOLUTEY(op1, op2)        (Peek(state, aABSOLUTEY(op1, op2)))
 // Indexed-Indirect addressing
 // LDX #$00      ;X is loaded with zero (0),
 // LDA ($02,X)   ;so the vector is calculated as $02 plus zero (0). The resulting vector is ($02). 
 //
 // If zero-page memory $02 contains 00 80,
 // then the effective address from the vector (02) would be $8000. 
-#define INDIRECTX(IAL)				(Peek((Peek(IAL+state->X) | Peek(IAL+1+state->X) << 8)))
+#define INDIRECTX(IAL)				(Peek(state, aINDIRECTX(IAL)))
 // 00,IAL+X
 
 // Indirect-indexed addressing
@@ -75,23 +59,127 @@ uint8_t *pCharROM;
 //
 //                                        BAL=00,IAL   BAH=00,IAL+1
 // BAH, BAL+Y
-#define INDIRECTY(IAL)				(Peek((Peek(IAL) | (Peek(IAL+1) << 8)) + state->Y))
+#define INDIRECTY(IAL)				(Peek(state, aINDIRECTY(IAL)))
 // Branch addressing
 // When calculating branches a forward branch of 6 skips the following 6 bytes so,
 // effectively the program counter points to the address that is 8 bytes beyond the address of the branch opcode;
 //
 // And a backward branch of $FA (256-6) goes to an address 4 bytes before the branch instruction.
-#define BRANCH(offset)				(((offset) & (1<<7)) ? (state->PC = state->PC - (0xFF - (signed int)offset) + 1) : (state->PC = state->PC + offset + 2))
+//
+// A taken branch costs 1 extra cycle, and 1 more if the target is in another page than the next instruction.
+#define BRANCH(offset)														\
+do {																		\
+		uint16_t next_pc = (uint16_t)(state->PC + 2);						\
+		uint16_t target = (uint16_t)(next_pc + (int8_t)(offset));			\
+		state->cycles += 1 + (((next_pc ^ target) & 0xFF00) != 0);			\
+		state->PC = target;													\
+	}																		\
+while (0)
+// Page crossing
+// Indexed reads (ABSOLUTEX, ABSOLUTEY and INDIRECTY) take 1 extra cycle when adding the index
+// to the low byte of the base address carries into the high byte.
+#define PAGE_CROSSING(low_plus_index)	(state->cycles += ((low_plus_index) >> 8))
+// Interrupt
+// An instruction that clears I while the IRQ line is pulled ends the run of the engine, Run6510 takes the IRQ.
+#define IRQ_CHECK()					do { if (state->irq != 0 && !state->sr.I) state->run_until = state->cycles; } while (0)
+// CLI and PLP change I after the CPU polled the IRQ line, so a pending IRQ waits for one more instruction:
+// it is taken from irq_from on, the run ends after the next instruction (each takes two cycles or more).
+#define IRQ_CHECK_NEXT()															\
+do {																				\
+	state->irq_from = state->cycles + 1;											\
+	if (state->irq != 0 && !state->sr.I && state->run_until > state->irq_from)		\
+		state->run_until = state->irq_from;										\
+}																					\
+while (0)
 
 /*****************************************************************************
  *** Status Registers Macros                                               ***
  *****************************************************************************/
-#define StatusRegisterNegative(op)			(state->sr.N = (((op & 0x80) == 0x80) ? 1 : 0)) // Negative
-#define StatusRegisterZero(op)				(state->sr.Z = ((op & 0xFF) == 0) ? 1 : 0) // Zero (state->sr.Z = ((op & 0xFF) == 0)) // Zero
-#define StatusRegisterCarry(op)				(state->sr.C = (op > 0xFF)) // Carry
+// Store the result the flag depends on (see StatusRegisters)
+#define StatusRegisterNegative(op)			(state->sr.n_result = (uint8_t)(op)) // Negative = bit 7
+#define StatusRegisterZero(op)				(state->sr.z_result = (uint8_t)(op)) // Zero = (op & 0xFF) == 0
+#define StatusRegisterCarry(op)				(state->sr.c_result = (uint16_t)(op)) // Carry = op > 0xFF, for op <= 0x1FF
+#define StatusRegisterOverflow(a, m, r)		(state->sr.v_op1 = (uint8_t)(a), state->sr.v_op2 = (uint8_t)(m), state->sr.v_result = (uint8_t)(r)) // a + m -> r
+// Set a flag to a known value (0 or 1)
+#define StatusRegisterCarryBit(b)			(state->sr.c_result = (uint16_t)((b) << 8))
+#define StatusRegisterOverflowBit(b)		(state->sr.v_op1 = 0, state->sr.v_op2 = 0, state->sr.v_result = (uint8_t)((b) << 7))
+// Read the flags, each returns 0 or 1
+#define NegativeFlag						((state->sr.n_result >> 7) & 0x01)
+#define ZeroFlag							(state->sr.z_result == 0)
+#define CarryFlag							((state->sr.c_result >> 8) & 0x01)
+#define OverflowFlag						((((state->sr.v_op1 ^ state->sr.v_result) & (state->sr.v_op2 ^ state->sr.v_result)) >> 7) & 0x01)
+
+/*****************************************************************************
+ *** Pack the status register into the P byte NV_BDIZC (PHP, BRK, export) ***
+ *****************************************************************************/
+uint8_t GetStatusRegister6510(State6510* state)
+{
+	return (uint8_t)(CarryFlag | ZeroFlag << 1 | state->sr.I << 2 | state->sr.D << 3 |
+		state->sr.B << 4 | state->sr.dc << 5 | OverflowFlag << 6 | NegativeFlag << 7);
+}
+
+/*****************************************************************************
+ *** Unpack a P byte NV_BDIZC into the status register (PLP, RTI, import) ***
+ *****************************************************************************/
+void SetStatusRegister6510(State6510* state, uint8_t psr)
+{
+	StatusRegisterNegative(psr);
+	StatusRegisterZero((psr & 0x02) ^ 0x02);
+	StatusRegisterCarryBit(psr & 0x01);
+	StatusRegisterOverflowBit((psr >> 6) & 0x01);
+	state->sr.I = (0x04 == (psr & 0x04));
+	state->sr.D = (0x08 == (psr & 0x08));
+	state->sr.B = (0x10 == (psr & 0x10));
+	state->sr.dc = (0x20 == (psr & 0x20));
+}
+
+#if CPU_BLOCK_CACHE
+/*
+  Drops all blocks. The page tables are rebuilt by the caller.
+*/
+static void FlushBlocks(BlockCache6510* cache)
+{
+	for (int i = 0; i < BLOCK_CACHE_ENTRIES; i++)
+		cache->blocks[i].valid = 0;
+	memset(cache->codepage, 0, sizeof(cache->codepage));
+	memset(cache->code, 0, sizeof(cache->code));
+	cache->jit_used = 0;
+	cache->epoch++;
+	cache->stats.flushes++;
+}
+
+/*
+  Called by WriteIO for every write into a page with cached code. Only a
+  write that hits a byte of cached code drops the blocks of that page.
+*/
+static void InvalidateCode(State6510* state, uint16_t address)
+{
+	BlockCache6510* cache = state->blocks;
+	uint8_t page = address >> 8;
+
+	if ((cache->code[address >> 3] & (1 << (address & 7))) == 0)
+		return;
+
+	for (int i = 0; i < BLOCK_CACHE_ENTRIES; i++)
+	{
+		Block6510* block = &cache->blocks[i];
+		uint8_t first = block->pc >> 8;
+		uint8_t last = (uint16_t)(block->end - 1) >> 8;
+
+		if (block->valid && (first == page || last == page))
+		{
+			block->valid = 0;
+			cache->stats.invalidations++;
+		}
+	}
+	memset(&cache->code[page << 5], 0, 32);
+	cache->codepage[page] = 0;
+	cache->epoch++;
+}
+#endif
 
  /*****************************************************************************
- *** PEEK: Read from Memory                                                ***
+ *** MEMORY MAP                                                            ***
  ***                                                                       ***
  *** 6510 CPU PORT REGISTER 0x0001                                         ***
  *** bit 0 = LORAM  - BASIC ROM;			0 = RAM, 1 = ROM               ***
@@ -99,89 +187,207 @@ uint8_t *pCharROM;
  *** bit 2 = CHAREN - CHAR ROM;				0 = ROM, 1 = I/O               ***
  ***                                                                       ***
  *** bit 0 & 1 = 0; All ROM becomes RAM (bit 2 ignored)                    ***
+ ***                                                                       ***
+ *** Bits that are inputs in the Data Direction Register 0x0000 read as 1. ***
+ ***                                                                       ***
+ *** The map is two tables of 256 page pointers, one for reading and one   ***
+ *** for writing. They are only rebuilt when a write to 0x0000 or 0x0001   ***
+ *** changes the banks, or when a handler is installed, so an access is a  ***
+ *** single indexed load.                                                  ***
+ *** A NULL page is I/O or has a handler and goes through ReadIO / WriteIO.***
+ *** Writes under a ROM land in the RAM below. A RAM page that is still    ***
+ *** shared with a snapshot is read from the snapshot, see SNAPSHOTS.      ***
  *****************************************************************************/
-//#undef _DEBUG
-#define _DEBUG
-uint8_t Peek(uint16_t address)
-{
-#ifndef _DEBUG
-	uint8_t memory_content;
-
-	// 0x0000 - 0x00FF ZEROPAGE
-	if ((address >= 0x0000) && (address <= 0x00FF))
-		memory_content = state->memory[(uint8_t)address];
-	// 0x0100 - 0x01FF STACK POINTER
-	if ((address >= 0x0100) && (address <= 0x01FF))
-		memory_content = state->memory[address];
-	// 0x0200 - 0x9FFF RAM
-	if ((address >= 0x0200) && (address <= 0x9FFF)) // RAM
-		memory_content = state->memory[address];
-
-	// 0xA000 - 0xBFFF BASIC ROM
-	else if ((address >= 0xA000) && (address <= 0xBFFF)) // Basic ROM
-	{
-		// Check Data Register for ROM or RAM
-		if ((state->memory[1] & 0x01) == 0x01)
-			memory_content = pBasicROM[address - 0xA000];
-		else
-			memory_content = state->memory[address];
-	}
+static uint8_t ProcessorPort(State6510* state)
+{
+	return (state->memory[0x0001] | ~state->memory[0x0000]) & 0x07;
+}
 
-	// 0xC000 - 0xCFFF RAM
-	else if ((address >= 0xC000) && (address <= 0xCFFF)) // RAM
-		memory_content = state->memory[address];
+/*
+  Sets the read and write pointer of one page
+*/
+static void MapPage(State6510* state, uint8_t page, uint8_t port)
+{
+	uint8_t loram = port & 0x01;
+	uint8_t hiram = (port >> 1) & 0x01;
+	uint8_t charen = (port >> 2) & 0x01;
+	const uint8_t* read = state->cow[page] != NULL ? state->cow[page] : state->memory + (page << 8);
+	uint8_t* write = state->cow[page] != NULL ? NULL : state->memory + (page << 8);
 
-	// 0xD000 - 0xDFFF CHAR ROM - I/O
-	else if ((address >= 0xD000) && (address <= 0xDFFF)) // Char ROM, I/O
+	if (state->rom != NULL)
 	{
-		// First check if all ROMs are enabled or disabled
-		if ((state->memory[1] & 0x03) == 0x00) // All ROM's are RAM
-			memory_content = state->memory[address];
-		else if ((state->memory[1] & 0x04) == 0x04)
-			// I/O is gekozen maar nog ff uitzoeken wat I/O is en waar het zit in het geheugen
-			memory_content = state->memory[address];
-		else
-			memory_content = pCharROM[address - 0xD000];
-	}
+		// 0xA000 - 0xBFFF BASIC ROM
+		if (page >= 0xA0 && page <= 0xBF && loram && hiram)
+			read = state->rom->pBasicROM + ((page - 0xA0) << 8);
+
+		// 0xD000 - 0xDFFF CHAR ROM - I/O
+		if (page >= 0xD0 && page <= 0xDF && (loram || hiram))
+		{
+			if (charen)
+				read = write = NULL;
+			else
+				read = state->rom->pCharROM + ((page - 0xD0) << 8);
+		}
 
-	// 0xE000 - 0xFFFF KERNAL ROM
-	else if ((address >= 0xE000) && (address <= 0xFFFF)) // Kernal ROM, RAM
-	{
-		// First check if all ROMs are enabled or disabled
-		if ((state->memory[1] & 0x03) == 0x00) // All ROM's are RAM
-			memory_content = state->memory[address];
-		else if ((state->memory[1] & 0x02) == 0x02)
-			memory_content = pKernalROM[address - 0xE000];
-		else
-			memory_content = state->memory[address];
+		// 0xE000 - 0xFFFF KERNAL ROM
+		if (page >= 0xE0 && hiram)
+			read = state->rom->pKernalROM + ((page - 0xE0) << 8);
 	}
 
-	return memory_content;
-#else
-	return state->memory[address];
+	// Pages with a handler or cached code leave the fast path
+	if (state->peekio[page] != NULL)
+		read = NULL;
+	if (state->pokeio[page] != NULL || state->screenpage[page])
+		write = NULL;
+#if CPU_BLOCK_CACHE
+	if (state->blocks->codepage[page])
+		write = NULL;
+#endif
+	state->readmap[page] = read;
+	state->writemap[page] = write;
+}
+
+void C64_UpdateMemoryMap(State6510* state)
+{
+	uint8_t port = ProcessorPort(state);
+
+	state->port = port;
+#if CPU_BLOCK_CACHE
+	// The code seen at an address may change, start over
+	FlushBlocks(state->blocks);
 #endif
+	for (int page = 0x00; page <= 0xFF; page++)
+		MapPage(state, (uint8_t)page, port);
 }
 
 /*****************************************************************************
- *** POKE: Write to Memory                                                 ***
- ***                                                                       ***
- ***                                                                       ***
- ***                                                                       ***
- ***                                                                       ***
+ *** I/O HANDLERS: Install or (with NULL) remove a handler for one page    ***
  ***                                                                       ***
+ *** A handler sees every access to its page, whatever is banked in, so    ***
+ *** it can be used for chips as well as for watchpoints on RAM.           ***
+ *****************************************************************************/
+void C64_SetPeekHandler(State6510* state, uint8_t page, PeekHandler6510 handler)
+{
+	state->peekio[page] = handler;
+	C64_UpdateMemoryMap(state);
+}
+
+void C64_SetPokeHandler(State6510* state, uint8_t page, PokeHandler6510 handler)
+{
+	state->pokeio[page] = handler;
+	C64_UpdateMemoryMap(state);
+}
+
+/*
+  Installs a chip on a page of $D000 - $DFFF. Unlike a handler it only
+  sees the accesses while I/O is banked in, with a handler on the same
+  page the handler wins.
+*/
+void C64_SetIOChip(State6510* state, uint8_t page, PeekHandler6510 peek, PokeHandler6510 poke)
+{
+	state->chippeek[page & 0x0F] = peek;
+	state->chippoke[page & 0x0F] = poke;
+}
+
+/*
+  Takes a page off the Poke fast path (watch = 1) so the VIC sees the
+  writes to the RAM its screen is rendered from, see vic.h. Reads and the
+  code seen on the page do not change, the blocks stay.
+*/
+void C64_WatchPage(State6510* state, uint8_t page, int watch)
+{
+	state->screenpage[page] = (uint8_t)(watch != 0);
+	MapPage(state, page, ProcessorPort(state));
+}
+
+/*****************************************************************************
+ *** I/O: The slow path for pages with a handler and 0xD000 - 0xDFFF when  ***
+ *** CHAREN = 1                                                            ***
  ***                                                                       ***
+ *** I/O pages without a handler go to their chip (see C64_SetIOChip),     ***
+ *** without a chip they read back what was written. Writes into pages     ***
+ *** with cached code (see BLOCK CACHE), shared with a snapshot (see       ***
+ *** SNAPSHOTS) or rendered by the VIC (see C64_WatchPage) also end up     ***
+ *** here.                                                                 ***
+ *****************************************************************************/
+static uint8_t ReadIO(State6510* state, uint16_t address)
+{
+	PeekHandler6510 handler = state->peekio[address >> 8];
+
+	if (handler != NULL)
+		return handler(state, address);
+	// Without a handler only I/O leaves the fast path for reads
+	if (state->chippeek[(address >> 8) & 0x0F] != NULL)
+		return state->chippeek[(address >> 8) & 0x0F](state, address);
+	return state->memory[address];
+}
+
+/*
+  Gives the machine its own copy of a page it shares with a snapshot
+*/
+static void OwnPage(State6510* state, uint8_t page)
+{
+	memcpy(state->memory + (page << 8), state->cow[page], 0x100);
+	state->cow[page] = NULL;
+	MapPage(state, page, ProcessorPort(state));
+}
+
+static void WriteIO(State6510* state, uint16_t address, uint8_t value)
+{
+	PokeHandler6510 handler = state->pokeio[address >> 8];
+
+	uint8_t page = address >> 8;
+
+#if CPU_BLOCK_CACHE
+	if (state->blocks->codepage[page])
+	{
+		InvalidateCode(state, address);
+		MapPage(state, page, ProcessorPort(state));
+	}
+#endif
+	if (state->cow[page] != NULL)
+		OwnPage(state, page);
+	if (handler != NULL)
+		handler(state, address, value);
+	else if (state->chippoke[page & 0x0F] != NULL && page >= 0xD0 && page <= 0xDF && state->rom != NULL &&
+		(ProcessorPort(state) & 0x03) != 0 && (ProcessorPort(state) & 0x04) != 0)
+		state->chippoke[page & 0x0F](state, address, value);
+	else
+		state->memory[address] = value;
+	if (state->screenpage[page])
+		C64_ScreenWrite(state, address);
+}
+
+/*****************************************************************************
+ *** PEEK: Read from Memory                                                ***
+ *****************************************************************************/
+INLINE uint8_t Peek(State6510* state, uint16_t address)
+{
+	const uint8_t *page = state->readmap[address >> 8];
+
+	if (page != NULL)
+		return page[address & 0xFF];
+	return ReadIO(state, address);
+}
+
+/*****************************************************************************
+ *** POKE: Write to Memory                                                 ***
  ***                                                                       ***
+ *** Writing the processor port switches the banks, when the value seen    ***
+ *** through the data direction register changes.                          ***
  *****************************************************************************/
-//uint8_t Poke(uint16_t address)
-//{
-//  check addressen die bezet zijn door: (waar je niet naar kunt schrijven)
-//    de processor zelf
-//    PLA
-//    KERNAL
-//    BASIC
-//	  registers van de vic-ii en sid en cia
-//	return 0;
-//}
+INLINE void Poke(State6510* state, uint16_t address, uint8_t value)
+{
+	uint8_t *page = state->writemap[address >> 8];
+
+	if (page != NULL)
+		page[address & 0xFF] = value;
+	else
+		WriteIO(state, address, value);
+
+	if (address <= 0x0001 && ProcessorPort(state) != state->port)
+		C64_UpdateMemoryMap(state);
+}
 
 /*****************************************************************************
  *** ADC: Add memory to accumulator with carry                             ***
@@ -194,12 +400,9 @@ do {																		\
 		uint16_t tmp_value = opcode;										\
 		uint16_t reg_a_read = state->A;										\
 																			\
-		tmp_value = opcode;													\
-		reg_a_read = state->A;												\
-																			\
 		if (state->sr.D == 1)				 								\
 		{																	\
-			tmp = (reg_a_read & 0xf) + (tmp_value & 0xf) + state->sr.C;		\
+			tmp = (reg_a_read & 0xf) + (tmp_value & 0xf) + CarryFlag;		\
 			if (tmp > 0x9)													\
 				tmp += 0x6;													\
 			if (tmp <= 0x0f)												\
@@ -208,21 +411,19 @@ do {																		\
 			else															\
 				tmp = (tmp & 0xf) + (reg_a_read & 0xf0) +					\
 					(tmp_value & 0xf0) + 0x10;								\
-			state->sr.Z = !((reg_a_read + tmp_value + state->sr.C) & 0xff);	\
+			StatusRegisterZero(reg_a_read + tmp_value + CarryFlag);			\
 			StatusRegisterNegative(tmp);									\
-			state->sr.V = (((reg_a_read ^ tmp) & 0x80) &&					\
-				!((reg_a_read ^ tmp_value) & 0x80));						\
+			StatusRegisterOverflow(reg_a_read, tmp_value, tmp);				\
 			if ((tmp & 0x1f0) > 0x90)										\
 				tmp += 0x60;												\
-			state->sr.C = ((tmp & 0xff0) > 0xf0);							\
+			StatusRegisterCarryBit((tmp & 0xff0) > 0xf0);					\
 		}																	\
 		else																\
 		{																	\
-			tmp = tmp_value + reg_a_read + state->sr.C;						\
+			tmp = tmp_value + reg_a_read + CarryFlag;						\
 			StatusRegisterZero(tmp);										\
 			StatusRegisterNegative(tmp);									\
-			state->sr.V = (!((reg_a_read ^ tmp_value) & 0x80) &&			\
-				((reg_a_read ^ tmp) & 0x80));								\
+			StatusRegisterOverflow(reg_a_read, tmp_value, tmp);				\
 			StatusRegisterCarry(tmp);										\
 		}																	\
 		state->A = (uint8_t)tmp;											\
@@ -259,6 +460,33 @@ do {																		\
 		state->PC = state->PC + pc_inc;										\
 	}																		\
 while (0)
+/*****************************************************************************
+ *** RMW: Read-modify-write instruction on memory                          ***
+ ***      op = the operation (_asl, _dec, _inc, _lsr, _rol, _ror)          ***
+ ***      address = effective address                                      ***
+ ***      inc_pc = Inc with no. of cycles                                  ***
+ *****************************************************************************/
+#define _rmw(op, address, pc_inc)											\
+do {																		\
+		uint16_t rmw_address = (address);									\
+		uint8_t rmw_value = Peek(state, rmw_address);						\
+		op(rmw_value, pc_inc, rmw_value);									\
+		Poke(state, rmw_address, rmw_value);								\
+	}																		\
+while (0)
+/*****************************************************************************
+ *** BRANCH: Branch on condition (relative)                                ***
+ ***      condition = flag test, branch when true                          ***
+ ***      offset = relative offset                                         ***
+ *****************************************************************************/
+#define _branch(condition, offset)											\
+do {																		\
+		if (condition)														\
+			BRANCH(offset);													\
+		else																\
+			state->PC = state->PC + 2;										\
+	}																		\
+while (0)
 /*****************************************************************************
  *** CP: Compare memory and accumulator                                    ***
  ***     opcode = memory content                                           ***
@@ -270,7 +498,7 @@ do {																		\
 		uint16_t answer = (uint16_t)(dest - opcode);						\
 		StatusRegisterNegative(answer);										\
 		StatusRegisterZero(answer);											\
-		state->sr.C = ((opcode <= dest) ? 1 : 0);							\
+		StatusRegisterCarry(0x100 + dest - opcode); /* no borrow */		\
 		state->PC = state->PC + pc_inc;										\
 }																			\
 while (0)
@@ -437,9 +665,9 @@ while (0)
 do {																		\
 		uint8_t b0_before = opcode;											\
 		uint16_t answer = ((uint16_t)(opcode >> 1));						\
-		state->sr.N = 0;													\
+		StatusRegisterNegative(0);											\
 		StatusRegisterZero(answer);											\
-		state->sr.C = ((b0_before & 0x01) == 1);							\
+		StatusRegisterCarryBit(b0_before & 0x01);							\
 		dest = (uint8_t)(answer & 0xff);									\
 		state->PC = state->PC + pc_inc;										\
 	}																		\
@@ -465,7 +693,7 @@ while (0)
  *****************************************************************************/
 #define _rol(opcode, pc_inc, dest)											\
 do {																		\
-		uint16_t answer = (uint16_t)((opcode << 1) | state->sr.C);			\
+		uint16_t answer = (uint16_t)((opcode << 1) | CarryFlag);			\
 		StatusRegisterNegative(answer);										\
 		StatusRegisterZero(answer);											\
 		StatusRegisterCarry(answer);										\
@@ -480,10 +708,10 @@ while (0)
  *****************************************************************************/
 #define _ror(opcode, pc_inc, dest)											\
 do {																		\
-		uint16_t answer = (uint16_t)((opcode >> 1) | (state->sr.C << 7));	\
+		uint16_t answer = (uint16_t)((opcode >> 1) | (CarryFlag << 7));	\
 		StatusRegisterNegative(answer);										\
 		StatusRegisterZero(answer);											\
-		state->sr.C = ((opcode & 0x01) == 1) ? 1 : 0;						\
+		StatusRegisterCarryBit(opcode & 0x01);								\
 		dest = (uint8_t)(answer & 0xff);									\
 		state->PC = state->PC + pc_inc;										\
 	}																		\
@@ -501,13 +729,13 @@ do {																		\
 																			\
 		src = (int16_t)opcode;												\
 		reg_a_read = (uint16_t)state->A;									\
-		tmp = reg_a_read - src - ((state->sr.C & 0x1) ? 0 : 1);				\
+		tmp = reg_a_read - src - (CarryFlag ? 0 : 1);						\
 																			\
 		if (state->sr.D == 1)												\
 		{																	\
 			uint16_t tmp_a;													\
 			tmp_a = (reg_a_read & 0xf) - (src & 0xf) -						\
-				((state->sr.C & 0x1) ? 0 : 1);								\
+				(CarryFlag ? 0 : 1);										\
 			if (tmp_a & 0x10)												\
 				tmp_a = ((tmp_a - 6) & 0xf) | ((reg_a_read & 0xf0) -		\
 					(src & 0xf0) - 0x10);									\
@@ -516,1476 +744,2325 @@ do {																		\
 					(src & 0xf0));											\
 			if (tmp_a & 0x100)												\
 				tmp_a -= 0x60;												\
-			state->sr.C = (tmp < 0x100);									\
+			StatusRegisterCarryBit(tmp < 0x100);							\
 			StatusRegisterZero(tmp);										\
 			StatusRegisterNegative(tmp);									\
-			state->sr.V = (((reg_a_read ^ tmp) & 0x80) &&					\
-				((reg_a_read ^ src) & 0x80));								\
+			StatusRegisterOverflow(reg_a_read, ~src, tmp);					\
 			state->A = (uint8_t)(tmp_a & 0xff);								\
 		}																	\
 		else																\
 		{																	\
-			state->sr.C = (tmp < 0x100);									\
+			StatusRegisterCarryBit(tmp < 0x100);							\
 			StatusRegisterZero(tmp);										\
 			StatusRegisterNegative(tmp);									\
-			state->sr.V = (((reg_a_read ^ tmp) & 0x80) &&					\
-				((reg_a_read ^ src) & 0x80));								\
+			StatusRegisterOverflow(reg_a_read, ~src, tmp);					\
 			state->A = (uint8_t)(tmp & 0xff);								\
 		}																	\
 		state->PC = state->PC + pc_inc;										\
 	}																		\
 while (0)
-/*****************************************************************************
- *** Disassemble the assembly code  									   ***
- *** pc is the current offset into the code								   ***
- ***																	   ***
- *** returns the number of bytes of the op								   ***
- *****************************************************************************/
-int Disassemble6510Op(uint16_t pc)
-{
-  uint8_t opbytes;
-  uint8_t cycles;
-  opbytes = 1;
-  cycles = 0;
-
-  uint8_t code0 = Peek(pc);
-  uint8_t code1 = Peek(pc + 1);
-  uint8_t code2 = Peek(pc + 2);
-
-  printf("%04X %02X ", pc, code0);
-  switch (code0)
-  {
-	//                 FF FF FF  LDA FFFF
-	case 0x00: printf("       BRK"); opbytes = 1; cycles = 7; break;
-    case 0x01: printf("%02X     ORA ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x02: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x03: printf("%02X     SLO ($%02X,X)", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x04: printf("%02X     NOP $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x05: printf("%02X     ORA $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x06: printf("%02X     ASL $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x07: printf("%02X     SLO $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x08: printf("       PHP"); opbytes = 1; cycles = 3; break;
-    case 0x09: printf("%02X     ORA #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x0A: printf("       ASL A"); opbytes = 1; cycles = 2; break;
-    case 0x0B: printf("%02X     ANC #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x0C: printf("%02X %02X  NOP $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x0D: printf("%02X %02X  ORA $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x0E: printf("%02X %02X  ASL $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-    case 0x0F: printf("%02X %02X  SLO $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-
-    case 0x10: printf("%02X     BPL $%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */; break;
-    case 0x11: printf("%02X     ORA ($%02X),Y", code1, code1); opbytes = 2; cycles = 5 /* Add 1 on page crossing */; break;
-    case 0x12: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x13: printf("%02X     SLO ($%02X),Y", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x14: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x15: printf("%02X     ORA $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x16: printf("%02X     ASL $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x17: printf("%02X     SLO $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x18: printf("       CLC"); opbytes = 1; cycles = 2; break;
-    case 0x19: printf("%02X %02X  ORA $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x1A: printf("       NOP"); opbytes = 1; cycles = 2; break;
-    case 0x1B: printf("%02X %02X  SLO $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x1C: printf("%02X %02X  NOP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x1D: printf("%02X %02X  ORA $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x1E: printf("%02X %02X  ASL $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x1F: printf("%02X %02X  SLO $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-
-	case 0x20: printf("%02X %02X  JSR $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-    case 0x21: printf("%02X     AND ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x22: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x23: printf("%02X     RLA ($%02X,X)", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x24: printf("%02X     BIT $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x25: printf("%02X     AND $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x26: printf("%02X     ROL $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x27: printf("%02X     RLA $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x28: printf("       PLP"); opbytes = 1; cycles = 4; break;
-    case 0x29: printf("%02X     AND #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x2A: printf("       ROL A"); opbytes = 1; cycles = 2; break;
-    case 0x2B: printf("%02X     ANC #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x2C: printf("%02X %02X  BIT $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x2D: printf("%02X %02X  AND $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x2E: printf("%02X %02X  ROL $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-    case 0x2F: printf("%02X %02X  RLA $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-
-	case 0x30: printf("%02X     BMI $%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */; break;
-    case 0x31: printf("%02X     AND ($%02X),Y", code1, code1); opbytes = 2; cycles = 5 /* Add 1 if page boundary is crossed. */; break;
-    case 0x32: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x33: printf("%02X     RLA ($%02X),Y", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x34: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x35: printf("%02X     AND $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x36: printf("%02X     ROL $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x37: printf("%02X     RLA $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x38: printf("       SEC"); opbytes = 1; cycles = 2; break;
-    case 0x39: printf("%02X %02X  AND $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 if page boundary is crossed. */; break;
-    case 0x3A: printf("       NOP"); opbytes = 1; cycles = 2; break;
-    case 0x3B: printf("%02X %02X  RLA $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x3C: printf("%02X %02X  NOP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x3D: printf("%02X %02X  AND $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 if page boundary is crossed. */; break;
-    case 0x3E: printf("%02X %02X  ROL $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x3F: printf("%02X %02X  RLA $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-
-	case 0x40: printf("       RTI"); opbytes = 1; cycles = 6; break;
-    case 0x41: printf("%02X     EOR ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x42: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x43: printf("%02X     SRE ($%02X,X)", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x44: printf("%02X     NOP $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x45: printf("%02X     EOR $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x46: printf("%02X     LSR $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x47: printf("%02X     SRE $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x48: printf("       PHA"); opbytes = 1; cycles = 3; break;
-    case 0x49: printf("%02X     EOR #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x4A: printf("       LSR A"); opbytes = 1; cycles = 2; break;
-    case 0x4B: printf("%02X     ASR #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x4C: printf("%02X %02X  JMP $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 3; break;
-    case 0x4D: printf("%02X %02X  EOR $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x4E: printf("%02X %02X  LSR $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-    case 0x4F: printf("%02X %02X  SRE $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-
-	case 0x50: printf("%02X     BVC $%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */; break;
-    case 0x51: printf("%02X     EOR ($%02X),Y", code1, code1); opbytes = 2; cycles = 5 /* Add 1 if page boundary is crossed. */; break;
-    case 0x52: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x53: printf("%02X     SRE ($%02X),Y", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x54: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x55: printf("%02X     EOR $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x56: printf("%02X     LSR $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x57: printf("%02X     SRE $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x58: printf("       CLI"); opbytes = 1; cycles = 2; break;
-    case 0x59: printf("%02X %02X  EOR $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 if page boundary is crossed. */; break;
-    case 0x5A: printf("       NOP"); opbytes = 1; cycles = 2; break;
-    case 0x5B: printf("%02X %02X  SRE $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x5C: printf("%02X %02X  NOP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x5D: printf("%02X %02X  EOR $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x5E: printf("%02X %02X  LSR $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x5F: printf("%02X %02X  SRE $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-
-	case 0x60: printf("       RTS"); opbytes = 1; cycles = 6; break;
-    case 0x61: printf("%02X     ADC ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x62: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x63: printf("%02X     RRA ($%02X,X)", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x64: printf("%02X     NOP $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x65: printf("%02X     ADC $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x66: printf("%02X     ROR $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x67: printf("%02X     RRA $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0x68: printf("       PLA"); opbytes = 1; cycles = 4; break;
-    case 0x69: printf("%02X     ADC #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x6A: printf("       ROR A"); opbytes = 1; cycles = 2; break;
-    case 0x6B: printf("%02X     ARR #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x6C: printf("%02X %02X  JMP ($%02X%02X)", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0x6D: printf("%02X %02X  ADC $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x6E: printf("%02X %02X  ROR $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-    case 0x6F: printf("%02X %02X  RRA $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-
-	case 0x70: printf("%02X     BVS $%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */; break;
-    case 0x71: printf("%02X     ADC ($%02X),Y", code1, code1); opbytes = 2; cycles = 5  /* Add 1 on page crossing */; break;
-    case 0x72: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x73: printf("%02X     RRA ($%02X),Y", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0x74: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x75: printf("%02X     ADC $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x76: printf("%02X     ROR $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x77: printf("%02X     RRA $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x78: printf("       SEI"); opbytes = 1; cycles = 2; break;
-    case 0x79: printf("%02X %02X  ADC $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 if page boundary is crossed. */; break;
-    case 0x7A: printf("       NOP"); opbytes = 1; cycles = 2; break;
-    case 0x7B: printf("%02X %02X  RRA $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x7C: printf("%02X %02X  NOP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x7D: printf("%02X %02X  ADC $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0x7E: printf("%02X %02X  ROR $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0x7F: printf("%02X %02X  RRA $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-
-	case 0x80: printf("%02X     NOP #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x81: printf("%02X     STA ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x82: printf("%02X     NOP #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x83: printf("%02X     SAX ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x84: printf("%02X     STY $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-	case 0x85: printf("%02X     STA $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x86: printf("%02X     STX $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x87: printf("%02X     SAX $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0x88: printf("       DEY"); opbytes = 1; cycles = 2; break;
-    case 0x89: printf("%02X     NOP #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x8A: printf("       TXA"); opbytes = 1; cycles = 2; break;
-    case 0x8B: printf("%02X     ANE #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0x8C: printf("%02X %02X  STY $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x8D: printf("%02X %02X  STA $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x8E: printf("%02X %02X  STX $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0x8F: printf("%02X %02X  SAX $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-
-	case 0x90: printf("%02X     BCC #%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */;break;
-    case 0x91: printf("%02X     STA ($%02X),Y", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0x92: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0x93: printf("%02X %02X  SHA $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0x94: printf("%02X     STY $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x95: printf("%02X     STA $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x96: printf("%02X     STX $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x97: printf("%02X     SAX $%02X,Y", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0x98: printf("       TYA"); opbytes = 1; cycles = 2; break;
-    case 0x99: printf("%02X %02X  STA $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0x9A: printf("       TXS"); opbytes = 1; cycles = 2; break;
-    case 0x9B: printf("%02X %02X  SHS $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0x9C: printf("%02X %02X  SHY $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0x9D: printf("%02X %02X  STA $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0x9E: printf("%02X %02X  SHX $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0x9F: printf("%02X %02X  SHA $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-
-	case 0xA0: printf("%02X     LDY #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xA1: printf("%02X     LDA ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xA2: printf("%02X     LDX #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xA3: printf("%02X     LAX ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xA4: printf("%02X     LDY $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xA5: printf("%02X     LDA $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xA6: printf("%02X     LDX $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xA7: printf("%02X     LAX $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xA8: printf("       TAY"); opbytes = 1; cycles = 2; break;
-    case 0xA9: printf("%02X     LDA #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xAA: printf("       TAX"); opbytes = 1; cycles = 2; break;
-    case 0xAB: printf("%02X     LXA #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xAC: printf("%02X %02X  LDY $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0xAD: printf("%02X %02X  LDA $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0xAE: printf("%02X %02X  LDX $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0xAF: printf("%02X %02X  LAX $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-
-	case 0xB0: printf("%02X     BCS $%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */; break;
-    case 0xB1: printf("%02X     LDA ($%02X),Y", code1, code1); opbytes = 2; cycles = 5 /* Add 1 on page crossing */; break;
-    case 0xB2: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0xB3: printf("%02X     LAX ($%02X),Y", code1, code1); opbytes = 2; cycles = 5 /* Add 1 on page crossing */; break;
-    case 0xB4: printf("%02X     LDY $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xB5: printf("%02X     LDA $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xB6: printf("%02X     LDX $%02X,Y", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xB7: printf("%02X     LAX $%02X,Y", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xB8: printf("       CLV"); opbytes = 1; cycles = 2; break;
-    case 0xB9: printf("%02X %02X  LDA $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xBA: printf("       TSX"); opbytes = 1; cycles = 2; break;
-    case 0xBB: printf("%02X %02X  LAE $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xBC: printf("%02X %02X  LDY $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xBD: printf("%02X %02X  LDA $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xBE: printf("%02X %02X  LDX $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xBF: printf("%02X %02X  LAX $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-
-	case 0xC0: printf("%02X     CPY #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xC1: printf("%02X     CMP ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xC2: printf("%02X     NOP #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xC3: printf("%02X     DCP ($%02X,X)", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0xC4: printf("%02X     CPY $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xC5: printf("%02X     CMP $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xC6: printf("%02X     DEC $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0xC7: printf("%02X     DCP $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0xC8: printf("       INY"); opbytes = 1; cycles = 2; break;
-    case 0xC9: printf("%02X     CMP #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xCA: printf("       DEX"); opbytes = 1; cycles = 2; break;
-    case 0xCB: printf("%02X     SBX #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xCC: printf("%02X %02X  CPY $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0xCD: printf("%02X %02X  CMP $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0xCE: printf("%02X %02X  DEC $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-    case 0xCF: printf("%02X %02X  DCP $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-
-	case 0xD0: printf("%02X     BNE $%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */; break;
-    case 0xD1: printf("%02X     CMP ($%02X),Y", code1, code1); opbytes = 2; cycles = 5 /* Add 1 on page crossing */; break;
-    case 0xD2: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0xD3: printf("%02X     DCP ($%02X),Y", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0xD4: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xD5: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xD6: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xD7: printf("%02X     DCP $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xD8: printf("       CLD"); opbytes = 1; cycles = 2; break;
-    case 0xD9: printf("%02X %02X  CMP $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xDA: printf("       NOP"); opbytes = 1; cycles = 2; break;
-    case 0xDB: printf("%02X %02X  DCP $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0xDC: printf("%02X %02X  NOP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xDD: printf("%02X %02X  CMP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xDE: printf("%02X %02X  DEC $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0xDF: printf("%02X %02X  DCP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-
-	case 0xE0: printf("%02X     CPX #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xE1: printf("%02X     SBC ($%02X,X)", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xE2: printf("%02X     NOP #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xE3: printf("%02X     ISB ($%02X,X)", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0xE4: printf("%02X     CPX $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xE5: printf("%02X     SBC $%02X", code1, code1); opbytes = 2; cycles = 3; break;
-    case 0xE6: printf("%02X     INC $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0xE7: printf("%02X     IBC $%02X", code1, code1); opbytes = 2; cycles = 5; break;
-    case 0xE8: printf("       INX"); opbytes = 1; cycles = 2; break;
-    case 0xE9: printf("%02X     SBC #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xEA: printf("       NOP"); opbytes = 1; cycles = 2; break;
-    case 0xEB: printf("%02X     SBC #$%02X", code1, code1); opbytes = 2; cycles = 2; break;
-    case 0xEC: printf("%02X %02X  CPX $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 5; break;
-    case 0xED: printf("%02X %02X  SBC $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 4; break;
-    case 0xEE: printf("%02X %02X  INC $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-    case 0xEF: printf("%02X %02X  ISB $%02X%02X", code1, code2, code2, code1); opbytes = 3; cycles = 6; break;
-
-	case 0xF0: printf("%02X     BEQ $%02X", code1, code1); opbytes = 2; cycles = 2 /* Add 1 if branch occurs to same page. Add 2 if branch occurs to different page */; break;
-    case 0xF1: printf("%02X     SBC ($%02X),Y", code1, code1); opbytes = 2; cycles = 5 /* Add 1 on page crossing */; break;
-    case 0xF2: printf("       JAM"); opbytes = 1; cycles = 0; break;
-    case 0xF3: printf("%02X     ISB ($%02X),Y", code1, code1); opbytes = 2; cycles = 8; break;
-    case 0xF4: printf("%02X     NOP $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xF5: printf("%02X     SBC $%02X,X", code1, code1); opbytes = 2; cycles = 4; break;
-    case 0xF6: printf("%02X     INC $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xF7: printf("%02X     ISB $%02X,X", code1, code1); opbytes = 2; cycles = 6; break;
-    case 0xF8: printf("       SED"); opbytes = 1; cycles = 2; break;
-    case 0xF9: printf("%02X %02X SBC $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xFA: printf("       NOP"); opbytes = 1; cycles = 2; break;
-    case 0xFB: printf("%02X %02X ISB $%02X%02X,Y", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0xFC: printf("%02X %02X NOP $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xFD: printf("%02X %02X SBC $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 4 /* Add 1 on page crossing */; break;
-    case 0xFE: printf("%02X %02X INC $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-    case 0xFF: printf("%02X %02X ISB $%02X%02X,X", code1, code2, code2, code1); opbytes = 3; cycles = 7; break;
-  }
-  printf("\n");
-
-  return opbytes;
-}
-
-void UnimplementedInstruction()
+void UnimplementedInstruction(State6510* state)
 {
 	//pc will have advanced one, so undo that
-	printf ("Error: Unimplemented instruction\n");
+	fprintf(stderr, "Error: Unimplemented instruction\n");
 	//state->PC--;
 	state->PC++;
-	//Disassemble6510Op(state->PC);
+	//Disassemble6510Op(state, state->PC);
 	//printf("\n");
 	//exit(1);
 }
 
-int Emulate6510Op(State6510* state)
+/*****************************************************************************
+ *** PROFILE: Count the instruction at PC, add the cycles of the last one  ***
+ *** JSR, BRK, RTS and RTI also move through the call tree                 ***
+ *****************************************************************************/
+#if CPU_PROFILE
+static INLINE void ProfileOp(State6510* state, uint8_t opcode0)
 {
-	uint8_t opcode0 = Peek(state->PC);
-	uint8_t opcode1 = Peek(state->PC + 1);
-	uint8_t opcode2 = Peek(state->PC + 2);
+	Profile6510* profile = state->profile;
+	uint64_t cycles = state->cycles - profile->last_cycles;
+
+	profile->cycles[profile->last_pc] += cycles;
+	profile->opcode_cycles[profile->last_opcode] += cycles;
+	profile->nodes[profile->last_node].cycles += cycles;
+	profile->count[state->PC]++;
+	profile->opcode_count[opcode0]++;
+	profile->last_pc = state->PC;
+	profile->last_opcode = opcode0;
+	profile->last_node = profile->node;
+	profile->last_cycles = state->cycles;
+}
+#define PROFILE_OP(state, opcode0)												\
+	do { if ((state)->profile != NULL) ProfileOp(state, opcode0); } while (0)
+#define PROFILE_CALL(state, pushed)												\
+	do { if (state->profile != NULL) ProfileCall6510(state, pushed); } while (0)
+#define PROFILE_RETURN(state)													\
+	do { if (state->profile != NULL) ProfileReturn6510(state); } while (0)
+#else
+#define PROFILE_OP(state, opcode0)	do { } while (0)
+#define PROFILE_CALL(state, pushed)	do { } while (0)
+#define PROFILE_RETURN(state)		do { } while (0)
+#endif
 
-//	Disassemble6510Op(state->PC);
+/*****************************************************************************
+ *** OPCODE HANDLERS                                                       ***
+ ***                                                                       ***
+ *** One handler per opcode. They are shared by all dispatch engines, the  ***
+ *** engines only differ in the way they get from one handler to the next. ***
+ ***      opcode1 = first operand byte (PC + 1)                            ***
+ ***      opcode2 = second operand byte (PC + 2)                           ***
+ *****************************************************************************/
+#define OPCODE(op)	static INLINE void Op##op(State6510* state, uint8_t opcode1, uint8_t opcode2)
 
-	switch(opcode0)
+// BRK (Implied/Stack)
+OPCODE(0x00)
+{
+	state->PC = state->PC + 2; // PC + 2 to Stack,
+	Poke(state, aSTACK(0), (state->PC >> 8) & 0xFF); // SPH
+	Poke(state, aSTACK(-1), state->PC & 0xFF); // SPL
+	SP_ADD(-2);
+	// Set the BREAK bit in the Processor Status Register
+	state->sr.B = 1;
+	// Processor Status Register to Stack NV_BDIZC
+	Poke(state, aSTACK(0), GetStatusRegister6510(state)); // SPH
+	SP_ADD(-1);
+	// Set the BREAK bit in the stack at SP -1
+	//state->memory[aSTACK(1)] = state->memory[aSTACK(1)] | 0x40; // Removed because redundant, if B is set before putting SR on stack
+	state->sr.I = 1;
+	state->PC = Peek(state, 0xFFFE) | (Peek(state, 0xFFFF) << 8); // transfers control to the interrupt vector
+	PROFILE_CALL(state, 3);
+	// Test programs end on a BRK: stop the machine, Run6510 returns after this instruction
+	if (state->halt_on_brk)
 	{
-		case 0x00: // BRK (Implied/Stack)
-			{
-				state->PC = state->PC + 2; // PC + 2 to Stack,
-				state->memory[state->SP] = (state->PC >> 8) & 0xFF; // SPH
-				state->memory[state->SP - 1] = state->PC & 0xFF; // SPL
-				state->SP = state->SP - 2;
-				// Set the BREAK bit in the Processor Status Register 
-				state->sr.B = 1;
-				// Processor Status Register to Stack NV_BDIZC
-				state->memory[state->SP] = (state->sr.C | state->sr.Z << 1 | state->sr.I << 2 | state->sr.D << 3 | state->sr.B << 4 | state->sr.dc << 5 | state->sr.V << 6 | state->sr.N << 7); // SPH
-				state->SP = state->SP - 1;
-				// Set the BREAK bit in the stack at SP -1
-				//state->memory[state->SP + 1] = state->memory[state->SP + 1] | 0x40; // Removed because redundant, if B is set before putting SR on stack
-				state->PC = 0xfffe; // transfers control to the interrupt vector
-				exit(1);
-			}
-			break;
-		case 0x01: // ORA ($FF,X) (Indexed Indirect,X)	A OR M -> A (A V M -> A)
-			{
-				_ora(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0x02: UnimplementedInstruction(); break;
-		case 0x03: UnimplementedInstruction(); break;
-		case 0x04: UnimplementedInstruction(); break;
-		case 0x05: // ORA $FF (Zeropage)  A OR M -> A
-			{
-				_ora(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0x06: // ASL $FF (Zeropage) C <- 76543210 <- 0
-			{
-				//tZEROPAGE(opcode1) = _asl(ZEROPAGE(opcode1), 2);
-				_asl(ZEROPAGE(opcode1), 2, tZEROPAGE(opcode1));
-			}
-			break;
-		case 0x07: UnimplementedInstruction(); break;
-		case 0x08: // PHP (Implied/Stack) P to Stack
-			{
-				// Processor Status Register to Stack
-				state->memory[state->SP] = (state->sr.C | state->sr.Z << 1 | state->sr.I << 2 | state->sr.D << 3 | state->sr.B << 4 | state->sr.dc << 5 | state->sr.V << 6 | state->sr.N << 7); // SPH
-				state->SP = state->SP - 1;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x09: // ORA #$FF (Immediate) A OR M -> A (A V M -> A)
-			{
-				_ora(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0x0A: // ASL A (Accumulator) C <- 76543210 <- 0
-			{
-				_asl(state->A, 1, state->A); // read/modify/write instruction
-			}
-			break;
-		case 0x0B: UnimplementedInstruction(); break;
-		case 0x0C: UnimplementedInstruction(); break;
-		case 0x0D: // ORA $FFFF (Absolute)  A OR M -> A (A V M -> A)
-			{
-				_ora(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x0E: // ASL $FFFF (Absolute) C <- 76543210 <- 0
-			{
-				_asl(ABSOLUTE(opcode1, opcode2), 3, tABSOLUTE(opcode1, opcode2));
-			}
-			break;
-		case 0x0F: UnimplementedInstruction(); break;
+		state->halted = 1;
+		state->run_until = state->cycles;
+	}
+}
 
-		case 0x10: // BPL $FFFF (Relative) Branch on N = 0
-			{
-				(state->sr.N == 0) ? (state->PC = BRANCH(opcode1)) : (state->PC = state->PC + 2);
-			}
-			break;
-		case 0x11: // ORA ($FF),Y (Indirect Indexed,Y)	A OR M -> A (A V M -> A)
-			{
-				_ora(INDIRECTY(opcode1), 2);
-			}
-			break;
-		case 0x12: UnimplementedInstruction(); break;
-		case 0x13: UnimplementedInstruction(); break;
-		case 0x14: UnimplementedInstruction(); break;
-		case 0x15: // ORA $FF,X (Zeropage,X) A OR M -> A (A V M -> A)
-			{
-				_ora(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0x16: // ASL $FF,X (Zeropage,X) C <- 76543210 <- 0
-			{
-				_asl(ZEROPAGEX(opcode1), 2, tZEROPAGEX(opcode1));
-			}
-			break;
-		case 0x17: UnimplementedInstruction(); break;
-		case 0x18: // CLC (Implied) 0 -> C
-			{
-				state->sr.C = 0;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x19: // ORA $FFFF,Y (Absolute,Y) A V M -> A
-			{
-				_ora(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x1A: UnimplementedInstruction(); break;
-		case 0x1B: UnimplementedInstruction(); break;
-		case 0x1C: UnimplementedInstruction(); break;
-		case 0x1D: // ORA $FFFF,X (Absolute,X) A OR M -> A (A V M -> A)
-			{
-				_ora(ABSOLUTEX(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x1E: // ASL $FFFF,X (Absolute,X) C <- 76543210 <- 0
-			{
-				_asl(ABSOLUTEX(opcode1, opcode2), 3, tABSOLUTEX(opcode1, opcode2));
-			}
-			break;
-		case 0x1F: UnimplementedInstruction(); break;
+// ORA ($FF,X) (Indexed Indirect,X)	A OR M -> A (A V M -> A)
+OPCODE(0x01)
+{
+	_ora(INDIRECTX(opcode1), 2);
+}
 
-		case 0x20: // JSR $XXXX (Absolute) PC + 2 to Stack
-			{
-				state->PC = state->PC + 2;
-				state->memory[state->SP] = state->PC & 0xFF; // SPL
-				state->memory[state->SP - 1] = (state->PC >> 8) & 0xFF; // SPH
-				state->SP = state->SP - 2;
-				state->PC = (uint16_t) (opcode1 | (opcode2 << 8));
-			}
-			break;
-		case 0x21: // AND ($FF,X) (Indexed Indirect,X)	A AND M -> A (A /\ M -> A)
-			{
-				_and(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0x22: UnimplementedInstruction(); break;
-		case 0x23: UnimplementedInstruction(); break;
-		case 0x24: // BIT $FF (ZeroPage) A AND M -> Z (M /\ A) M7 -> N, M6 -> V
-			{
-				uint8_t b7 = 0x01 & (ZEROPAGE(opcode1) >> 7); // bit 7 affects the N flag
-				uint8_t b6 = 0x01 & (ZEROPAGE(opcode1) >> 6); // bit 6 affects the V flag
-				uint16_t answer = (uint16_t) (state->A & ZEROPAGE(opcode1));
-				state->sr.N = ((b7 & 0x01) == 1);
-				state->sr.V = ((b6 & 0x01) == 1);
-				state->sr.Z = ((answer & 0xFF) == 0); // Zero
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x25: // AND $FF (Zeropage) A AND M -> A (A /\ M -> A)
-			{
-				_and(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0x26: // ROL $FF (ZeroPage) <- 76543210 <- C <-
-			{
-				_rol(ZEROPAGE(opcode1), 2, tZEROPAGE(opcode1));
-			}
-			break;
-		case 0x27: UnimplementedInstruction(); break;
-		case 0x28: // PLP (Implied/Stack) P from Stack
-			{
-				uint8_t psr = Peek(state->SP + 1);
-				// Processor Status Register from Stack
-				state->sr.C = (0x01 == (psr & 0x01));
-				state->sr.Z = (0x02 == (psr & 0x02));
-				state->sr.I = (0x04 == (psr & 0x04));
-				state->sr.D = (0x08 == (psr & 0x08));
-				state->sr.B = (0x10 == (psr & 0x10));
-				state->sr.dc = (0x20 == (psr & 0x20));
-				state->sr.V = (0x40 == (psr & 0x40));
-				state->sr.N = (0x80 == (psr & 0x80));
-				state->SP = state->SP + 1;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x29: // AND #$FF (Immediate) A AND M -> A (A /\ M -> A)
-			{
-				_and(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0x2A: // ROL A (Accumulator) <- 76543210 <- C <-
-			{
-				_rol(state->A, 1, state->A);
-			}
-			break;
-		case 0x2B: UnimplementedInstruction(); break;
-		case 0x2C: // BIT $FFFF (Absolute) A AND M -> Z (M /\ A) M7 -> N, M6 -> V
-			{
-				uint8_t b7 = 0x01 & (ABSOLUTE(opcode1, opcode2) >> 7); // bit 7 affects the N flag
-				uint8_t b6 = 0x01 & (ABSOLUTE(opcode1, opcode2) >> 6); // bit 6 affects the V flag
-				uint16_t answer = (uint16_t) (state->A & ABSOLUTE(opcode1, opcode2));
-				state->sr.N = ((b7 & 0x01) == 1);
-				state->sr.V = ((b6 & 0x01) == 1);
-				state->sr.Z = ((answer & 0xFF) == 0); // Zero
-				state->PC = state->PC + 3;
-			}
-			break;
-		case 0x2D: // AND $FFFF (Absolute)  A AND M -> A (A /\M -> A)
-			{
-				_and(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x2E: // ROL $FFFF (Absolute) <- 76543210 <- C <-
-			{
-				_rol(ABSOLUTE(opcode1, opcode2), 3, tABSOLUTE(opcode1, opcode2));
-			}
-			break;
-		case 0x2F: UnimplementedInstruction(); break;
+OPCODE(0x02) { UnimplementedInstruction(state); }
+OPCODE(0x03) { UnimplementedInstruction(state); }
+OPCODE(0x04) { UnimplementedInstruction(state); }
 
-		case 0x30: // BMI $FFFF Branch on N = 1
-			{
-				(state->sr.N == 1) ? (state->PC = BRANCH(opcode1)) : (state->PC = state->PC + 2);
-			}
-			break;
-		case 0x31: // AND ($FF),Y (Indirect Indexed,Y)	A AND M -> A (A /\ M -> A)
-			{
-				_and(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0x32: UnimplementedInstruction(); break;
-		case 0x33: UnimplementedInstruction(); break;
-		case 0x34: UnimplementedInstruction(); break;
-		case 0x35: // AND $FF,X (Zeropage,X) A AND M -> A (A /\ M -> A)
-			{
-				_and(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0x36: // ROL $FF,X (ZeroPage,X) <- 76543210 <- C <-
-			{
-				_rol(tZEROPAGEX(opcode1), 2, tZEROPAGEX(opcode1));
-			}
-			break;
-		case 0x37: UnimplementedInstruction(); break;
-		case 0x38: // SEC (Implied) 1 -> C
-			{
-				state->sr.C = 1;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x39: // AND $FFFF,Y (Absolute,Y) A AND M -> A (A /\ M -> A)
-			{
-				_and(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x3A: UnimplementedInstruction(); break;
-		case 0x3B: UnimplementedInstruction(); break;
-		case 0x3C: UnimplementedInstruction(); break;
-		case 0x3D: // AND $FFFF,X (Absolute,X) A AND M -> A (A /\ M -> A)
-			{
-				_and(ABSOLUTEX(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x3E: // ROL $FFFF,X (Absolute,X) <- 76543210 <- C <-
-			{
-				_rol(ABSOLUTEX(opcode1, opcode2), 3, tABSOLUTEX(opcode1, opcode2));
-			}
-			break;
-		case 0x3F: UnimplementedInstruction(); break;
+// ORA $FF (Zeropage)  A OR M -> A
+OPCODE(0x05)
+{
+	_ora(ZEROPAGE(opcode1), 2);
+}
 
-		case 0x40: // RTI (Implied) Return from Interrupt
-			{
-				uint8_t psr = state->memory[state->SP + 1];
-				// Processor Status Register from Stack
-				state->sr.C = (0x01 == (psr & 0x01));
-				state->sr.Z = (0x02 == (psr & 0x02));
-				state->sr.I = (0x04 == (psr & 0x04));
-				state->sr.D = (0x08 == (psr & 0x08));
-				state->sr.B = (0x10 == (psr & 0x10));
-				state->sr.dc = (0x20 == (psr & 0x20));
-				state->sr.V = (0x40 == (psr & 0x40));
-				state->sr.N = (0x80 == (psr & 0x80));
-				state->SP = state->SP + 1;
-				// PC from Stack
-				state->PC = state->memory[state->SP + 1] | (state->memory[state->SP + 2] << 8);
-				state->SP = state->SP + 2;
-			}
-			break;
-		case 0x41: // EOR ($FF,X) (Indexed Indirect,X)	A EOR M -> A
-			{
-				_eor(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0x42: UnimplementedInstruction(); break;
-		case 0x43: UnimplementedInstruction(); break;
-		case 0x44: UnimplementedInstruction(); break;
-		case 0x45: // EOR $FF (Zeropage) A EOR M -> A
-			{
-				_eor(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0x46: // LSR $FF (Zeropage) 0 -> 76543210 -> C
-			{
-				_lsr(ZEROPAGE(opcode1), 2, tZEROPAGE(opcode1));
-			}
-			break;
-		case 0x47: UnimplementedInstruction(); break;
-		case 0x48: // PHA (Implied/Stack) A to Stack
-			{
-				state->memory[state->SP] = (uint8_t) state->A;
-				state->SP = state->SP - 1;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x49: // EOR #$FF (Immediate) A EOR M -> A
-			{
-				_eor(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0x4A: // LSR A (Accumulator) 0 -> 76543210 -> C
-			{
-				_lsr(state->A, 1, state->A);
-			}
-			break;
-		case 0x4B: UnimplementedInstruction(); break;
-		case 0x4C: // JMP $XXXX (Absolute) (PC + 1) -> PCL, (PC + 2) -> PCH
-			{
-				state->PC = (uint16_t)(opcode1 | (opcode2 << 8));
-			}
-			break;
-		case 0x4D: // EOR $FFFF (Absolute)  A EOR M -> A
-			{
-				_eor(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x4E: // LSR $FFFF (Absolute) 0 -> 76543210 -> C
-			{
-				_lsr(ABSOLUTE(opcode1, opcode2), 3, tABSOLUTE(opcode1, opcode2));
-			}
-			break;
-		case 0x4F: UnimplementedInstruction(); break;
+// ASL $FF (Zeropage) C <- 76543210 <- 0
+OPCODE(0x06)
+{
+	_rmw(_asl, aZEROPAGE(opcode1), 2);
+}
+
+OPCODE(0x07) { UnimplementedInstruction(state); }
+
+// PHP (Implied/Stack) P to Stack
+OPCODE(0x08)
+{
+	// Processor Status Register to Stack
+	Poke(state, aSTACK(0), GetStatusRegister6510(state)); // SPH
+	SP_ADD(-1);
+	state->PC = state->PC + 1;
+}
+
+// ORA #$FF (Immediate) A OR M -> A (A V M -> A)
+OPCODE(0x09)
+{
+	_ora(IMMEDIATE(opcode1), 2);
+}
+
+// ASL A (Accumulator) C <- 76543210 <- 0
+OPCODE(0x0A)
+{
+	_asl(state->A, 1, state->A); // read/modify/write instruction
+}
+
+OPCODE(0x0B) { UnimplementedInstruction(state); }
+OPCODE(0x0C) { UnimplementedInstruction(state); }
+
+// ORA $FFFF (Absolute)  A OR M -> A (A V M -> A)
+OPCODE(0x0D)
+{
+	_ora(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// ASL $FFFF (Absolute) C <- 76543210 <- 0
+OPCODE(0x0E)
+{
+	_rmw(_asl, aABSOLUTE(opcode1, opcode2), 3);
+}
+
+OPCODE(0x0F) { UnimplementedInstruction(state); }
+
+// BPL $FFFF (Relative) Branch on N = 0
+OPCODE(0x10)
+{
+	_branch(NegativeFlag == 0, opcode1);
+}
+
+// ORA ($FF),Y (Indirect Indexed,Y)	A OR M -> A (A V M -> A)
+OPCODE(0x11)
+{
+	PAGE_CROSSING(Peek(state, opcode1) + state->Y);
+	_ora(INDIRECTY(opcode1), 2);
+}
+
+OPCODE(0x12) { UnimplementedInstruction(state); }
+OPCODE(0x13) { UnimplementedInstruction(state); }
+OPCODE(0x14) { UnimplementedInstruction(state); }
+
+// ORA $FF,X (Zeropage,X) A OR M -> A (A V M -> A)
+OPCODE(0x15)
+{
+	_ora(ZEROPAGEX(opcode1), 2);
+}
+
+// ASL $FF,X (Zeropage,X) C <- 76543210 <- 0
+OPCODE(0x16)
+{
+	_rmw(_asl, aZEROPAGEX(opcode1), 2);
+}
+
+OPCODE(0x17) { UnimplementedInstruction(state); }
+
+// CLC (Implied) 0 -> C
+OPCODE(0x18)
+{
+	StatusRegisterCarryBit(0);
+	state->PC = state->PC + 1;
+}
+
+// ORA $FFFF,Y (Absolute,Y) A V M -> A
+OPCODE(0x19)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_ora(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+OPCODE(0x1A) { UnimplementedInstruction(state); }
+OPCODE(0x1B) { UnimplementedInstruction(state); }
+OPCODE(0x1C) { UnimplementedInstruction(state); }
+
+// ORA $FFFF,X (Absolute,X) A OR M -> A (A V M -> A)
+OPCODE(0x1D)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_ora(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// ASL $FFFF,X (Absolute,X) C <- 76543210 <- 0
+OPCODE(0x1E)
+{
+	_rmw(_asl, aABSOLUTEX(opcode1, opcode2), 3);
+}
+
+OPCODE(0x1F) { UnimplementedInstruction(state); }
+
+// JSR $XXXX (Absolute) PC + 2 to Stack
+OPCODE(0x20)
+{
+	state->PC = state->PC + 2;
+	Poke(state, aSTACK(0), (state->PC >> 8) & 0xFF); // SPH
+	Poke(state, aSTACK(-1), state->PC & 0xFF); // SPL
+	SP_ADD(-2);
+	state->PC = (uint16_t) (opcode1 | (opcode2 << 8));
+	PROFILE_CALL(state, 2);
+}
+
+// AND ($FF,X) (Indexed Indirect,X)	A AND M -> A (A /\ M -> A)
+OPCODE(0x21)
+{
+	_and(INDIRECTX(opcode1), 2);
+}
+
+OPCODE(0x22) { UnimplementedInstruction(state); }
+OPCODE(0x23) { UnimplementedInstruction(state); }
+
+// BIT $FF (ZeroPage) A AND M -> Z (M /\ A) M7 -> N, M6 -> V
+OPCODE(0x24)
+{
+	uint8_t m = ZEROPAGE(opcode1);
+	StatusRegisterNegative(m); // bit 7 affects the N flag
+	StatusRegisterOverflowBit((m >> 6) & 0x01); // bit 6 affects the V flag
+	StatusRegisterZero(state->A & m);
+	state->PC = state->PC + 2;
+}
+
+// AND $FF (Zeropage) A AND M -> A (A /\ M -> A)
+OPCODE(0x25)
+{
+	_and(ZEROPAGE(opcode1), 2);
+}
+
+// ROL $FF (ZeroPage) <- 76543210 <- C <-
+OPCODE(0x26)
+{
+	_rmw(_rol, aZEROPAGE(opcode1), 2);
+}
+
+OPCODE(0x27) { UnimplementedInstruction(state); }
+
+// PLP (Implied/Stack) P from Stack
+OPCODE(0x28)
+{
+	uint8_t psr = Peek(state, aSTACK(1));
+	// Processor Status Register from Stack
+	SetStatusRegister6510(state, psr);
+	SP_ADD(1);
+	state->PC = state->PC + 1;
+	IRQ_CHECK_NEXT();
+}
+
+// AND #$FF (Immediate) A AND M -> A (A /\ M -> A)
+OPCODE(0x29)
+{
+	_and(IMMEDIATE(opcode1), 2);
+}
+
+// ROL A (Accumulator) <- 76543210 <- C <-
+OPCODE(0x2A)
+{
+	_rol(state->A, 1, state->A);
+}
+
+OPCODE(0x2B) { UnimplementedInstruction(state); }
+
+// BIT $FFFF (Absolute) A AND M -> Z (M /\ A) M7 -> N, M6 -> V
+OPCODE(0x2C)
+{
+	uint8_t m = ABSOLUTE(opcode1, opcode2);
+	StatusRegisterNegative(m); // bit 7 affects the N flag
+	StatusRegisterOverflowBit((m >> 6) & 0x01); // bit 6 affects the V flag
+	StatusRegisterZero(state->A & m);
+	state->PC = state->PC + 3;
+}
+
+// AND $FFFF (Absolute)  A AND M -> A (A /\M -> A)
+OPCODE(0x2D)
+{
+	_and(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// ROL $FFFF (Absolute) <- 76543210 <- C <-
+OPCODE(0x2E)
+{
+	_rmw(_rol, aABSOLUTE(opcode1, opcode2), 3);
+}
+
+OPCODE(0x2F) { UnimplementedInstruction(state); }
+
+// BMI $FFFF Branch on N = 1
+OPCODE(0x30)
+{
+	_branch(NegativeFlag == 1, opcode1);
+}
+
+// AND ($FF),Y (Indirect Indexed,Y)	A AND M -> A (A /\ M -> A)
+OPCODE(0x31)
+{
+	PAGE_CROSSING(Peek(state, opcode1) + state->Y);
+	_and(INDIRECTY(opcode1), 2);
+}
+
+OPCODE(0x32) { UnimplementedInstruction(state); }
+OPCODE(0x33) { UnimplementedInstruction(state); }
+OPCODE(0x34) { UnimplementedInstruction(state); }
+
+// AND $FF,X (Zeropage,X) A AND M -> A (A /\ M -> A)
+OPCODE(0x35)
+{
+	_and(ZEROPAGEX(opcode1), 2);
+}
+
+// ROL $FF,X (ZeroPage,X) <- 76543210 <- C <-
+OPCODE(0x36)
+{
+	_rmw(_rol, aZEROPAGEX(opcode1), 2);
+}
+
+OPCODE(0x37) { UnimplementedInstruction(state); }
+
+// SEC (Implied) 1 -> C
+OPCODE(0x38)
+{
+	StatusRegisterCarryBit(1);
+	state->PC = state->PC + 1;
+}
+
+// AND $FFFF,Y (Absolute,Y) A AND M -> A (A /\ M -> A)
+OPCODE(0x39)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_and(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+OPCODE(0x3A) { UnimplementedInstruction(state); }
+OPCODE(0x3B) { UnimplementedInstruction(state); }
+OPCODE(0x3C) { UnimplementedInstruction(state); }
+
+// AND $FFFF,X (Absolute,X) A AND M -> A (A /\ M -> A)
+OPCODE(0x3D)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_and(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// ROL $FFFF,X (Absolute,X) <- 76543210 <- C <-
+OPCODE(0x3E)
+{
+	_rmw(_rol, aABSOLUTEX(opcode1, opcode2), 3);
+}
+
+OPCODE(0x3F) { UnimplementedInstruction(state); }
+
+// RTI (Implied) Return from Interrupt
+OPCODE(0x40)
+{
+	uint8_t psr = Peek(state, aSTACK(1));
+	// Processor Status Register from Stack
+	SetStatusRegister6510(state, psr);
+	SP_ADD(1);
+	// PC from Stack
+	state->PC = Peek(state, aSTACK(1)) | (Peek(state, aSTACK(2)) << 8);
+	SP_ADD(2);
+	PROFILE_RETURN(state);
+	IRQ_CHECK();
+}
+
+// EOR ($FF,X) (Indexed Indirect,X)	A EOR M -> A
+OPCODE(0x41)
+{
+	_eor(INDIRECTX(opcode1), 2);
+}
+
+OPCODE(0x42) { UnimplementedInstruction(state); }
+OPCODE(0x43) { UnimplementedInstruction(state); }
+OPCODE(0x44) { UnimplementedInstruction(state); }
+
+// EOR $FF (Zeropage) A EOR M -> A
+OPCODE(0x45)
+{
+	_eor(ZEROPAGE(opcode1), 2);
+}
+
+// LSR $FF (Zeropage) 0 -> 76543210 -> C
+OPCODE(0x46)
+{
+	_rmw(_lsr, aZEROPAGE(opcode1), 2);
+}
+
+OPCODE(0x47) { UnimplementedInstruction(state); }
+
+// PHA (Implied/Stack) A to Stack
+OPCODE(0x48)
+{
+	Poke(state, aSTACK(0), (uint8_t) state->A);
+	SP_ADD(-1);
+	state->PC = state->PC + 1;
+}
+
+// EOR #$FF (Immediate) A EOR M -> A
+OPCODE(0x49)
+{
+	_eor(IMMEDIATE(opcode1), 2);
+}
+
+// LSR A (Accumulator) 0 -> 76543210 -> C
+OPCODE(0x4A)
+{
+	_lsr(state->A, 1, state->A);
+}
+
+OPCODE(0x4B) { UnimplementedInstruction(state); }
+
+// JMP $XXXX (Absolute) (PC + 1) -> PCL, (PC + 2) -> PCH
+OPCODE(0x4C)
+{
+	state->PC = (uint16_t)(opcode1 | (opcode2 << 8));
+}
+
+// EOR $FFFF (Absolute)  A EOR M -> A
+OPCODE(0x4D)
+{
+	_eor(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// LSR $FFFF (Absolute) 0 -> 76543210 -> C
+OPCODE(0x4E)
+{
+	_rmw(_lsr, aABSOLUTE(opcode1, opcode2), 3);
+}
+
+OPCODE(0x4F) { UnimplementedInstruction(state); }
+
+// BVC $FFFF (Relative) Branch on V = 0
+OPCODE(0x50)
+{
+	_branch(OverflowFlag == 0, opcode1);
+}
+
+// EOR ($FF),Y (Indirect Indexed,Y) A EOR M -> A
+OPCODE(0x51)
+{
+	PAGE_CROSSING(Peek(state, opcode1) + state->Y);
+	_eor(INDIRECTY(opcode1), 2);
+}
+
+OPCODE(0x52) { UnimplementedInstruction(state); }
+OPCODE(0x53) { UnimplementedInstruction(state); }
+OPCODE(0x54) { UnimplementedInstruction(state); }
+
+// EOR $FF,X (Zeropage,X) A EOR M -> A
+OPCODE(0x55)
+{
+	_eor(ZEROPAGEX(opcode1), 2);
+}
+
+// LSR $FF,X (Zeropage,X) 0 -> 76543210 -> C
+OPCODE(0x56)
+{
+	_rmw(_lsr, aZEROPAGEX(opcode1), 2);
+}
+
+OPCODE(0x57) { UnimplementedInstruction(state); }
+
+// CLI (Implied) 0 -> I
+OPCODE(0x58)
+{
+	state->sr.I = 0;
+	state->PC = state->PC + 1;
+	IRQ_CHECK_NEXT();
+}
+
+// EOR $FFFF,Y (Absolute,Y) A EOR M -> A
+OPCODE(0x59)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_eor(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+OPCODE(0x5A) { UnimplementedInstruction(state); }
+OPCODE(0x5B) { UnimplementedInstruction(state); }
+OPCODE(0x5C) { UnimplementedInstruction(state); }
+
+// EOR $FFFF,X (Absolute,X) A EOR M -> A
+OPCODE(0x5D)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_eor(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// LSR $FFFF,X (Absolute,X) 0 -> 76543210 -> C
+OPCODE(0x5E)
+{
+	_rmw(_lsr, aABSOLUTEX(opcode1, opcode2), 3);
+}
+
+OPCODE(0x5F) { UnimplementedInstruction(state); }
+
+// RTS (Implied/Stack) Return from Subroutine
+OPCODE(0x60)
+{
+	// PC from Stack
+	//state->PC = state->memory[state->SP + 1] | (state->memory[state->SP + 2] << 8);
+	state->PC = (Peek(state, aSTACK(1)) | (Peek(state, aSTACK(2)) << 8));
+	SP_ADD(2);
+	// PC + 1
+	state->PC = state->PC + 1;
+	PROFILE_RETURN(state);
+}
+
+// ADC ($FF,X) (Indirect,X) A + M + C -> A, C
+OPCODE(0x61)
+{
+	_adc(INDIRECTX(opcode1), 2);
+}
+
+OPCODE(0x62) { UnimplementedInstruction(state); }
+OPCODE(0x63) { UnimplementedInstruction(state); }
+OPCODE(0x64) { UnimplementedInstruction(state); }
+
+// ADC $FF (ZeroPage) A + M + C -> A, C
+OPCODE(0x65)
+{
+	_adc(ZEROPAGE(opcode1), 2);
+}
+
+// ROR $FF (ZeroPage) b0 -> C -> 76543210 -> C
+OPCODE(0x66)
+{
+	_rmw(_ror, aZEROPAGE(opcode1), 2);
+}
+
+OPCODE(0x67) { UnimplementedInstruction(state); }
+
+// PLA (Implied/Stack) A from Stack
+OPCODE(0x68)
+{
+	state->A = Peek(state, aSTACK(1));
+	StatusRegisterNegative(state->A);
+	StatusRegisterZero(state->A);
+	SP_ADD(1);
+	state->PC = state->PC + 1;
+}
+
+// ADC #$FF (Immediate) A + M + C -> A, C
+OPCODE(0x69)
+{
+	_adc(IMMEDIATE(opcode1), 2);
+}
+
+// ROR A (Accumulator) b0 -> C-> 76543210 -> C
+OPCODE(0x6A)
+{
+	_ror(state->A, 1, state->A);
+}
+
+OPCODE(0x6B) { UnimplementedInstruction(state); }
+
+// JMP ($XXXX) (Abs.Indirect) (PC + 1) -> PCL, (PC + 2) -> PCH
+OPCODE(0x6C)
+{
+	// Load ADL from address $XXXX address and load ADH from address $XXXX + 1
+	state->PC = Peek(state, (uint16_t)(opcode1 | (opcode2 << 8))) | (Peek(state, (uint16_t)((opcode1 | (opcode2 << 8)) + 1)) << 8);
+}
+
+// ADC $FFFF (Absolute) A + M + C -> A, C
+OPCODE(0x6D)
+{
+	_adc(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// ROR $FFFF (Absolute) b0 -> C -> 76543210 -> C
+OPCODE(0x6E)
+{
+	_rmw(_ror, aABSOLUTE(opcode1, opcode2), 3);
+}
+
+OPCODE(0x6F) { UnimplementedInstruction(state); }
+
+// BVS $FFFF (Relative) Branch on V = 1
+OPCODE(0x70)
+{
+	_branch(OverflowFlag == 1, opcode1);
+}
+
+// ADC ($FF),Y ((Indirect),Y) A + M + C -> A, C
+OPCODE(0x71)
+{
+	PAGE_CROSSING(Peek(state, opcode1) + state->Y);
+	_adc(INDIRECTY(opcode1), 2);
+}
+
+OPCODE(0x72) { UnimplementedInstruction(state); }
+OPCODE(0x73) { UnimplementedInstruction(state); }
+OPCODE(0x74) { UnimplementedInstruction(state); }
+
+// ADC $FF,X (ZeroPage,X) A + M + C -> A, C
+OPCODE(0x75)
+{
+	_adc(ZEROPAGEX(opcode1), 2);
+}
+
+// ROR $FF,X (ZeroPage,X) b0 -> C -> 76543210 -> C
+OPCODE(0x76)
+{
+	_rmw(_ror, aZEROPAGEX(opcode1), 2);
+}
+
+OPCODE(0x77) { UnimplementedInstruction(state); }
+
+// SEI (Implied) 1 -> I
+OPCODE(0x78)
+{
+	state->sr.I = 1;
+	state->PC = state->PC + 1;
+}
+
+// ADC $FFFF,Y (Absolute,Y) A + M + C -> A, C
+OPCODE(0x79)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_adc(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+OPCODE(0x7A) { UnimplementedInstruction(state); }
+OPCODE(0x7B) { UnimplementedInstruction(state); }
+OPCODE(0x7C) { UnimplementedInstruction(state); }
+
+// ADC $FFFF,X (Absolute,X) A + M + C -> A, C
+OPCODE(0x7D)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_adc(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// ROR $FFFF,X (Absolute,X) b0 -> C -> 76543210 -> C
+OPCODE(0x7E)
+{
+	_rmw(_ror, aABSOLUTEX(opcode1, opcode2), 3);
+}
+
+OPCODE(0x7F) { UnimplementedInstruction(state); }
+
+OPCODE(0x80) { UnimplementedInstruction(state); }
+
+// STA ($FF,X) (Indirect,X) A -> M
+OPCODE(0x81)
+{
+	Poke(state, aINDIRECTX(opcode1), state->A); // LSB
+	state->PC = state->PC + 2;
+}
+
+OPCODE(0x82) { UnimplementedInstruction(state); }
+OPCODE(0x83) { UnimplementedInstruction(state); }
+
+// STY $FF (ZeroPage) Y -> M
+OPCODE(0x84)
+{
+	Poke(state, aZEROPAGE(opcode1), state->Y); // LSB
+	state->PC = state->PC + 2;
+}
+
+// STA $FF (ZeroPage) A -> M
+OPCODE(0x85)
+{
+	Poke(state, aZEROPAGE(opcode1), state->A);
+	state->PC = state->PC + 2;
+}
+
+// STX $FF (ZeroPage) X -> M
+OPCODE(0x86)
+{
+	Poke(state, aZEROPAGE(opcode1), state->X); // LSB
+	state->PC = state->PC + 2;
+}
+
+OPCODE(0x87) { UnimplementedInstruction(state); }
+
+// DEY (Implied) Y - 1 -> Y
+OPCODE(0x88)
+{
+	_dey();
+}
+
+OPCODE(0x89) { UnimplementedInstruction(state); }
+
+// TXA (Implied) X -> A
+OPCODE(0x8A)
+{
+	uint16_t answer = (uint16_t) state->X;
+	StatusRegisterNegative(answer);
+	StatusRegisterZero(answer);
+	state->A = (uint8_t) answer; // LSB
+	state->PC = state->PC + 1;
+}
+
+OPCODE(0x8B) { UnimplementedInstruction(state); }
+
+// STY $FFFF (Absolute) A -> M
+OPCODE(0x8C)
+{
+	Poke(state, aABSOLUTE(opcode1, opcode2), state->Y); // LSB
+	state->PC = state->PC + 3;
+}
+
+// STA $FFFF (Absolute) A -> M
+OPCODE(0x8D)
+{
+	Poke(state, aABSOLUTE(opcode1, opcode2), state->A); // LSB
+	state->PC = state->PC + 3;
+}
+
+// STX $FFFF (Absolute) X -> M
+OPCODE(0x8E)
+{
+	Poke(state, aABSOLUTE(opcode1, opcode2), state->X); // LSB
+	state->PC = state->PC + 3;
+}
+
+OPCODE(0x8F) { UnimplementedInstruction(state); }
+
+// BCC $FFFF (Relative) Branch on C = 0
+OPCODE(0x90)
+{
+	_branch(CarryFlag == 0, opcode1);
+}
+
+// STA ($FF),Y (Indirect),Y A -> M
+OPCODE(0x91)
+{
+	Poke(state, aINDIRECTY(opcode1), state->A); // LSB
+	state->PC = state->PC + 2;
+}
+
+OPCODE(0x92) { UnimplementedInstruction(state); }
+OPCODE(0x93) { UnimplementedInstruction(state); }
+
+// STY $FF,X (ZeroPage,X) Y -> M
+OPCODE(0x94)
+{
+	Poke(state, aZEROPAGEX(opcode1), state->Y); // LSB
+	state->PC = state->PC + 2;
+}
+
+// STA $FF,X (ZeroPage,X) A -> M
+OPCODE(0x95)
+{
+	Poke(state, aZEROPAGEX(opcode1), state->A); // LSB
+	state->PC = state->PC + 2;
+}
+
+// STX $FF,Y (ZeroPage,Y) X -> M
+OPCODE(0x96)
+{
+	Poke(state, aZEROPAGEY(opcode1), state->X); // LSB
+	state->PC = state->PC + 2;
+}
+
+OPCODE(0x97) { UnimplementedInstruction(state); }
+
+// TYA (Implied) Y -> A
+OPCODE(0x98)
+{
+	uint16_t answer = (uint16_t) state->Y;
+	StatusRegisterNegative(answer);
+	StatusRegisterZero(answer);
+	state->A = (uint8_t) (answer & 0xff); // LSB
+	state->PC = state->PC + 1;
+}
+
+// STA $FFFF,Y (Absolute,Y) A -> M
+OPCODE(0x99)
+{
+	Poke(state, aABSOLUTEY(opcode1, opcode2), state->A); // LSB
+	state->PC = state->PC + 3;
+}
+
+// TXS (Implied) X -> S
+OPCODE(0x9A)
+{
+	// Transfer index X to Stack Pointer
+	state->SP = 0x0100 | state->X; // the stack is always in page 1
+	state->PC = state->PC + 1;
+}
+
+OPCODE(0x9B) { UnimplementedInstruction(state); }
+OPCODE(0x9C) { UnimplementedInstruction(state); }
+
+// STA $FFFF,X (Absolute,X) A -> M
+OPCODE(0x9D)
+{
+	Poke(state, aABSOLUTEX(opcode1, opcode2), state->A); // LSB
+	state->PC = state->PC + 3;
+}
+
+OPCODE(0x9E) { UnimplementedInstruction(state); }
+OPCODE(0x9F) { UnimplementedInstruction(state); }
+
+// LDY #$FF (Immediate) M -> Y
+OPCODE(0xA0)
+{
+	_ldy(IMMEDIATE(opcode1), 2);
+}
+
+// LDA ($FF,X) (Indexed Indirect,X)	M -> A
+OPCODE(0xA1)
+{
+	_lda(INDIRECTX(opcode1), 2);
+}
+
+// LDX #$FF (Immediate) M -> X
+OPCODE(0xA2)
+{
+	_ldx(IMMEDIATE(opcode1), 2);
+}
+
+OPCODE(0xA3) { UnimplementedInstruction(state); }
+
+// LDY $FF (Zeropage) M -> Y
+OPCODE(0xA4)
+{
+	_ldy(ZEROPAGE(opcode1), 2);
+}
+
+// LDA $FF (Zeropage) M -> A
+OPCODE(0xA5)
+{
+	_lda(ZEROPAGE(opcode1), 2);
+}
+
+// LDX $FF (ZeroPage) M -> X
+OPCODE(0xA6)
+{
+	_ldx(ZEROPAGE(opcode1), 2);
+}
+
+OPCODE(0xA7) { UnimplementedInstruction(state); }
+
+// TAY (Implied) A -> Y
+OPCODE(0xA8)
+{
+	uint16_t answer = (uint16_t) state->A;
+	StatusRegisterNegative(answer);
+	StatusRegisterZero(answer);
+	state->Y = (uint8_t) answer; // LSB
+	state->PC = state->PC + 1;
+}
+
+// LDA #$FF (Immediate) M -> A
+OPCODE(0xA9)
+{
+	_lda(IMMEDIATE(opcode1), 2);
+}
+
+// TAX (Implied) A -> X
+OPCODE(0xAA)
+{
+	uint8_t answer = (uint8_t) state->A;
+	StatusRegisterNegative(answer);
+	StatusRegisterZero(answer);
+	state->X = (uint8_t) answer; // LSB
+	state->PC = state->PC + 1;
+}
+
+OPCODE(0xAB) { UnimplementedInstruction(state); }
+
+// LDY $FFFF (Absolute) M -> Y
+OPCODE(0xAC)
+{
+	_ldy(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// LDA $FFFF (Absolute) M -> A
+OPCODE(0xAD)
+{
+	_lda(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// LDX $FFFF (Absolute) M -> X
+OPCODE(0xAE)
+{
+	_ldx(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+OPCODE(0xAF) { UnimplementedInstruction(state); }
+
+// BCS $FFFF (Relative) Branch on C = 1
+OPCODE(0xB0)
+{
+	_branch(CarryFlag == 1, opcode1);
+}
+
+// LDA ($FF),Y (Indirect Indexed),Y	M -> A
+OPCODE(0xB1)
+{
+	PAGE_CROSSING(Peek(state, opcode1) + state->Y);
+	_lda(INDIRECTY(opcode1), 2);
+}
+
+OPCODE(0xB2) { UnimplementedInstruction(state); }
+OPCODE(0xB3) { UnimplementedInstruction(state); }
+
+// LDY $FF,X (Zeropage,X) M -> Y
+OPCODE(0xB4)
+{
+	_ldy(ZEROPAGEX(opcode1), 2);
+}
+
+// LDA $FF,X (Zeropage,X) M -> A
+OPCODE(0xB5)
+{
+	_lda(ZEROPAGEX(opcode1), 2);
+}
+
+// LDX $FF,Y (ZeroPage,Y) M -> X
+OPCODE(0xB6)
+{
+	_ldx(ZEROPAGEY(opcode1), 2);
+}
+
+OPCODE(0xB7) { UnimplementedInstruction(state); }
+
+// CLV (Implied) 0 -> V
+OPCODE(0xB8)
+{
+	StatusRegisterOverflowBit(0);
+	state->PC = state->PC + 1;
+}
+
+// LDA $FFFF,Y (Absolute,Y) M -> A
+OPCODE(0xB9)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_lda(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+// TSX (Implied) S -> X
+OPCODE(0xBA)
+{
+	// Transfer Stack Pointer to index X
+	uint16_t answer = (uint16_t) state->SP;
+	StatusRegisterNegative(answer);
+	StatusRegisterZero(answer);
+	state->X = (uint8_t) answer; // LSB
+	state->PC = state->PC + 1;
+}
+
+OPCODE(0xBB) { UnimplementedInstruction(state); }
+
+// LDY $FFFF,X (Absolute,X) M -> Y
+OPCODE(0xBC)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_ldy(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// LDA $FFFF,X (Absolute,X) M -> A
+OPCODE(0xBD)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_lda(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// LDX $FFFF,Y (Absolute,Y) M -> X
+OPCODE(0xBE)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_ldx(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+OPCODE(0xBF) { UnimplementedInstruction(state); }
+
+// CPY #$FF (Immediate) Y - M
+OPCODE(0xC0)
+{
+	_cpy(IMMEDIATE(opcode1), 2);
+}
+
+// CMP ($FF,X) (Indirect,X) A - M
+OPCODE(0xC1)
+{
+	_cmp(INDIRECTX(opcode1), 2);
+}
 
-		case 0x50: // BVC $FFFF (Relative) Branch on V = 0
-			{
-				(state->sr.V == 0) ? (state->PC = BRANCH(opcode1)) : (state->PC = state->PC + 2);
-			}
-			break;
-		case 0x51: // EOR ($FF),Y (Indirect Indexed,Y) A EOR M -> A
-			{
-				_eor(INDIRECTY(opcode1), 2);
-			}
-			break;
-		case 0x52: UnimplementedInstruction(); break;
-		case 0x53: UnimplementedInstruction(); break;
-		case 0x54: UnimplementedInstruction(); break;
-		case 0x55: // EOR $FF,X (Zeropage,X) A EOR M -> A
-			{
-				_eor(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0x56: // LSR $FF,X (Zeropage,X) 0 -> 76543210 -> C
-			{
-				_lsr(ZEROPAGEX(opcode1), 2, tZEROPAGEX(opcode1));
-			}
-			break;
-		case 0x57: UnimplementedInstruction(); break;
-		case 0x58: // CLI (Implied) 0 -> I
-			{
-				state->sr.I = 0;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x59: // EOR $FFFF,Y (Absolute,Y) A EOR M -> A
-			{
-				_eor(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x5A: UnimplementedInstruction(); break;
-		case 0x5B: UnimplementedInstruction(); break;
-		case 0x5C: UnimplementedInstruction(); break;
-		case 0x5D: // EOR $FFFF,X (Absolute,X) A EOR M -> A
-			{
-				_eor(ABSOLUTEX(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x5E: // LSR $FFFF,X (Absolute,X) 0 -> 76543210 -> C
-			{
-				_lsr(ABSOLUTEX(opcode1, opcode2), 3, tABSOLUTEX(opcode1, opcode2));
-			}
-			break;
-		case 0x5F: UnimplementedInstruction(); break;
+OPCODE(0xC2) { UnimplementedInstruction(state); }
+OPCODE(0xC3) { UnimplementedInstruction(state); }
 
-		case 0x60: // RTS (Implied/Stack) Return from Subroutine
-			{
-				// PC from Stack
-				//state->PC = state->memory[state->SP + 1] | (state->memory[state->SP + 2] << 8);
-				state->PC = (Peek(state->SP + 2) | (Peek(state->SP + 1) << 8));
-				state->SP = state->SP + 2;
-				// PC + 1
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x61: // ADC ($FF,X) (Indirect,X) A + M + C -> A, C
-			{
-				_adc(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0x62: UnimplementedInstruction(); break;
-		case 0x63: UnimplementedInstruction(); break;
-		case 0x64: UnimplementedInstruction(); break;
-		case 0x65: // ADC $FF (ZeroPage) A + M + C -> A, C
-			{
-				_adc(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0x66: // ROR $FF (ZeroPage) b0 -> C -> 76543210 -> C
-			{
-				_ror(ZEROPAGE(opcode1), 2, tZEROPAGE(opcode1));
-			}
-			break;
-		case 0x67: UnimplementedInstruction(); break;
-		case 0x68: // PLA (Implied/Stack) A from Stack
-			{
-				state->A = Peek(state->SP + 1);
-				StatusRegisterNegative(state->A);
-				StatusRegisterZero(state->A);
-				state->SP = state->SP + 1;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x69: // ADC #$FF (Immediate) A + M + C -> A, C
-			{
-				_adc(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0x6A: // ROR A (Accumulator) b0 -> C-> 76543210 -> C
-			{
-				_ror(state->A, 1, state->A);
-			}
-			break;
-		case 0x6B: UnimplementedInstruction(); break;
-		case 0x6C: // JMP ($XXXX) (Abs.Indirect) (PC + 1) -> PCL, (PC + 2) -> PCH
-			{
-				// Load ADL from address $XXXX address and load ADH from address $XXXX + 1
-				state->PC = Peek((uint16_t)(opcode1 | (opcode2 << 8))) | (Peek((uint16_t)((opcode1 | (opcode2 << 8)) + 1)) << 8);
-			}
-			break;
-		case 0x6D: // ADC $FFFF (Absolute) A + M + C -> A, C
-			{
-				_adc(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x6E: // ROR $FFFF (Absolute) b0 -> C -> 76543210 -> C
-			{
-				_ror(ABSOLUTE(opcode1, opcode2), 3, tABSOLUTE(opcode1, opcode2));
-			}
-			break;
-		case 0x6F: UnimplementedInstruction(); break;
+// CPY $FF (Zeropage) Y - M
+OPCODE(0xC4)
+{
+	_cpy(ZEROPAGE(opcode1), 2);
+}
 
-		case 0x70: // BVS $FFFF (Relative) Branch on V = 1
-			{
-				(state->sr.V == 1) ? (state->PC = BRANCH(opcode1)) : (state->PC = state->PC + 2);
-			}
-			break;
-		case 0x71: // ADC ($FF),Y ((Indirect),Y) A + M + C -> A, C
-			{
-				_adc(INDIRECTY(opcode1), 2);
-			}
-			break;
-		case 0x72: UnimplementedInstruction(); break;
-		case 0x73: UnimplementedInstruction(); break;
-		case 0x74: UnimplementedInstruction(); break;
-		case 0x75: // ADC $FF,X (ZeroPage,X) A + M + C -> A, C
-			{
-				_adc(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0x76: // ROR $FF,X (ZeroPage,X) b0 -> C -> 76543210 -> C
-			{
-				_ror(ZEROPAGEX(opcode1), 2, tZEROPAGEX(opcode1));
-			}
-			break;
-		case 0x77: UnimplementedInstruction(); break;
-		case 0x78: // SEI (Implied) 1 -> I
-			{
-				state->sr.I = 1;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x79: // ADC $FFFF,Y (Absolute,Y) A + M + C -> A, C
-			{
-				_adc(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x7A: UnimplementedInstruction(); break;
-		case 0x7B: UnimplementedInstruction(); break;
-		case 0x7C: UnimplementedInstruction(); break;
-		case 0x7D: // ADC $FFFF,X (Absolute,X) A + M + C -> A, C
-			{
-				_adc(ABSOLUTEX(opcode1, opcode2), 3);
-			}
-			break;
-		case 0x7E: // ROR $FFFF,X (Absolute,X) b0 -> C -> 76543210 -> C
-			{
-				_ror(ABSOLUTEX(opcode1, opcode2), 3, tABSOLUTEX(opcode1, opcode2));
-			}
-			break;
-		case 0x7F: UnimplementedInstruction(); break;
+// CMP $FF (Zeropage) A - M
+OPCODE(0xC5)
+{
+	_cmp(ZEROPAGE(opcode1), 2);
+}
 
-		case 0x80: UnimplementedInstruction(); break;
-		case 0x81: // STA ($FF,X) (Indirect,X) A -> M
-			{
-				tINDIRECTX(opcode1) = (uint8_t) state->A; // LSB
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x82: UnimplementedInstruction(); break;
-		case 0x83: UnimplementedInstruction(); break;
-		case 0x84: // STY $FF (ZeroPage) Y -> M
-			{
-				tZEROPAGE(opcode1) = (uint8_t) state->Y; // LSB
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x85: // STA $FF (ZeroPage) A -> M
-			{
-				tZEROPAGE(opcode1) = (uint8_t)state->A;
-				state->PC = state->PC + 2;
-		}
-			break;
-		case 0x86: // STX $FF (ZeroPage) X -> M
-			{
-				tZEROPAGE(opcode1) = (uint8_t) state->X; // LSB
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x87: UnimplementedInstruction(); break;
-		case 0x88: // DEY (Implied) Y - 1 -> Y
-			{
-				_dey();
-			}
-			break;
-		case 0x89: UnimplementedInstruction(); break;
-		case 0x8A: // TXA (Implied) X -> A
-			{
-				uint16_t answer = (uint16_t) state->X;
-				StatusRegisterNegative(answer);
-				StatusRegisterZero(answer);
-				state->A = (uint8_t) answer; // LSB
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x8B: UnimplementedInstruction(); break;
-		case 0x8C: // STY $FFFF (Absolute) A -> M
-			{
-				tABSOLUTE(opcode1, opcode2) = (uint8_t) state->Y; // LSB
-				state->PC = state->PC + 3;
-			}
-			break;
-		case 0x8D: // STA $FFFF (Absolute) A -> M
-			{
-				tABSOLUTE(opcode1, opcode2) = (uint8_t) state->A; // LSB
-				state->PC = state->PC + 3;
-			}
-			break;
-		case 0x8E: // STX $FFFF (Absolute) X -> M
-			{
-				tABSOLUTE(opcode1, opcode2) = (uint8_t) state->X; // LSB
-				state->PC = state->PC + 3;
-			}
-			break;
-		case 0x8F: UnimplementedInstruction(); break;
+// DEC (ZeroPage) M - 1 -> M
+OPCODE(0xC6)
+{
+	_rmw(_dec, aZEROPAGE(opcode1), 2);
+}
+
+OPCODE(0xC7) { UnimplementedInstruction(state); }
+
+// INY (Implied) Y + 1 -> Y
+OPCODE(0xC8)
+{
+	_iny();
+}
+
+// CMP #$FF (Immediate) A - M
+OPCODE(0xC9)
+{
+	_cmp(IMMEDIATE(opcode1), 2);
+}
+
+// DEX (Implied) X - 1 -> X
+OPCODE(0xCA)
+{
+	_dex();
+}
+
+OPCODE(0xCB) { UnimplementedInstruction(state); }
+
+// CPY $FFFF (Absolute) Y - M
+OPCODE(0xCC)
+{
+	_cpy(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// CMP $FFFF (Absolute) A - M
+OPCODE(0xCD)
+{
+	_cmp(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// DEC (Absolute) M - 1 -> M
+OPCODE(0xCE)
+{
+	_rmw(_dec, aABSOLUTE(opcode1, opcode2), 3);
+}
+
+OPCODE(0xCF) { UnimplementedInstruction(state); }
+
+// BNE $FFFF (Relative) Branch on Z = 0
+OPCODE(0xD0)
+{
+	_branch(ZeroFlag == 0, opcode1);
+}
+
+// CMP ($FF),Y (Indirect),Y A - M
+OPCODE(0xD1)
+{
+	PAGE_CROSSING(Peek(state, opcode1) + state->Y);
+	_cmp(INDIRECTY(opcode1), 2);
+}
+
+OPCODE(0xD2) { UnimplementedInstruction(state); }
+OPCODE(0xD3) { UnimplementedInstruction(state); }
+OPCODE(0xD4) { UnimplementedInstruction(state); }
+
+// CMP $FF,X (ZeroPage,X) A - M
+OPCODE(0xD5)
+{
+	_cmp(ZEROPAGEX(opcode1), 2);
+}
+
+// DEC (ZeroPage,X) M - 1 -> M
+OPCODE(0xD6)
+{
+	_rmw(_dec, aZEROPAGEX(opcode1), 2);
+}
+
+OPCODE(0xD7) { UnimplementedInstruction(state); }
+
+// CLD (Implied) 0 -> D
+OPCODE(0xD8)
+{
+	state->sr.D = 0;
+	state->PC = state->PC + 1;
+}
+
+// CMP $FFFF,Y (Absolute,Y) A - M
+OPCODE(0xD9)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_cmp(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+OPCODE(0xDA) { UnimplementedInstruction(state); }
+OPCODE(0xDB) { UnimplementedInstruction(state); }
+OPCODE(0xDC) { UnimplementedInstruction(state); }
+
+// CMP $FFFF,X (Absolute,X) A - M
+OPCODE(0xDD)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_cmp(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// DEC (Absolute,X) M - 1 -> M
+OPCODE(0xDE)
+{
+	_rmw(_dec, aABSOLUTEX(opcode1, opcode2), 3);
+}
+
+OPCODE(0xDF) { UnimplementedInstruction(state); }
+
+// CPX #$FF (Immediate) X - M
+OPCODE(0xE0)
+{
+	_cpx(IMMEDIATE(opcode1), 2);
+}
+
+// SBC ($FF,X) (Indirect,X) A - M + ~C -> A
+OPCODE(0xE1)
+{
+	_sbc(INDIRECTX(opcode1), 2);
+}
+
+OPCODE(0xE2) { UnimplementedInstruction(state); }
+OPCODE(0xE3) { UnimplementedInstruction(state); }
+
+// CPX $FF (Zeropage) X - M
+OPCODE(0xE4)
+{
+	_cpx(ZEROPAGE(opcode1), 2);
+}
+
+// SBC $FF (ZeroPage) A - M + ~C -> A
+OPCODE(0xE5)
+{
+	_sbc(ZEROPAGE(opcode1), 2);
+}
+
+// INC (ZeroPage) M + 1 -> M
+OPCODE(0xE6)
+{
+	_rmw(_inc, aZEROPAGE(opcode1), 2);
+}
+
+OPCODE(0xE7) { UnimplementedInstruction(state); }
+
+// INX (Implied) X + 1 -> X
+OPCODE(0xE8)
+{
+	_inx();
+}
+
+// SBC #$FF (Immediate) A - M + ~C -> A
+OPCODE(0xE9)
+{
+	_sbc(IMMEDIATE(opcode1), 2);
+}
+
+// NOP (Implied)
+OPCODE(0xEA)
+{
+	state->PC = state->PC + 1;
+}
+
+OPCODE(0xEB) { UnimplementedInstruction(state); }
+
+// CPX $FFFF (Absolute) X - M
+OPCODE(0xEC)
+{
+	_cpx(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// SBC $FFFF (Absolute) A - M + ~C -> A
+OPCODE(0xED)
+{
+	_sbc(ABSOLUTE(opcode1, opcode2), 3);
+}
+
+// INC (Absolute) M + 1 -> M
+OPCODE(0xEE)
+{
+	_rmw(_inc, aABSOLUTE(opcode1, opcode2), 3);
+}
+
+OPCODE(0xEF) { UnimplementedInstruction(state); }
+
+// BEQ $FFFF (Relative) Branch on Z = 1
+OPCODE(0xF0)
+{
+	_branch(ZeroFlag == 1, opcode1);
+}
+
+// SBC ($FF),Y ((Indirect),Y) A - M + ~C -> A
+OPCODE(0xF1)
+{
+	PAGE_CROSSING(Peek(state, opcode1) + state->Y);
+	_sbc(INDIRECTY(opcode1), 2);
+}
+
+OPCODE(0xF2) { UnimplementedInstruction(state); }
+OPCODE(0xF3) { UnimplementedInstruction(state); }
+OPCODE(0xF4) { UnimplementedInstruction(state); }
+
+// SBC $FF,X (ZeroPage,X) A - M + ~C -> A
+OPCODE(0xF5)
+{
+	_sbc(ZEROPAGEX(opcode1), 2);
+}
+
+// INC (ZeroPage,X) M + 1 -> M
+OPCODE(0xF6)
+{
+	_rmw(_inc, aZEROPAGEX(opcode1), 2);
+}
+
+OPCODE(0xF7) { UnimplementedInstruction(state); }
+
+// SED (Implied) 1 -> D
+OPCODE(0xF8)
+{
+	state->sr.D = 1;
+	state->PC = state->PC + 1;
+}
+
+// SBC $FFFF,Y (Absolute,Y) A - M + ~C -> A
+OPCODE(0xF9)
+{
+	PAGE_CROSSING(opcode1 + state->Y);
+	_sbc(ABSOLUTEY(opcode1, opcode2), 3);
+}
+
+OPCODE(0xFA) { UnimplementedInstruction(state); }
+OPCODE(0xFB) { UnimplementedInstruction(state); }
+OPCODE(0xFC) { UnimplementedInstruction(state); }
+
+// SBC $FFFF,X (Absolute,X) A - M + ~C -> A
+OPCODE(0xFD)
+{
+	PAGE_CROSSING(opcode1 + state->X);
+	_sbc(ABSOLUTEX(opcode1, opcode2), 3);
+}
+
+// INC (Absolute,X) M + 1 -> M
+OPCODE(0xFE)
+{
+	_rmw(_inc, aABSOLUTEX(opcode1, opcode2), 3);
+}
+
+OPCODE(0xFF) { UnimplementedInstruction(state); }
+
+/*****************************************************************************
+ *** List of all 256 opcodes, X(op) is expanded once for every opcode      ***
+ *****************************************************************************/
+#define OPCODE_LIST(X)																\
+	X(0x00) X(0x01) X(0x02) X(0x03) X(0x04) X(0x05) X(0x06) X(0x07) X(0x08) X(0x09) X(0x0A) X(0x0B) X(0x0C) X(0x0D) X(0x0E) X(0x0F)	\
+	X(0x10) X(0x11) X(0x12) X(0x13) X(0x14) X(0x15) X(0x16) X(0x17) X(0x18) X(0x19) X(0x1A) X(0x1B) X(0x1C) X(0x1D) X(0x1E) X(0x1F)	\
+	X(0x20) X(0x21) X(0x22) X(0x23) X(0x24) X(0x25) X(0x26) X(0x27) X(0x28) X(0x29) X(0x2A) X(0x2B) X(0x2C) X(0x2D) X(0x2E) X(0x2F)	\
+	X(0x30) X(0x31) X(0x32) X(0x33) X(0x34) X(0x35) X(0x36) X(0x37) X(0x38) X(0x39) X(0x3A) X(0x3B) X(0x3C) X(0x3D) X(0x3E) X(0x3F)	\
+	X(0x40) X(0x41) X(0x42) X(0x43) X(0x44) X(0x45) X(0x46) X(0x47) X(0x48) X(0x49) X(0x4A) X(0x4B) X(0x4C) X(0x4D) X(0x4E) X(0x4F)	\
+	X(0x50) X(0x51) X(0x52) X(0x53) X(0x54) X(0x55) X(0x56) X(0x57) X(0x58) X(0x59) X(0x5A) X(0x5B) X(0x5C) X(0x5D) X(0x5E) X(0x5F)	\
+	X(0x60) X(0x61) X(0x62) X(0x63) X(0x64) X(0x65) X(0x66) X(0x67) X(0x68) X(0x69) X(0x6A) X(0x6B) X(0x6C) X(0x6D) X(0x6E) X(0x6F)	\
+	X(0x70) X(0x71) X(0x72) X(0x73) X(0x74) X(0x75) X(0x76) X(0x77) X(0x78) X(0x79) X(0x7A) X(0x7B) X(0x7C) X(0x7D) X(0x7E) X(0x7F)	\
+	X(0x80) X(0x81) X(0x82) X(0x83) X(0x84) X(0x85) X(0x86) X(0x87) X(0x88) X(0x89) X(0x8A) X(0x8B) X(0x8C) X(0x8D) X(0x8E) X(0x8F)	\
+	X(0x90) X(0x91) X(0x92) X(0x93) X(0x94) X(0x95) X(0x96) X(0x97) X(0x98) X(0x99) X(0x9A) X(0x9B) X(0x9C) X(0x9D) X(0x9E) X(0x9F)	\
+	X(0xA0) X(0xA1) X(0xA2) X(0xA3) X(0xA4) X(0xA5) X(0xA6) X(0xA7) X(0xA8) X(0xA9) X(0xAA) X(0xAB) X(0xAC) X(0xAD) X(0xAE) X(0xAF)	\
+	X(0xB0) X(0xB1) X(0xB2) X(0xB3) X(0xB4) X(0xB5) X(0xB6) X(0xB7) X(0xB8) X(0xB9) X(0xBA) X(0xBB) X(0xBC) X(0xBD) X(0xBE) X(0xBF)	\
+	X(0xC0) X(0xC1) X(0xC2) X(0xC3) X(0xC4) X(0xC5) X(0xC6) X(0xC7) X(0xC8) X(0xC9) X(0xCA) X(0xCB) X(0xCC) X(0xCD) X(0xCE) X(0xCF)	\
+	X(0xD0) X(0xD1) X(0xD2) X(0xD3) X(0xD4) X(0xD5) X(0xD6) X(0xD7) X(0xD8) X(0xD9) X(0xDA) X(0xDB) X(0xDC) X(0xDD) X(0xDE) X(0xDF)	\
+	X(0xE0) X(0xE1) X(0xE2) X(0xE3) X(0xE4) X(0xE5) X(0xE6) X(0xE7) X(0xE8) X(0xE9) X(0xEA) X(0xEB) X(0xEC) X(0xED) X(0xEE) X(0xEF)	\
+	X(0xF0) X(0xF1) X(0xF2) X(0xF3) X(0xF4) X(0xF5) X(0xF6) X(0xF7) X(0xF8) X(0xF9) X(0xFA) X(0xFB) X(0xFC) X(0xFD) X(0xFE) X(0xFF)
+
+
+
+/*****************************************************************************
+ *** Machine cycles per opcode                                             ***
+ *** The penalties for page crossing and taken branches are added by the   ***
+ *** opcode handlers (see PAGE_CROSSING and BRANCH)                        ***
+ *** JAM opcodes halt a real 6510, here they count as a 2 cycle NOP        ***
+ *****************************************************************************/
+static const uint8_t Cycles6510[256] =
+{
+/*	 0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F */
+	 7, 6, 2, 8, 3, 3, 5, 5, 3, 2, 2, 2, 4, 4, 6, 6, // 0
+	 2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // 1
+	 6, 6, 2, 8, 3, 3, 5, 5, 4, 2, 2, 2, 4, 4, 6, 6, // 2
+	 2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // 3
+	 6, 6, 2, 8, 3, 3, 5, 5, 3, 2, 2, 2, 3, 4, 6, 6, // 4
+	 2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // 5
+	 6, 6, 2, 8, 3, 3, 5, 5, 4, 2, 2, 2, 5, 4, 6, 6, // 6
+	 2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // 7
+	 2, 6, 2, 6, 3, 3, 3, 3, 2, 2, 2, 2, 4, 4, 4, 4, // 8
+	 2, 6, 2, 6, 4, 4, 4, 4, 2, 5, 2, 5, 5, 5, 5, 5, // 9
+	 2, 6, 2, 6, 3, 3, 3, 3, 2, 2, 2, 2, 4, 4, 4, 4, // A
+	 2, 5, 2, 5, 4, 4, 4, 4, 2, 4, 2, 4, 4, 4, 4, 4, // B
+	 2, 6, 2, 8, 3, 3, 5, 5, 2, 2, 2, 2, 4, 4, 6, 6, // C
+	 2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7, // D
+	 2, 6, 2, 8, 3, 3, 5, 5, 2, 2, 2, 2, 4, 4, 6, 6, // E
+	 2, 5, 2, 8, 4, 4, 6, 6, 2, 4, 2, 7, 4, 4, 7, 7  // F
+};
+
+/*****************************************************************************
+ *** Emulate one instruction at PC (reference implementation)              ***
+ *****************************************************************************/
+#define SWITCH_CASE(op)	case op: Op##op(state, opcode1, opcode2); break;
+
+/*****************************************************************************
+ *** TRACE: One record per instruction, written before it runs             ***
+ *****************************************************************************/
+#if CPU_TRACE
+static void TraceOp(State6510* state, uint8_t opcode0, uint8_t opcode1, uint8_t opcode2)
+{
+	Trace6510* trace = state->trace;
+	TraceRecord6510* record;
+
+	if (trace->head == trace->limit)
+		TraceReserve6510(trace);
+	record = &trace->records[trace->head++ & (TRACE_RECORDS - 1)];
+	record->cycles = state->cycles;
+	record->pc = state->PC;
+	record->sp = state->SP;
+	record->opcode[0] = opcode0;
+	record->opcode[1] = opcode1;
+	record->opcode[2] = opcode2;
+	record->a = state->A;
+	record->x = state->X;
+	record->y = state->Y;
+	record->p = GetStatusRegister6510(state);
+	memset(record->reserved, 0, sizeof(record->reserved));
+}
+#define TRACE_OP(state, opcode0, opcode1, opcode2)							\
+	do { if ((state)->trace != NULL) TraceOp(state, opcode0, opcode1, opcode2); } while (0)
+#else
+#define TRACE_OP(state, opcode0, opcode1, opcode2)	do { } while (0)
+#endif
+
+int Emulate6510Op(State6510* state)
+{
+	uint8_t opcode0 = Peek(state, state->PC);
+	uint8_t opcode1 = Peek(state, state->PC + 1);
+	uint8_t opcode2 = Peek(state, state->PC + 2);
+
+	TRACE_OP(state, opcode0, opcode1, opcode2);
+	PROFILE_OP(state, opcode0);
+	state->cycles += Cycles6510[opcode0];
+	state->instructions++;
+	switch(opcode0)
+	{
+		OPCODE_LIST(SWITCH_CASE)
+		default: break;
+	}
+	return 0;
+}
 
-		case 0x90: // BCC $FFFF (Relative) Branch on C = 0
-			{
-				if (state->sr.C == 0)
-					BRANCH(opcode1);
-				else
-					state->PC = state->PC + 2;
-			}
-			break;
-		case 0x91: // STA ($FF),Y (Indirect),Y A -> M
-			{
-				tINDIRECTY(opcode1) = (uint8_t) state->A; // LSB
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x92: UnimplementedInstruction(); break;
-		case 0x93: UnimplementedInstruction(); break;
-		case 0x94: // STY $FF,X (ZeroPage,X) Y -> M
-			{
-				tZEROPAGEX(opcode1) = (uint8_t) state->Y; // LSB
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x95: // STA $FF,X (ZeroPage,X) A -> M
-			{
-				tZEROPAGEX(opcode1) = (uint8_t)state->A; // LSB
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x96: // STX $FF,Y (ZeroPage,Y) X -> M
-			{
-				tZEROPAGEY(opcode1) = (uint8_t) state->X; // LSB
-				state->PC = state->PC + 2;
-			}
-			break;
-		case 0x97: UnimplementedInstruction(); break;
-		case 0x98: // TYA (Implied) Y -> A
-			{
-				uint16_t answer = (uint16_t) state->Y;
-				StatusRegisterNegative(answer);
-				StatusRegisterZero(answer);
-				state->A = (uint8_t) (answer & 0xff); // LSB
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x99: // STA $FFFF,Y (Absolute,Y) A -> M
-			{
-				tABSOLUTEY(opcode1, opcode2) = (uint8_t) state->A; // LSB
-				state->PC = state->PC + 3;
-			}
-			break;
-		case 0x9A: // TXS (Implied) X -> S
-			{
-				// Transfer index X to Stack Pointer
-				state->SP = (uint8_t)state->X; // LSB
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0x9B: UnimplementedInstruction(); break;
-		case 0x9C: UnimplementedInstruction(); break;
-		case 0x9D: // STA $FFFF,X (Absolute,X) A -> M
-			{
-				tABSOLUTEX(opcode1, opcode2) = (uint8_t) state->A; // LSB
-				state->PC = state->PC + 3;
-			}
-			break;
-		case 0x9E: UnimplementedInstruction(); break;
-		case 0x9F: UnimplementedInstruction(); break;
+#if CPU_DISPATCH == CPU_DISPATCH_TABLE || CPU_BLOCK_CACHE
+#define TABLE_ENTRY(op)	Op##op,
+static const OpHandler6510 OpTable6510[256] = { OPCODE_LIST(TABLE_ENTRY) };
+#endif
 
-		case 0xA0: // LDY #$FF (Immediate) M -> Y
-			{
-				_ldy(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0xA1: // LDA ($FF,X) (Indexed Indirect,X)	M -> A
-			{
-				_lda(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0xA2: // LDX #$FF (Immediate) M -> X
-			{
-				_ldx(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0xA3: UnimplementedInstruction(); break;
-		case 0xA4: // LDY $FF (Zeropage) M -> Y
-			{
-				_ldx(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0xA5: // LDA $FF (Zeropage) M -> A
-			{
-				_lda(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0xA6: // LDX $FF (ZeroPage) M -> X
-			{
-				_ldx(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0xA7: UnimplementedInstruction(); break;
-		case 0xA8: // TAY (Implied) A -> Y
-			{
-				uint16_t answer = (uint16_t) state->A;
-				StatusRegisterNegative(answer);
-				StatusRegisterZero(answer);
-				state->Y = (uint8_t) answer; // LSB
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0xA9: // LDA #$FF (Immediate) M -> A
-			{
-				_lda(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0xAA: // TAX (Implied) A -> X
-			{
-				uint8_t answer = (uint8_t) state->A;
-				StatusRegisterNegative(answer);
-				StatusRegisterZero(answer);
-				state->X = (uint8_t) answer; // LSB
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0xAB: UnimplementedInstruction(); break;
-		case 0xAC: // LDY $FFFF (Absolute) M -> Y
-			{
-				_ldy(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xAD: // LDA $FFFF (Absolute) M -> A
-			{
-				_lda(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xAE: // LDX $FFFF (Absolute) M -> X
-			{
-				_ldx(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xAF: UnimplementedInstruction(); break;
+#if CPU_BLOCK_CACHE
+/*
+  Decodes the block that starts at pc into block. The block stops before
+  an instruction that is (partly) in an I/O page or beyond the page after
+  the first one.
 
-		case 0xB0: // BCS $FFFF (Relative) Branch on C = 1
-			{
-				if (state->sr.C == 1)
-					state->PC = BRANCH(opcode1);
-				else
-					state->PC = state->PC + 2;
-			}
-			break;
-		case 0xB1: // LDA ($FF),Y (Indirect Indexed),Y	M -> A
-			{
-				_lda(INDIRECTY(opcode1), 2);
-			}
-			break;
-		case 0xB2: UnimplementedInstruction(); break;
-		case 0xB3: UnimplementedInstruction(); break;
-		case 0xB4: // LDY $FF,X (Zeropage,X) M -> Y
-			{
-				_ldy(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0xB5: // LDA $FF,X (Zeropage,X) M -> A
-			{
-				_lda(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0xB6: // LDX $FF,Y (ZeroPage,Y) M -> X
-			{
-				_ldx(ZEROPAGEY(opcode1), 2);
-			}
-			break;
-		case 0xB7: UnimplementedInstruction(); break;
-		case 0xB8: // CLV (Implied) 0 -> V
-			{
-				state->sr.V = 0;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0xB9: // LDA $FFFF,Y (Absolute,Y) M -> A
-			{
-				_lda(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xBA: // TSX (Implied) S -> X
-			{
-				// Transfer Stack Pointer to index X
-				uint16_t answer = (uint16_t) state->SP;
-				StatusRegisterNegative(answer);
-				StatusRegisterZero(answer);
-				state->X = (uint8_t) answer; // LSB
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0xBB: UnimplementedInstruction(state); break;
-		case 0xBC: // LDY $FFFF,X (Absolute,X) M -> Y
-			{
-				_ldy(ABSOLUTEX(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xBD: // LDA $FFFF,X (Absolute,X) M -> A
-			{
-				_lda(ABSOLUTEX(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xBE: // LDX $FFFF,Y (Absolute,Y) M -> X
-			{
-				_ldx(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xBF: UnimplementedInstruction(); break;
+  returns 0 when not even the first instruction can be cached
+*/
+static int DecodeBlock(State6510* state, Block6510* block, uint16_t pc)
+{
+	BlockCache6510* cache = state->blocks;
+	uint8_t first_page = pc >> 8;
+	uint16_t address = pc;
+
+	block->valid = 0;
+	block->count = 0;
+	block->runs = 0;
+	block->code = NULL;
+	while (block->count < BLOCK_MAX_OPS)
+	{
+		DecodedOp6510* op = &block->ops[block->count];
+		const uint8_t* page = state->readmap[address >> 8];
+		uint8_t opcode0, length, flow;
+		uint16_t last;
 
-		case 0xC0: // CPY #$FF (Immediate) Y - M
-			{
-				_cpy(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0xC1: // CMP ($FF,X) (Indirect,X) A - M
-			{
-				_cmp(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0xC2: UnimplementedInstruction(); break;
-		case 0xC3: UnimplementedInstruction(); break;
-		case 0xC4: // CPY $FF (Zeropage) Y - M
-			{
-				_cpy(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0xC5: // CMP $FF (Zeropage) A - M
-			{
-				_cmp(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0xC6: // DEC (ZeroPage) M - 1 -> M
-			{
-				_dec(ZEROPAGE(opcode1), 2, tZEROPAGE(opcode1));
-			}
-			break;
-		case 0xC7: UnimplementedInstruction(); break;
-		case 0xC8: // INY (Implied) Y + 1 -> Y
-			{
-				_iny();
-			}
-			break;
-		case 0xC9: // CMP #$FF (Immediate) A - M
-			{
-				_cmp(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0xCA: // DEX (Implied) X - 1 -> X
-			{
-				_dex();
-			}
-			break;
-		case 0xCB: UnimplementedInstruction(); break;
-		case 0xCC: // CPY $FFFF (Absolute) Y - M
-			{
-				_cpy(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xCD: // CMP $FFFF (Absolute) A - M
-			{
-				_cmp(ABSOLUTE(opcode1, opcode2), 3);
-			}
+		if (page == NULL)
 			break;
-		case 0xCE: // DEC (Absolute) M - 1 -> M
-			{
-				_dec(ABSOLUTE(opcode1, opcode2), 3, tABSOLUTE(opcode1, opcode2));
-			}
+		opcode0 = page[address & 0xFF];
+		flow = Flow6510[opcode0];
+		length = flow == FLOW_UNIMPL ? 1 : ModeLength6510[AddrMode6510[opcode0]];
+		last = address + length - 1;
+		if ((uint8_t)((last >> 8) - first_page) > 1 || state->readmap[last >> 8] == NULL)
 			break;
-		case 0xCF: UnimplementedInstruction(); break;
 
-		case 0xD0: // BNE $FFFF (Relative) Branch on Z = 0
-			{
-				if (state->sr.Z == 0)
-					state->PC = BRANCH(opcode1);
-				else
-					state->PC = state->PC + 2;
-			}
-			break;
-		case 0xD1: // CMP ($FF),Y (Indirect),Y A - M
-			{
-				_cmp(INDIRECTY(opcode1), 2);
-			}
-			break;
-		case 0xD2: UnimplementedInstruction(); break;
-		case 0xD3: UnimplementedInstruction(); break;
-		case 0xD4: UnimplementedInstruction(); break;
-		case 0xD5: // CMP $FF,X (ZeroPage,X) A - M
-			{
-				_cmp(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0xD6: // DEC (ZeroPage,X) M - 1 -> M
-			{
-				_dec(ZEROPAGEX(opcode1), 2, tZEROPAGEX(opcode1));
-			}
-			break;
-		case 0xD7: UnimplementedInstruction(); break;
-		case 0xD8: // CLD (Implied) 0 -> D
-			{
-				state->sr.D = 0;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0xD9: // CMP $FFFF,Y (Absolute,Y) A - M
-			{
-				_cmp(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xDA: UnimplementedInstruction(); break;
-		case 0xDB: UnimplementedInstruction(); break;
-		case 0xDC: UnimplementedInstruction(); break;
-		case 0xDD: // CMP $FFFF,X (Absolute,X) A - M
-			{
-				_cmp(ABSOLUTEX(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xDE: // DEC (Absolute,X) M - 1 -> M
-			{
-				_dec(ABSOLUTEX(opcode1, opcode2), 3, tABSOLUTEX(opcode1, opcode2));
-			}
-			break;
-		case 0xDF: UnimplementedInstruction(); break;
+		op->handler = OpTable6510[opcode0];
+		op->opcode0 = opcode0;
+		op->opcode1 = length > 1 ? Peek(state, address + 1) : 0;
+		op->opcode2 = length > 2 ? Peek(state, address + 2) : 0;
+		op->mode = AddrMode6510[opcode0];
+		op->length = length;
+		op->cycles = Cycles6510[opcode0];
+		block->count++;
 
-		case 0xE0: // CPX #$FF (Immediate) X - M
-			{
-				_cpx(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0xE1: // SBC ($FF,X) (Indirect,X) A - M + ~C -> A
-			{
-				_sbc(INDIRECTX(opcode1), 2);
-			}
-			break;
-		case 0xE2: UnimplementedInstruction(); break;
-		case 0xE3: UnimplementedInstruction(); break;
-		case 0xE4: // CPX $FF (Zeropage) X - M
-			{
-				_cpx(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0xE5: // SBC $FF (ZeroPage) A - M + ~C -> A
-			{
-				_sbc(ZEROPAGE(opcode1), 2);
-			}
-			break;
-		case 0xE6: // INC (ZeroPage) M + 1 -> M
-			{
-				_inc(ZEROPAGE(opcode1), 2, tZEROPAGE(opcode1));
-			}
-			break;
-		case 0xE7: UnimplementedInstruction(); break;
-		case 0xE8: // INX (Implied) X + 1 -> X
-			{
-				_inx();
-			}
-			break;
-		case 0xE9: // SBC #$FF (Immediate) A - M + ~C -> A
-			{
-				_sbc(IMMEDIATE(opcode1), 2);
-			}
-			break;
-		case 0xEA: // NOP (Implied)
-			{
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0xEB: UnimplementedInstruction(); break;
-		case 0xEC: // CPX $FFFF (Absolute) X - M
-			{
-				_cpx(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xED: // SBC $FFFF (Absolute) A - M + ~C -> A
-			{
-				_sbc(ABSOLUTE(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xEE: // INC (Absolute) M + 1 -> M
+		for (int i = 0; i < length; i++)
+		{
+			uint16_t byte = address + i;
+
+			cache->code[byte >> 3] |= 1 << (byte & 7);
+			if (!cache->codepage[byte >> 8])
 			{
-				_inc(ABSOLUTE(opcode1, opcode2), 3, tABSOLUTE(opcode1, opcode2));
+				cache->codepage[byte >> 8] = 1;
+				state->writemap[byte >> 8] = NULL;
 			}
+		}
+		address += length;
+		if (flow != FLOW_NEXT)
 			break;
-		case 0xEF: UnimplementedInstruction(); break;
+	}
+	if (block->count == 0)
+		return 0;
+	block->pc = pc;
+	block->end = address;
+	block->valid = 1;
+	return 1;
+}
+
+/*
+  returns the block at pc, decoded if it was not in the cache yet, or
+  NULL when the code at pc can not be cached
+*/
+static INLINE Block6510* LookupBlock(State6510* state, uint16_t pc)
+{
+	BlockCache6510* cache = state->blocks;
+	Block6510* block = &cache->blocks[pc & (BLOCK_CACHE_ENTRIES - 1)];
+
+	if (block->valid && block->pc == pc)
+	{
+		cache->stats.hits++;
+		return block;
+	}
+	cache->stats.misses++;
+	return DecodeBlock(state, block, pc) ? block : NULL;
+}
+
+/*
+  Runs the instructions of a block through their handlers. Leaves the block
+  early when the budget is used up or when one of its instructions wrote
+  into cached code.
+*/
+static INLINE void RunDecodedBlock(State6510* state, const Block6510* block)
+{
+	uint32_t epoch = state->blocks->epoch;
+	const DecodedOp6510* op = block->ops;
+	const DecodedOp6510* end = op + block->count;
+
+	do
+	{
+		TRACE_OP(state, op->opcode0, op->opcode1, op->opcode2);
+		PROFILE_OP(state, op->opcode0);
+		state->cycles += op->cycles;
+		state->instructions++;
+		op->handler(state, op->opcode1, op->opcode2);
+	}
+	while (++op < end && state->cycles < state->run_until && state->blocks->epoch == epoch);
+}
+#endif
+
+#if CPU_DISPATCH == CPU_DISPATCH_JIT
+/*
+  Runs the block at PC, as native code once it has run threshold times.
+  Code that can not be cached and a full arena fall back to one
+  instruction of Emulate6510Op (a full arena is emptied first).
+*/
+static void RunJitBlock(State6510* state, uint32_t threshold)
+{
+	Block6510* block = LookupBlock(state, state->PC);
+
+	if (block == NULL)
+	{
+		Emulate6510Op(state);
+		return;
+	}
+	if (block->code == NULL && !state->blocks->jit_failed && ++block->runs >= threshold
+		&& JitCompileBlock(state, block) != 0)
+	{
+		C64_UpdateMemoryMap(state);
+		Emulate6510Op(state);
+		return;
+	}
+	// Native code does not write trace records or profile counters
+	if (block->code != NULL && state->trace == NULL && state->profile == NULL)
+		block->code(state);
+	else
+		RunDecodedBlock(state, block);
+}
+
+/*****************************************************************************
+ *** JIT CHECK: Differential test of the JIT against Emulate6510Op         ***
+ ***                                                                       ***
+ *** Every instruction runs twice: as translated code (compiled on first   ***
+ *** use) in the machine and through Emulate6510Op in a copy of it. The    ***
+ *** registers, flags and cycles are compared after every instruction, the ***
+ *** memory every JIT_CHECK_MEMORY instructions and at the end. The first  ***
+ *** difference is printed and halts the machine. Handlers on I/O pages    ***
+ *** would see every access twice, so this is for plain CPU code.          ***
+ *****************************************************************************/
+#define JIT_CHECK_MEMORY	1024
+
+static void PrintMachine6510(const char* name, State6510* state)
+{
+	printf("%-11s PC=$%04X A=$%02X X=$%02X Y=$%02X SP=$%04X SR=$%02X cycles=%llu%s\n",
+		name, state->PC, state->A, state->X, state->Y, state->SP, GetStatusRegister6510(state),
+		(unsigned long long)state->cycles, state->halted ? " halted" : "");
+}
+
+static void JitCheckStep(State6510* state)
+{
+	State6510* shadow = state->blocks->jit_check;
+	uint64_t run_until = state->run_until;
+	uint64_t step = state->cycles + 1;
+	uint16_t pc = state->PC;
+	int memory;
+
+	// Every instruction takes at least 2 cycles, so this stops after one.
+	// An instruction that ends the run itself (BRK, CLI) keeps its stop.
+	state->run_until = step;
+	RunJitBlock(state, 1);
+	if (state->run_until == step || state->run_until > run_until)
+		state->run_until = run_until;
+	Emulate6510Op(shadow);
+	state->blocks->stats.checked++;
+
+	memory = state->halted || state->blocks->stats.checked % JIT_CHECK_MEMORY == 0;
+	if (state->PC != shadow->PC || state->A != shadow->A || state->X != shadow->X ||
+		state->Y != shadow->Y || state->SP != shadow->SP || state->cycles != shadow->cycles ||
+		state->halted != shadow->halted || GetStatusRegister6510(state) != GetStatusRegister6510(shadow) ||
+		(memory && memcmp(state->memory, shadow->memory, 0x10000) != 0))
+	{
+		printf("JIT check: difference after the instruction at $%04X\n", pc);
+		PrintMachine6510("jit", state);
+		PrintMachine6510("interpreter", shadow);
+		state->halted = 1;
+		state->run_until = state->cycles;
+	}
+}
+#endif
+
+/*****************************************************************************
+ *** Start the differential check of the JIT (see JIT CHECK) on a machine  ***
+ *** that has its program loaded.                                          ***
+ ***                                                                       ***
+ *** returns 0 when the check runs, 1 if this is not a CPU_DISPATCH_JIT    ***
+ *** build or memory ran out                                               ***
+ *****************************************************************************/
+int EnableJitCheck6510(State6510* state)
+{
+#if CPU_DISPATCH == CPU_DISPATCH_JIT
+	State6510* shadow = state->blocks->jit_check;
+	uint8_t* memory;
+	BlockCache6510* blocks;
+
+	if (shadow == NULL)
+		shadow = C64_AllocateMemory(state->rom);
+	if (shadow == NULL)
+		return 1;
+	C64_OwnMemory(state);
+	memory = shadow->memory;
+	blocks = shadow->blocks;
+	*shadow = *state;
+	shadow->memory = memory;
+	shadow->blocks = blocks;
+	shadow->trace = NULL;
+	shadow->profile = NULL;
+	memcpy(shadow->memory, state->memory, 0x10000);
+	C64_UpdateMemoryMap(shadow);
+	state->blocks->jit_check = shadow;
+	return 0;
+#else
+	(void)state;
+	return 1;
+#endif
+}
+
+/*****************************************************************************
+ *** Block cache counters, all zero when the engine has no block cache     ***
+ *****************************************************************************/
+void GetBlockCacheStats6510(State6510* state, BlockCacheStats6510* stats)
+{
+	if (state->blocks != NULL)
+		*stats = state->blocks->stats;
+	else
+		memset(stats, 0, sizeof(*stats));
+}
+
+/*****************************************************************************
+ *** EVENTS: The queue of cycles at which devices act, see 6502.h          ***
+ *****************************************************************************/
+static void PlaceEvent(EventQueue6510* queue, int index, uint8_t event)
+{
+	queue->heap[index] = event;
+	queue->position[event] = (uint8_t)(index + 1);
+}
+
+/*
+  Moves the event at index up or down the heap to its place
+*/
+static void SiftEvent(EventQueue6510* queue, int index)
+{
+	uint8_t event = queue->heap[index];
+	uint64_t cycle = queue->cycle[event];
 
-		case 0xF0: // BEQ $FFFF (Relative) Branch on Z = 1
-			{
-				if (state->sr.Z == 1)
-					state->PC = BRANCH(opcode1);
-				else
-					state->PC = state->PC + 2;
-			}
-			break;
-		case 0xF1: // SBC ($FF),Y ((Indirect),Y) A - M + ~C -> A
-			{
-				_sbc(INDIRECTY(opcode1), 2);
-			}
-			break;
-		case 0xF2: UnimplementedInstruction(); break;
-		case 0xF3: UnimplementedInstruction(); break;
-		case 0xF4: UnimplementedInstruction(); break;
-		case 0xF5: // SBC $FF,X (ZeroPage,X) A - M + ~C -> A
-			{
-				_sbc(ZEROPAGEX(opcode1), 2);
-			}
-			break;
-		case 0xF6: // INC (ZeroPage,X) M + 1 -> M
-			{
-				_inc(ZEROPAGEX(opcode1), 2, tZEROPAGEX(opcode1));
-			}
-			break;
-		case 0xF7: UnimplementedInstruction(); break;
-		case 0xF8: // SED (Implied) 1 -> D
-			{
-				state->sr.D = 1;
-				state->PC = state->PC + 1;
-			}
-			break;
-		case 0xF9: // SBC $FFFF,Y (Absolute,Y) A - M + ~C -> A
-			{
-				_sbc(ABSOLUTEY(opcode1, opcode2), 3);
-			}
-			break;
-		case 0xFA: UnimplementedInstruction(); break;
-		case 0xFB: UnimplementedInstruction(); break;
-		case 0xFC: UnimplementedInstruction(); break;
-		case 0xFD: // SBC $FFFF,X (Absolute,X) A - M + ~C -> A
-			{
-				_sbc(ABSOLUTEX(opcode1, opcode2), 3);
-			}
+	while (index > 0 && queue->cycle[queue->heap[(index - 1) / 2]] > cycle)
+	{
+		PlaceEvent(queue, index, queue->heap[(index - 1) / 2]);
+		index = (index - 1) / 2;
+	}
+	for (;;)
+	{
+		int child = 2 * index + 1;
+
+		if (child >= queue->count)
 			break;
-		case 0xFE: // INC (Absolute,X) M + 1 -> M
-			{
-				_inc(ABSOLUTEX(opcode1, opcode2), 3, tABSOLUTEX(opcode1, opcode2));
-			}
+		if (child + 1 < queue->count && queue->cycle[queue->heap[child + 1]] < queue->cycle[queue->heap[child]])
+			child++;
+		if (queue->cycle[queue->heap[child]] >= cycle)
 			break;
-		case 0xFF: UnimplementedInstruction(); break;
-		default: break;
+		PlaceEvent(queue, index, queue->heap[child]);
+		index = child;
 	}
-	//printf("\t");
-	//printf("%c", state->sr.N ? 'N' : 'n');
-	//printf("%c", state->sr.V ? 'V' : 'v');
-	//printf("%c", state->sr.dc ? '_' : '0');
-	//printf("%c", state->sr.B ? 'B' : 'b');
-	//printf("%c", state->sr.D ? 'D' : 'd');
-	//printf("%c", state->sr.I ? 'I' : 'i');
-	//printf("%c", state->sr.Z ? 'Z' : 'z');
-	//printf("%c ", state->sr.C ? 'C' : 'c');
-	//printf("A=$%02X,X=$%02X,Y=$%02X,SP=$%04X,SR=$%02X,PC=$%04X\n", state->A, state->X, state->Y, state->SP, state->sr, state->PC);
-	return 0;
+	PlaceEvent(queue, index, event);
 }
 
-/*****************************************************************************
-  Load the following Commodore C64 ROM:
-    BASIC.ROM
-	KERNAL.ROM
-	CHAR.ROM
+/*
+  Schedules event at cycle, or moves it there when it is already
+  scheduled. A cycle that has passed runs the handler at once.
+*/
+void C64_ScheduleEvent(State6510* state, int event, uint64_t cycle, EventHandler6510 handler)
+{
+	EventQueue6510* queue = &state->events;
+
+	queue->cycle[event] = cycle;
+	queue->handler[event] = handler;
+	if (queue->position[event] == 0)
+		PlaceEvent(queue, queue->count++, (uint8_t)event);
+	SiftEvent(queue, queue->position[event] - 1);
+	// Called from a handler inside Run6510: stop the engine in time
+	if (cycle < state->run_until)
+		state->run_until = cycle;
+}
 
-  Returns error if a ROM is not found.
-******************************************************************************/
-uint8_t C64_LoadROM()
+void C64_CancelEvent(State6510* state, int event)
 {
-	FILE *f;
+	EventQueue6510* queue = &state->events;
+	int index = queue->position[event] - 1;
 
-	if ((f=fopen("./rom/basic.rom", "rb")) != NULL)
+	if (index < 0)
+		return;
+	queue->position[event] = 0;
+	if (index < --queue->count)
 	{
-		fread(pBasicROM, 8192, 1, f);
-		fclose(f);
+		PlaceEvent(queue, index, queue->heap[queue->count]);
+		SiftEvent(queue, index);
 	}
+}
+
+/*
+  Pulls (pull = 1) or releases the IRQ line for one source (a bit)
+*/
+void C64_SetIRQ(State6510* state, uint8_t source, int pull)
+{
+	if (pull)
+		state->irq |= source;
 	else
+		state->irq &= ~source;
+	IRQ_CHECK();
+}
+
+void C64_SetNMI(State6510* state, uint8_t source, int pull)
+{
+	uint8_t nmi = state->nmi;
+
+	state->nmi = pull ? (nmi | source) : (nmi & ~source);
+	if (nmi == 0 && state->nmi != 0)
 	{
-		printf("error: Couldn't open BASIC.ROM\n");
-		return 1;
+		state->nmi_pending = 1;
+		state->run_until = state->cycles;
 	}
+}
+
+/*
+  IRQ and NMI: PC and P (with B clear) to the stack, I set, PC from the
+  vector. 7 cycles, like BRK.
+*/
+static void Interrupt6510(State6510* state, uint16_t vector)
+{
+	Poke(state, aSTACK(0), (state->PC >> 8) & 0xFF);
+	Poke(state, aSTACK(-1), state->PC & 0xFF);
+	Poke(state, aSTACK(-2), GetStatusRegister6510(state) & ~0x10);
+	SP_ADD(-3);
+	state->sr.I = 1;
+	state->PC = Peek(state, vector) | (Peek(state, vector + 1) << 8);
+	state->cycles += 7;
+	PROFILE_CALL(state, 3);
+}
+
+/*
+  Runs the handlers of the events that are due and takes a pending
+  interrupt, NMI first
+*/
+static void RunEvents(State6510* state)
+{
+	EventQueue6510* queue = &state->events;
 
-	if ((f=fopen("./rom/kernal.rom", "rb")) != NULL)
+	while (queue->count > 0 && queue->cycle[queue->heap[0]] <= state->cycles)
 	{
-		fread(pKernalROM, 8192, 1, f);
-		fclose(f);
+		uint8_t event = queue->heap[0];
+
+		C64_CancelEvent(state, event);
+		queue->handler[event](state, event, queue->cycle[event]);
 	}
-	else
+	if (state->nmi_pending)
 	{
-		printf("error: Couldn't open KERNAL.ROM\n");
-		return 1;
+		state->nmi_pending = 0;
+		Interrupt6510(state, 0xFFFA);
+	}
+	else if (state->irq != 0 && !state->sr.I && state->cycles >= state->irq_from)
+		Interrupt6510(state, 0xFFFE);
+}
+
+/*
+  The engine: runs instructions until state->cycles reaches
+  state->run_until
+*/
+static void RunEngine(State6510* state)
+{
+#if CPU_DISPATCH == CPU_DISPATCH_THREADED
+	#define THREADED_LABEL(op)	&&Label##op,
+	#define THREADED_OP(op)		Label##op: Op##op(state, opcode1, opcode2); DISPATCH();
+	#define DISPATCH()															\
+	do {																		\
+		if (state->cycles >= state->run_until)									\
+			goto done;															\
+		opcode0 = Peek(state, state->PC);												\
+		opcode1 = Peek(state, state->PC + 1);											\
+		opcode2 = Peek(state, state->PC + 2);											\
+		TRACE_OP(state, opcode0, opcode1, opcode2);								\
+		PROFILE_OP(state, opcode0);												\
+		state->cycles += Cycles6510[opcode0];									\
+		state->instructions++;													\
+		goto *DispatchTable[opcode0];											\
+	}																			\
+	while (0)
+
+	static void* const DispatchTable[256] = { OPCODE_LIST(THREADED_LABEL) };
+	uint8_t opcode0, opcode1, opcode2;
+
+	// Every handler ends with its own copy of DISPATCH, this gives the
+	// branch predictor one indirect jump per opcode instead of a single one
+	DISPATCH();
+	OPCODE_LIST(THREADED_OP)
+done:
+	return;
+	#undef DISPATCH
+#elif CPU_DISPATCH == CPU_DISPATCH_TABLE
+	while (state->cycles < state->run_until)
+	{
+		uint8_t opcode0 = Peek(state, state->PC);
+		uint8_t opcode1 = Peek(state, state->PC + 1);
+		uint8_t opcode2 = Peek(state, state->PC + 2);
+
+		TRACE_OP(state, opcode0, opcode1, opcode2);
+		PROFILE_OP(state, opcode0);
+		state->cycles += Cycles6510[opcode0];
+		state->instructions++;
+		OpTable6510[opcode0](state, opcode1, opcode2);
+	}
+#elif CPU_BLOCK_CACHE
+#if CPU_DISPATCH == CPU_DISPATCH_JIT
+	while (state->cycles < state->run_until)
+	{
+		if (state->blocks->jit_check != NULL)
+			JitCheckStep(state);
+		else
+			RunJitBlock(state, JIT_THRESHOLD);
 	}
+#else
+	while (state->cycles < state->run_until)
+	{
+		Block6510* block = LookupBlock(state, state->PC);
+
+		if (block != NULL)
+			RunDecodedBlock(state, block);
+		else
+			Emulate6510Op(state);
+	}
+#endif
+#else
+	while (state->cycles < state->run_until)
+		Emulate6510Op(state);
+#endif
+}
+
+/*
+  The engine of RunReference6510
+*/
+static void RunReferenceEngine(State6510* state)
+{
+	while (state->cycles < state->run_until)
+		Emulate6510Op(state);
+}
+
+/*
+  Runs the events that are due, then engine up to the next one, until
+  the budget is used up
+*/
+static INLINE int RunMachine(State6510* state, int cycle_budget, void (*engine)(State6510*))
+{
+	EventQueue6510* queue = &state->events;
+	uint64_t start = state->cycles;
+	uint64_t end = start + cycle_budget;
 
-	if ((f=fopen("./rom/char.rom", "rb")) != NULL)
+	while (state->cycles < end && !state->halted)
 	{
-		fread(pCharROM, 4096, 1, f);
-		fclose(f);
+		RunEvents(state);
+		state->run_until = end;
+		if (queue->count > 0 && queue->cycle[queue->heap[0]] < end)
+			state->run_until = queue->cycle[queue->heap[0]];
+		// An IRQ that CLI or PLP held back is taken after the next instruction
+		if (state->irq != 0 && !state->sr.I && state->irq_from < state->run_until)
+			state->run_until = state->irq_from;
+		engine(state);
 	}
-	else
+#if CPU_TRACE
+	if (state->trace != NULL)
+		TracePublish6510(state->trace);
+#endif
+	return (int)(state->cycles - start);
+}
+
+/*****************************************************************************
+ *** RUN: Execute instructions until the cycle budget is used up           ***
+ ***                                                                       ***
+ *** Stays inside the dispatch loop instead of returning to main after     ***
+ *** every instruction. The engine is chosen at build time with            ***
+ *** CPU_DISPATCH:                                                         ***
+ ***   CPU_DISPATCH_SWITCH   = Emulate6510Op per instruction               ***
+ ***   CPU_DISPATCH_TABLE    = call through a table of opcode handlers     ***
+ ***   CPU_DISPATCH_THREADED = threaded code with computed goto (GCC/Clang)***
+ ***   CPU_DISPATCH_BLOCKS   = predecoded basic blocks, see BLOCK CACHE    ***
+ ***   CPU_DISPATCH_JIT      = blocks translated to x86-64 code, see jit.c   ***
+ ***                                                                       ***
+ *** The engine runs up to the next event, then Run6510 handles the        ***
+ *** events that are due and a pending interrupt, see EVENTS.              ***
+ ***                                                                       ***
+ *** The last instruction is always completed, so the cycles consumed can ***
+ *** be a few more than cycle_budget. state->cycles keeps the total.       ***
+ *** An instruction can end the run of the engine early by setting         ***
+ *** state->run_until to state->cycles (BRK does this when it halts the    ***
+ *** machine, see halt_on_brk, an instruction that lets an IRQ in does it  ***
+ *** too).                                                                 ***
+ ***                                                                       ***
+ *** returns the number of cycles consumed, penalties included            ***
+ *****************************************************************************/
+int Run6510(State6510* state, int cycle_budget)
+{
+	return RunMachine(state, cycle_budget, RunEngine);
+}
+
+/*
+  Run6510 with Emulate6510Op for the engine, whatever CPU_DISPATCH is. The
+  events and interrupts run at the same points as in Run6510, so given the
+  same budgets both end in the same state. The reference of lockstep.
+*/
+int RunReference6510(State6510* state, int cycle_budget)
+{
+	return RunMachine(state, cycle_budget, RunReferenceEngine);
+}
+
+/*****************************************************************************
+ *** SNAPSHOTS                                                             ***
+ ***                                                                       ***
+ *** A snapshot is a copy of a machine: the State6510 (registers, flags,   ***
+ *** cycles, bank configuration, handlers and any device state kept in the ***
+ *** struct) and its 64K of RAM. It is never changed after C64_Snapshot,   ***
+ *** so any number of threads can restore from it at the same time.        ***
+ ***                                                                       ***
+ *** Restoring does not copy the RAM. The pages of the machine point into  ***
+ *** the snapshot (state->cow) and stay off the Poke fast path; the first  ***
+ *** write to a page copies it (OwnPage). Zero page, stack and I/O are     ***
+ *** copied right away, they are written almost at once anyway. A machine  ***
+ *** restored from a snapshot reads from it, so free the snapshot last.    ***
+ *****************************************************************************/
+struct Snapshot6510 {
+	State6510 machine;
+	uint8_t   memory[0x10000];
+};
+
+Snapshot6510* C64_Snapshot(State6510* state)
+{
+	Snapshot6510* snapshot = (Snapshot6510*)malloc(sizeof(Snapshot6510));
+
+	if (snapshot == NULL)
+		return NULL;
+	snapshot->machine = *state;
+	snapshot->machine.memory = NULL;
+	snapshot->machine.blocks = NULL;
+	snapshot->machine.trace = NULL;
+	snapshot->machine.profile = NULL;
+	snapshot->machine.screen = NULL;
+	memset(snapshot->machine.screenpage, 0, sizeof(snapshot->machine.screenpage));
+	for (int page = 0x00; page <= 0xFF; page++)
 	{
-		printf("error: Couldn't open CHAR.ROM\n");
-		return 1;
+		const uint8_t* ram = state->cow[page] != NULL ? state->cow[page] : state->memory + (page << 8);
+
+		memcpy(snapshot->memory + (page << 8), ram, 0x100);
+	}
+	return snapshot;
+}
+
+void C64_Restore(State6510* state, const Snapshot6510* snapshot)
+{
+	uint8_t* memory = state->memory;
+	BlockCache6510* blocks = state->blocks;
+	Trace6510* trace = state->trace;
+	Profile6510* profile = state->profile;
+	Screen6569* screen = state->screen;
+	int page;
+
+	*state = snapshot->machine;
+	state->memory = memory;
+	state->blocks = blocks;
+	state->trace = trace;
+	state->profile = profile;
+	state->screen = screen;
+	for (page = 0x00; page <= 0xFF; page++)
+		state->cow[page] = snapshot->memory + (page << 8);
+
+	// Zero page (with the processor port), stack and I/O
+	memcpy(state->memory, snapshot->memory, 0x200);
+	memcpy(state->memory + 0xD000, snapshot->memory + 0xD000, 0x1000);
+	state->cow[0x00] = state->cow[0x01] = NULL;
+	for (page = 0xD0; page <= 0xDF; page++)
+		state->cow[page] = NULL;
+
+	C64_UpdateMemoryMap(state);
+	// All of the RAM changed under the screen
+	C64_RedrawScreen(state);
+}
+
+/*
+  A new machine restored from the snapshot, NULL when out of memory
+*/
+State6510* C64_Fork(const Snapshot6510* snapshot)
+{
+	State6510* state = C64_AllocateMemory(snapshot->machine.rom);
+
+	if (state != NULL)
+		C64_Restore(state, snapshot);
+	return state;
+}
+
+void C64_FreeSnapshot(Snapshot6510* snapshot)
+{
+	free(snapshot);
+}
+
+/*
+  Copies the pages still shared with a snapshot, after this state->memory
+  holds all the RAM. Needed before reading state->memory directly.
+*/
+void C64_OwnMemory(State6510* state)
+{
+	for (int page = 0x00; page <= 0xFF; page++)
+		if (state->cow[page] != NULL)
+			OwnPage(state, (uint8_t)page);
+}
+
+/*
+  C64_OwnMemory for the pages of size bytes from address, for a write of
+  that many bytes straight into state->memory. The screen is redrawn when
+  it is rendered from one of them.
+*/
+void C64_OwnMemoryRange(State6510* state, uint16_t address, uint32_t size)
+{
+	if (size == 0)
+		return;
+	for (uint32_t page = address >> 8; page <= (address + size - 1) >> 8 && page <= 0xFF; page++)
+	{
+		if (state->cow[page] != NULL)
+			OwnPage(state, (uint8_t)page);
+		if (state->screenpage[page])
+			C64_RedrawScreen(state);
 	}
+}
+
+/*****************************************************************************
+  Allocates an empty ROM set, see C64_LoadROM
+******************************************************************************/
+C64ROMSet* C64_AllocateROM(void)
+{
+	return (C64ROMSet*)calloc(1, sizeof(C64ROMSet));
+}
+
+static void UnmapROM(C64ROMSet* rom)
+{
+	if (!rom->mapped)
+		return;
+	UnmapFile(rom->pBasicROM, 8192);
+	UnmapFile(rom->pKernalROM, 8192);
+	UnmapFile(rom->pCharROM, 4096);
+	rom->pBasicROM = rom->pKernalROM = rom->pCharROM = NULL;
+	rom->mapped = 0;
+}
+
+void C64_FreeROM(C64ROMSet* rom)
+{
+	if (rom == NULL)
+		return;
+	UnmapROM(rom);
+	free(rom);
+}
 
+/*****************************************************************************
+  Load the following Commodore C64 ROM:
+    BASIC.ROM
+	KERNAL.ROM
+	CHAR.ROM
+
+  The images built into the program, nothing is read. When C64_ROMS is
+  set they are mapped from that directory (C64_MapROM).
+
+  Returns error if a ROM is not found.
+******************************************************************************/
+uint8_t C64_LoadROM(C64ROMSet* rom)
+{
+	const char* directory = getenv(C64_ROM_VARIABLE);
+
+	if (directory != NULL && *directory != '\0')
+		return C64_MapROM(rom, directory);
+	UnmapROM(rom);
+	rom->pBasicROM = BasicROM6510;
+	rom->pKernalROM = KernalROM6510;
+	rom->pCharROM = CharROM6510;
 	return 0;
 }
 
-void ReadFileIntoMemoryAt(State6510* state, char* filename, uint16_t offset)
+/*****************************************************************************
+  Maps basic.rom, kernal.rom and char.rom from a directory, read only.
+  All machines and processes using the files share their pages.
+
+  Returns error if a ROM is not found or too short.
+******************************************************************************/
+uint8_t C64_MapROM(C64ROMSet* rom, const char* directory)
 {
-	FILE *f;
-	int fsize;
-	uint8_t *buffer;
-//	uint8_t *new_buffer;
+	static const char* names[3] = { "basic.rom", "kernal.rom", "char.rom" };
+	static const size_t sizes[3] = { 8192, 8192, 4096 };
+	const void* images[3];
+	char filename[1024];
 
-	f = fopen(filename, "rb");
+	for (int i = 0; i < 3; i++)
+	{
+		snprintf(filename, sizeof(filename), "%s/%s", directory, names[i]);
+		images[i] = MapFile(filename, sizes[i]);
+		if (images[i] == NULL)
+		{
+			printf("error: Couldn't map %s\n", filename);
+			while (--i >= 0)
+				UnmapFile(images[i], sizes[i]);
+			return 1;
+		}
+	}
+	UnmapROM(rom);
+	rom->pBasicROM = (const uint8_t*)images[0];
+	rom->pKernalROM = (const uint8_t*)images[1];
+	rom->pCharROM = (const uint8_t*)images[2];
+	rom->mapped = 1;
+	return 0;
+}
 
-	if (f==NULL)
+/*
+  Loads a headerless file at offset, exits when it can not be loaded
+*/
+void ReadFileIntoMemoryAt(State6510* state, char* filename, uint16_t offset)
+{
+	if (C64_LoadFile(state, filename, offset))
 	{
 		printf("error: Couldn't open %s\n", filename);
 		exit(1);
 	}
-	fseek(f, 0L, SEEK_END);
-	fsize = ftell(f);
-	fseek(f, 0L, SEEK_SET);
-	
-	buffer = (uint8_t*)malloc(fsize);
-//	new_buffer = (uint8_t*)malloc(fsize - 2);
+}
+
+/*****************************************************************************
+ *** MACHINE ARENA                                                         ***
+ ***                                                                       ***
+ *** A machine is one block of pages from the OS: the State6510 first,     ***
+ *** then the 64K of RAM on a page boundary, then the block cache. The OS  ***
+ *** hands the pages out zeroed. Only the JIT code has memory of its own,  ***
+ *** it has to be executable and is allocated when the first block is      ***
+ *** translated. A pool keeps machines for jobs that come and go, all of   ***
+ *** them in one allocation.                                               ***
+ *****************************************************************************/
+#define ARENA_PAGE			4096
+#define ARENA_ROUND(size)	(((size) + ARENA_PAGE - 1) & ~(size_t)(ARENA_PAGE - 1))
+#define ARENA_MEMORY		ARENA_ROUND(sizeof(State6510))	// offset of the RAM
+#if CPU_BLOCK_CACHE
+#define ARENA_BLOCKS		(ARENA_MEMORY + 0x10000)		// offset of the block cache
+#define ARENA_SIZE			ARENA_ROUND(ARENA_BLOCKS + sizeof(BlockCache6510))
+#else
+#define ARENA_SIZE			(ARENA_MEMORY + 0x10000)
+#endif
+
+/*
+  Sets up a machine in a zeroed arena
+*/
+static void InitArena(uint8_t* arena, const C64ROMSet* rom)
+{
+	State6510* state = (State6510*)arena;
+
+	state->memory = arena + ARENA_MEMORY;
+	state->rom = rom;
+#if CPU_BLOCK_CACHE
+	state->blocks = (BlockCache6510*)(arena + ARENA_BLOCKS);
+#endif
+}
+
+/*
+  Frees what a machine holds outside its arena
+*/
+static void ReleaseArena(State6510* state)
+{
+	if (state->trace != NULL)
+		StopTrace6510(state);
+	StopProfile6510(state);
+	if (state->screen != NULL)
+		C64_StopScreen(state);
+#if CPU_DISPATCH == CPU_DISPATCH_JIT
+	C64_FreeMemory(state->blocks->jit_check);
+	FreeExecutable(state->blocks->jit_code, JIT_ARENA_SIZE);
+#endif
+}
+
+/*****************************************************************************
+  Allocates one machine, using the (shared) ROM set
+******************************************************************************/
+State6510* C64_AllocateMemory(const C64ROMSet* rom)
+{
+	uint8_t* arena = (uint8_t*)AllocatePages(ARENA_SIZE);
+
+	if (arena == NULL)
+		return NULL;
+	InitArena(arena, rom);
+	return (State6510*)arena;
+}
+
+void C64_FreeMemory(State6510* state)
+{
+	if (state == NULL)
+		return;
+	ReleaseArena(state);
+	FreePages(state, ARENA_SIZE);
+}
+
+/*
+  The free machines of a pool are a stack, linked through next. free is
+  the first of them + 1 (0 = none) in the low half and a count of the
+  changes in the high half, so a compare and exchange fails when the
+  stack changed in between, also when the same machine is on top again.
+*/
+struct C64Pool {
+	uint8_t  *arenas;       // count arenas of ARENA_SIZE bytes
+	int      count;
+	volatile uint64_t free;
+	volatile uint32_t *next; // per machine: the free one below it + 1
+};
 
-	fread(buffer, fsize, 1, f);
-//	offset = (buffer[0] | (buffer[1] << 8));
-//	state->PC = offset;
+/*
+  Allocates count machines in one block, NULL when out of memory
+*/
+C64Pool* C64_CreatePool(const C64ROMSet* rom, int count)
+{
+	C64Pool* pool = (C64Pool*)calloc(1, sizeof(C64Pool));
+	int error = pool == NULL || count < 1;
+
+	if (!error)
+	{
+		pool->arenas = (uint8_t*)AllocatePages((size_t)count * ARENA_SIZE);
+		pool->next = (volatile uint32_t*)calloc(count, sizeof(uint32_t));
+		error = pool->arenas == NULL || pool->next == NULL;
+	}
+	if (error)
+	{
+		C64_FreePool(pool);
+		return NULL;
+	}
+	for (int i = 0; i < count; i++)
+	{
+		InitArena(pool->arenas + (size_t)i * ARENA_SIZE, rom);
+		pool->next[i] = (i + 1 < count) ? i + 2 : 0;
+	}
+	pool->count = count;
+	pool->free = 1;
+	return pool;
+}
 
-//	strncpy(new_buffer, buffer + 2, fsize - 2);
-	memcpy(state->memory + offset, buffer, fsize);
+/*
+  Frees the pool with its machines, none of them may be in use
+*/
+void C64_FreePool(C64Pool* pool)
+{
+	if (pool == NULL)
+		return;
+	for (int i = 0; i < pool->count; i++)
+		ReleaseArena((State6510*)(pool->arenas + (size_t)i * ARENA_SIZE));
+	FreePages(pool->arenas, (size_t)pool->count * ARENA_SIZE);
+	free((void*)pool->next);
+	free(pool);
+}
 
-	fclose(f);
+/*
+  Takes a machine from the pool, NULL when all are in use. It is in the
+  state the last user left it in, Reset6510 it before use. Thread safe.
+*/
+State6510* C64_TakeMachine(C64Pool* pool)
+{
+	for (;;)
+	{
+		uint64_t free = AtomicLoad64(&pool->free);
+		uint32_t top = (uint32_t)free;
 
-	// Remove first two bytes from file (start address which you can use as the offset for memcpy)
-	// when copying to state->memory add one address to the base.
+		if (top == 0)
+			return NULL;
+		if (AtomicCompareExchange64(&pool->free, free, pool->next[top - 1] | ((free >> 32) + 1) << 32))
+			return (State6510*)(pool->arenas + (size_t)(top - 1) * ARENA_SIZE);
+	}
 }
 
 /*
-  Allocates memory for the ROM files
+  Puts a machine back into its pool. Thread safe.
 */
-uint8_t C64_AllocateMemory()
+void C64_ReturnMachine(C64Pool* pool, State6510* state)
 {
-	state = (State6510*)calloc(1, sizeof(State6510));
-	pBasicROM = (uint8_t*)malloc(8192);
-	pKernalROM = (uint8_t*)malloc(8192);
-	pCharROM = (uint8_t*)malloc(4096);
+	uint32_t index = (uint32_t)(((uint8_t*)state - pool->arenas) / ARENA_SIZE);
 
-	return (pBasicROM != NULL && pKernalROM != NULL && pCharROM != NULL);
+	for (;;)
+	{
+		uint64_t free = AtomicLoad64(&pool->free);
+
+		pool->next[index] = (uint32_t)free;
+		if (AtomicCompareExchange64(&pool->free, free, (index + 1) | ((free >> 32) + 1) << 32))
+			return;
+	}
 }
 
 /*****************************************************************************
-*** INITIALIZE THE 6510                                                   ***
+*** RESET THE 6510: clear the RAM and start at $080E with no program      ***
+***                                                                       ***
+*** The RAM is not cleared byte by byte. Every page is shared with a      ***
+*** blank page, like a page of a snapshot (see SNAPSHOTS), and is only    ***
+*** copied into memory when it is written. Zero page, stack, I/O and the  ***
+*** vectors are cleared right away.                                       ***
 *****************************************************************************/
-void Init6510(void)
+static const uint8_t BlankPage[0x100];
+
+void Reset6510(State6510* state)
 {
-	// Initialize state memory
-	state->memory = (uint8_t*)malloc(0x40000);  //64K
+	int page;
+
 	// Clear memory
-	for (int i = 0; i <= 65535; i++)
-		state->memory[i] = 0;
+	for (page = 0x00; page <= 0xFF; page++)
+		state->cow[page] = BlankPage;
+	memset(state->memory, 0, 0x200);
+	memset(state->memory + 0xD000, 0, 0x1000);
+	memset(state->memory + 0xFF00, 0, 0x100);
+	state->cow[0x00] = state->cow[0x01] = state->cow[0xFF] = NULL;
+	for (page = 0xD0; page <= 0xDF; page++)
+		state->cow[page] = NULL;
+
 	// after a start page 127 MOS programming manual
 	// 8 cycles, fetch vector from 0xFFFC and 0xFFFD
 	state->A = 0;
 	state->X = 0;
 	state->Y = 0;
-	state->sr.C = 0;
-	state->sr.Z = 0;
-	state->sr.I = 0;
-	state->sr.D = 0;
-	state->sr.B = 1;
-	state->sr.dc = 1;
-	state->sr.V = 0;
-	state->sr.N = 0;
+	SetStatusRegister6510(state, 0x30); // B and dc set, all others clear
 	state->SP = 0x01ff; // points to end of the stack in memory $01FF.
+	state->cycles = 0;
+	state->instructions = 0;
+	state->run_until = 0;
+	state->halted = 0;
+	// No events and nothing on the interrupt lines, the devices start over
+	memset(&state->events, 0, sizeof(state->events));
+	state->irq = 0;
+	state->irq_from = 0;
+	state->nmi = 0;
+	state->nmi_pending = 0;
+	C64_ResetCIAs(state);
+	C64_ResetVIC(state);
 	
 	//state->PC = 0xE000;	//state->PC = 0xFCE2; // First time startup vector
 	state->PC = 0x080e;
@@ -2000,6 +3077,16 @@ void Init6510(void)
 	state->memory[0xFFFE] = 0x48; // 0xFF48
 	state->memory[0xFFFF] = 0xff;
 
+	C64_UpdateMemoryMap(state);
+}
+
+/*****************************************************************************
+*** INITIALIZE THE 6510                                                   ***
+*****************************************************************************/
+void Init6510(State6510* state)
+{
+	Reset6510(state);
+
 	//
 	// Test routines to test the emulator
 	//
@@ -2010,29 +3097,3 @@ void Init6510(void)
 
 	//ReadFileIntoMemoryAt(state, "./test_files/asl_Compiled.prg", 0x0801); // test software
 }
-
-uint8_t main (int argc, char**argv)
-{
-	int done = 0;
-	//clock_t t1, lastinterrupt;
-
-	//t1 = clock();
-	//lastinterrupt = clock();
-	
-	if (!C64_AllocateMemory()) return 1;
-	if (C64_LoadROM()) return 1;
-	Init6510();
-
-
-	while (done == 0)
-	{
-		done = Emulate6510Op(state);
-		//if (clock() - lastinterrupt > 1.0/60.0) // 1/60 second has elapsed
-		//{
-		//	printf("1 cycle\n");
-		//	lastinterrupt = clock();
-		//}
-	}
-
-	return 0;
-}
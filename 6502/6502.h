@@ -0,0 +1,315 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+	Lazy status register
+
+	N, Z, C and V are not stored as flags. The instructions store the result
+	(and for V the operands) that the flag depends on, and the flag is only
+	worked out when something reads it: a branch, PHP, BRK or
+	GetStatusRegister6510. Most results are overwritten before that happens.
+	Use the StatusRegister... macros to write and the ...Flag macros to read.
+*/
+typedef struct StatusRegisters {
+	uint8_t  n_result; // Negative Result: bit 7 of n_result
+	uint8_t  z_result; // Zero Result:     1 when z_result == 0
+	uint16_t c_result; // Carry:           bit 8 of c_result
+	uint8_t  v_op1;    // Overflow:        bit 7 of (v_op1 ^ v_result) & (v_op2 ^ v_result),
+	uint8_t  v_op2;    //                  the operands and result of the last ADC/SBC
+	uint8_t  v_result;
+	uint8_t  I;        // IRQ Disable     1=Disable
+	uint8_t  D;        // Decimal mode    1=true
+	uint8_t  B;        // BRK Command
+	uint8_t  dc;       // Expansion
+} StatusRegisters;
+
+/*
+	Commodore C64 ROM set
+
+	Read only, so one set can be shared by any number of machines, also
+	from different threads. The images are built into the program
+	(romdata.c, generated from rom/ by rom/embed.py). With the environment
+	variable C64_ROMS set to a directory, C64_LoadROM maps basic.rom,
+	kernal.rom and char.rom from there instead.
+*/
+#define C64_ROM_VARIABLE	"C64_ROMS"
+
+typedef struct C64ROMSet {
+	const uint8_t *pBasicROM;  // 8K  $A000 - $BFFF
+	const uint8_t *pKernalROM; // 8K  $E000 - $FFFF
+	const uint8_t *pCharROM;   // 4K  $D000 - $DFFF
+	uint8_t mapped;            // the images are mapped files (C64_MapROM)
+} C64ROMSet;
+
+struct State6510;
+typedef struct BlockCache6510 BlockCache6510;
+typedef struct Snapshot6510 Snapshot6510;
+typedef struct Trace6510 Trace6510;
+typedef struct Profile6510 Profile6510;
+
+/*
+	Block cache counters, see GetBlockCacheStats6510
+*/
+typedef struct BlockCacheStats6510 {
+	uint64_t hits;          // blocks found in the cache
+	uint64_t misses;        // blocks that had to be decoded
+	uint64_t invalidations; // blocks dropped because their code was written
+	uint64_t flushes;       // whole cache dropped on a bank switch
+	uint64_t compiled;      // blocks translated to native code (JIT)
+	uint64_t checked;       // instructions compared by the JIT check
+} BlockCacheStats6510;
+
+/*
+	I/O handlers
+
+	Called for every read or write on a page that has a handler installed,
+	see C64_SetPeekHandler / C64_SetPokeHandler. Pages without a handler
+	are read and written directly through the page tables.
+*/
+typedef uint8_t (*PeekHandler6510)(struct State6510* state, uint16_t address);
+typedef void (*PokeHandler6510)(struct State6510* state, uint16_t address, uint8_t value);
+
+/*
+	Events
+
+	A device that has to act at a given cycle schedules an event for it
+	instead of counting cycles. Run6510 runs the engine up to the next
+	event, calls its handler and goes on, so the dispatch loops never look
+	at the queue. A handler runs at the first instruction boundary at or
+	after its cycle, with every engine: the block engines and the JIT check
+	the budget after each instruction and leave the block there. It is
+	passed the cycle it was due, so a device that schedules its next event
+	from that does not drift. Each device owns fixed event numbers below C64_EVENTS,
+	scheduling an event again moves it.
+
+	The queue is a binary min-heap on the cycle, all zero = empty.
+*/
+#define C64_EVENTS	8
+
+// Event numbers of the devices
+#define C64_EVENT_CIA1		0	// timer A, timer B and TOD of CIA 1, see cia.c
+#define C64_EVENT_CIA2		3	// the same for CIA 2
+#define C64_EVENT_VIC		6	// end of a raster line, see vic.c
+
+typedef void (*EventHandler6510)(struct State6510* state, int event, uint64_t cycle);
+
+typedef struct EventQueue6510 {
+	uint64_t cycle[C64_EVENTS];           // when each event is due
+	EventHandler6510 handler[C64_EVENTS];
+	uint8_t  heap[C64_EVENTS];            // the scheduled events, earliest first
+	uint8_t  position[C64_EVENTS];        // of each event in heap + 1, 0 = not scheduled
+	uint8_t  count;
+} EventQueue6510;
+
+/*
+	Interrupts
+
+	IRQ is level triggered: the line is held as long as any source pulls
+	it (one bit per source, see C64_SetIRQ) and taken between instructions
+	while I is clear. NMI is edge triggered: it is taken once when the
+	first source pulls it. Both go through the vectors at $FFFE and $FFFA
+	as Peek sees them, so through the KERNAL when it is banked in.
+*/
+#define C64_IRQ_CIA1	0x01	// IRQ and NMI sources
+#define C64_IRQ_VIC		0x02
+#define C64_NMI_CIA2	0x01
+
+/*
+	CIA 6526 (cia.c)
+
+	The timers are not counted down every cycle. A running timer keeps the
+	value it had at a cycle, a read works the value out from the cycles
+	since then and the underflow is an event. The time of day clock ticks
+	with an event every tenth of a second while it runs. Nothing is
+	connected to the ports, the inputs read as 1.
+*/
+typedef struct CIA6526 {
+	uint8_t  pra, prb;          // port registers
+	uint8_t  ddra, ddrb;        // data direction, 1 = output
+	uint16_t latch[2];          // timer A and B
+	uint16_t counter[2];        // value at cycle since (running) or now (stopped)
+	uint64_t since[2];
+	uint8_t  cr[2];             // control registers A and B
+	uint8_t  icr;               // interrupts that happened, bit 7 = line pulled
+	uint8_t  mask;              // interrupts that pull the line
+	uint8_t  tod[4];            // tenths, seconds, minutes, hours (BCD, bit 7 = PM)
+	uint8_t  alarm[4];
+	uint8_t  tod_latch[4];      // what a read sees after hours was read
+	uint8_t  tod_latched;
+	uint8_t  tod_stopped;       // by a write to hours, until tenths is written
+	uint8_t  sdr;               // serial data register, not shifted
+} CIA6526;
+
+/*
+	VIC-II 6569 (vic.c)
+
+	Only the raster: a line event every 63 cycles counts the raster line,
+	raises the raster IRQ and (with a screen, see vic.h) renders the line
+	that ends from the registers and memory as they are then. The screen
+	codes and colours of a text row are fetched on its first line, like
+	the bad line of the real chip, but no cycles are taken from the CPU.
+	Sprites are shown and collide per line with or without a screen: a
+	sprite starts on the line after the raster matched its Y and runs for
+	21 lines (42 expanded), so it can be moved down again after that.
+*/
+typedef struct VIC6569 {
+	uint8_t  regs[0x40];        // as written, $D000 - $D03F
+	uint16_t raster;            // the current line
+	uint16_t compare;           // line of the raster IRQ
+	uint64_t line_start;        // cycle the current line started
+	uint8_t  irq;               // interrupts that happened ($D019)
+	uint8_t  mask;              // interrupts that pull the line ($D01A)
+	uint8_t  border;            // vertical border flip flop
+	uint8_t  display;           // DEN was set on line $30, the frame has text rows
+	uint8_t  matrix[40];        // screen codes of the current row
+	uint8_t  colors[40];        // colour RAM of the current row
+	uint16_t fetched;           // address matrix was read from
+	uint8_t  sprite_line[8];    // 1 + the line of each sprite shown next, 0 = not shown
+} VIC6569;
+
+typedef struct Screen6569 Screen6569;
+
+/*
+	One machine. Everything the core reads or writes lives in here (or in
+	the shared ROM set), so separate machines can run in separate threads.
+*/
+typedef struct State6510 {
+	uint8_t  A;  // Accumulator A
+	uint8_t  X;  // Index Register X
+	uint8_t  Y;  // Index Register Y
+	uint16_t PC; // Program Counter Points to the current address
+	uint16_t SP; // Stack Pointer points to the next available location in the stack.
+	uint64_t cycles; // Machine cycles executed since Init6510
+	uint64_t instructions; // Instructions executed since Init6510
+	uint64_t run_until; // Run6510 stops when cycles reaches this
+	uint8_t  halted; // Set by BRK with halt_on_brk, Run6510 does nothing until Init6510
+	uint8_t  halt_on_brk; // 1 = BRK halts the machine (test programs), 0 = it takes the IRQ vector; Reset6510 keeps it
+	uint8_t  irq;    // Sources pulling the IRQ line, one bit each
+	uint64_t irq_from; // A pending IRQ is taken from this cycle on, CLI and PLP hold it back one instruction
+	uint8_t  nmi;    // Sources pulling the NMI line, one bit each
+	uint8_t  nmi_pending; // NMI edge not taken yet
+	EventQueue6510 events;
+	CIA6526  cia[2];
+	VIC6569  vic;
+	uint8_t  *memory;
+	const C64ROMSet *rom;
+	uint8_t  port;   // Processor port bits LORAM, HIRAM, CHAREN the maps were built for
+	const uint8_t *readmap[256]; // What Peek sees per 256 byte page, NULL = I/O
+	uint8_t  *writemap[256]; // Where Poke stores per 256 byte page, NULL = I/O
+	const uint8_t *cow[256]; // RAM page still shared with a snapshot or blank after a reset, NULL = in memory
+	PeekHandler6510 peekio[256]; // Read handler per page, NULL = none
+	PokeHandler6510 pokeio[256]; // Write handler per page, NULL = none
+	PeekHandler6510 chippeek[16]; // I/O chip per page of $D000 - $DFFF, only while I/O is banked in
+	PokeHandler6510 chippoke[16];
+	uint8_t  screenpage[256]; // 1 = the screen is rendered from the page, writes go to the VIC, see C64_WatchPage
+	BlockCache6510 *blocks; // Predecoded code, only with CPU_DISPATCH_BLOCKS
+	Trace6510 *trace;       // Instruction trace, NULL = off, see trace.h
+	Profile6510 *profile;   // Execution counters, NULL = off, see profile.h
+	Screen6569 *screen;     // Rendered frames, NULL = off, see vic.h
+
+	struct   StatusRegisters sr;
+} State6510;
+
+// PAL: 312 raster lines of 63 cycles
+#define C64_RASTER_LINES		312
+#define C64_CYCLES_PER_LINE		63
+#define C64_CYCLES_PER_FRAME	19656
+#define C64_CYCLES_PER_SECOND	985248
+
+/*****************************************************************************
+ *** 6510 core                                                             ***
+ *****************************************************************************/
+uint8_t Peek(State6510* state, uint16_t address);
+void Poke(State6510* state, uint16_t address, uint8_t value);
+uint8_t GetStatusRegister6510(State6510* state);
+void SetStatusRegister6510(State6510* state, uint8_t psr);
+int Emulate6510Op(State6510* state);
+int Run6510(State6510* state, int cycle_budget);
+int RunReference6510(State6510* state, int cycle_budget);
+void GetBlockCacheStats6510(State6510* state, BlockCacheStats6510* stats);
+int EnableJitCheck6510(State6510* state);
+
+/*****************************************************************************
+ *** Disassembler (disasm.c)                                               ***
+ *** Writes into the caller's buffer, reentrant                            ***
+ *****************************************************************************/
+#define DISASSEMBLY_LINE	32	// longest line with '\n' and '\0'
+
+int DisassembleInstruction6510(uint16_t pc, const uint8_t* code, char* line);
+size_t Disassemble6510Range(const uint8_t* image, size_t size, uint16_t origin, char* buffer, size_t buffer_size);
+size_t Disassemble6510Memory(State6510* state, uint16_t from, uint16_t to, char* buffer, size_t buffer_size);
+int Disassemble6510Op(State6510* state, uint16_t pc);
+
+/*****************************************************************************
+ *** Machine                                                               ***
+ *****************************************************************************/
+C64ROMSet* C64_AllocateROM(void);
+uint8_t C64_LoadROM(C64ROMSet* rom);
+uint8_t C64_MapROM(C64ROMSet* rom, const char* directory);
+void C64_FreeROM(C64ROMSet* rom);
+typedef struct C64Pool C64Pool;
+
+State6510* C64_AllocateMemory(const C64ROMSet* rom);
+void C64_FreeMemory(State6510* state);
+C64Pool* C64_CreatePool(const C64ROMSet* rom, int count);
+void C64_FreePool(C64Pool* pool);
+State6510* C64_TakeMachine(C64Pool* pool);
+void C64_ReturnMachine(C64Pool* pool, State6510* state);
+void C64_UpdateMemoryMap(State6510* state);
+void C64_SetPeekHandler(State6510* state, uint8_t page, PeekHandler6510 handler);
+void C64_SetPokeHandler(State6510* state, uint8_t page, PokeHandler6510 handler);
+void C64_SetIOChip(State6510* state, uint8_t page, PeekHandler6510 peek, PokeHandler6510 poke);
+void C64_WatchPage(State6510* state, uint8_t page, int watch);
+void ReadFileIntoMemoryAt(State6510* state, char* filename, uint16_t offset);
+void Reset6510(State6510* state);
+void Init6510(State6510* state);
+
+/*****************************************************************************
+ *** Events and interrupts                                                 ***
+ *****************************************************************************/
+void C64_ScheduleEvent(State6510* state, int event, uint64_t cycle, EventHandler6510 handler);
+void C64_CancelEvent(State6510* state, int event);
+void C64_SetIRQ(State6510* state, uint8_t source, int pull);
+void C64_SetNMI(State6510* state, uint8_t source, int pull);
+
+/*****************************************************************************
+ *** CIAs (cia.c)                                                          ***
+ *** CIA 1 at $DC00 (IRQ), CIA 2 at $DD00 (NMI), registers repeat every 16 ***
+ *****************************************************************************/
+void C64_AttachCIAs(State6510* state);
+void C64_ResetCIAs(State6510* state);
+
+/*****************************************************************************
+ *** VIC-II (vic.c)                                                        ***
+ *** At $D000 - $D3FF, registers repeat every 64, the screen is in vic.h   ***
+ *****************************************************************************/
+void C64_AttachVIC(State6510* state);
+void C64_ResetVIC(State6510* state);
+
+/*****************************************************************************
+ *** Loading programs (loader.c)                                           ***
+ *** Straight into RAM, from files or from a mapped archive                ***
+ *****************************************************************************/
+#define C64_PRG_HEADER	(-1)	// load: at the address in the first two bytes
+
+typedef struct C64Archive C64Archive;
+
+int C64_LoadFile(State6510* state, const char* filename, uint16_t offset);
+int C64_LoadPRG(State6510* state, const char* filename, uint16_t* start, uint16_t* end);
+C64Archive* C64_OpenArchive(const char* filename);
+void C64_CloseArchive(C64Archive* archive);
+int C64_FindInArchive(const C64Archive* archive, const char* name);
+int C64_LoadFromArchive(State6510* state, const C64Archive* archive, int member, int32_t load, uint16_t* start, uint16_t* end);
+int C64_WriteArchive(const char* filename, int count, char** files);
+
+/*****************************************************************************
+ *** Snapshots                                                             ***
+ *****************************************************************************/
+Snapshot6510* C64_Snapshot(State6510* state);
+void C64_Restore(State6510* state, const Snapshot6510* snapshot);
+State6510* C64_Fork(const Snapshot6510* snapshot);
+void C64_FreeSnapshot(Snapshot6510* snapshot);
+void C64_OwnMemory(State6510* state);
+void C64_OwnMemoryRange(State6510* state, uint16_t address, uint32_t size);
@@ -0,0 +1,725 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "core.h"
+#include "bench.h"
+#include "platform.h"
+#include "vic.h"
+
+/*****************************************************************************
+ *** THREADS: throughput of independent machines, one per thread          ***
+ ***                                                                       ***
+ *** Every thread owns a machine and runs the test program from Init6510   ***
+ *** to BRK a number of times. All machines share one ROM set. With a      ***
+ *** reentrant core the total speed should grow with the number of         ***
+ *** threads until the cores run out.                                      ***
+ *****************************************************************************/
+typedef struct BenchThread {
+	const C64ROMSet *rom;
+	int runs;
+	uint64_t cycles; // out: cycles executed
+	int failed;      // out: machine could not be allocated
+} BenchThread;
+
+static void BenchThreadRun(void* arg)
+{
+	BenchThread* job = (BenchThread*)arg;
+	State6510* state = C64_AllocateMemory(job->rom);
+
+	if (state == NULL)
+	{
+		job->failed = 1;
+		return;
+	}
+	state->halt_on_brk = 1;
+	for (int run = 0; run < job->runs; run++)
+	{
+		Init6510(state);
+		while (!state->halted)
+			Run6510(state, C64_CYCLES_PER_FRAME);
+		job->cycles += state->cycles;
+	}
+	C64_FreeMemory(state);
+}
+
+/*
+  Runs with 1, 2, 4, ... up to max_threads threads and prints the
+  aggregate speed in emulated MHz and the scaling against one thread.
+*/
+static int BenchThreads(const C64ROMSet* rom, int max_threads, int runs)
+{
+	double single_mhz = 0;
+	BenchThread* jobs = (BenchThread*)calloc(max_threads, sizeof(BenchThread));
+	Thread6510* threads = (Thread6510*)calloc(max_threads, sizeof(Thread6510));
+
+	if (jobs == NULL || threads == NULL)
+	{
+		free(jobs);
+		free(threads);
+		return 1;
+	}
+
+	printf("threads  runs/thread  cycles        seconds  MHz       speedup  efficiency\n");
+	for (int count = 1; count <= max_threads; count = (count * 2 > max_threads && count != max_threads) ? max_threads : count * 2)
+	{
+		uint64_t cycles = 0;
+		double start, seconds, mhz;
+		int started = 0;
+
+		for (int i = 0; i < count; i++)
+		{
+			memset(&jobs[i], 0, sizeof(BenchThread));
+			jobs[i].rom = rom;
+			jobs[i].runs = runs;
+		}
+		start = TimerSeconds();
+		for (int i = 0; i < count; i++)
+		{
+			if (StartThread(&threads[i], BenchThreadRun, &jobs[i]))
+				break;
+			started++;
+		}
+		for (int i = 0; i < started; i++)
+			JoinThread(threads[i]);
+		seconds = TimerSeconds() - start;
+
+		for (int i = 0; i < started; i++)
+		{
+			if (jobs[i].failed)
+				started = 0;
+			cycles += jobs[i].cycles;
+		}
+		if (started != count)
+		{
+			printf("error: Couldn't start %d machines\n", count);
+			break;
+		}
+		mhz = (double)cycles / seconds / 1e6;
+		if (count == 1)
+			single_mhz = mhz;
+		printf("%-8d %-12d %-13llu %-8.3f %-9.1f %-8.2f %.0f%%\n", count, runs, (unsigned long long)cycles,
+			seconds, mhz, mhz / single_mhz, 100.0 * mhz / single_mhz / count);
+		if (count == max_threads)
+			break;
+	}
+
+	free(jobs);
+	free(threads);
+	return 0;
+}
+
+/*****************************************************************************
+ *** FORK: machines started per second from a warm state                   ***
+ ***                                                                       ***
+ *** A machine runs the test program for a number of frames and is saved   ***
+ *** in a snapshot. Then many machines are started from that point and run ***
+ *** one more frame each, once by starting over (Init6510, which loads the  ***
+ *** program again, and running the frames again) and once by restoring   ***
+ *** the snapshot into a machine. Only the pages a fork writes are copied. ***
+ *****************************************************************************/
+static void RunFrames(State6510* state, int frames)
+{
+	for (int frame = 0; frame < frames && !state->halted; frame++)
+		Run6510(state, C64_CYCLES_PER_FRAME);
+}
+
+static int BenchFork(const C64ROMSet* rom, int forks, int frames)
+{
+	State6510* state = C64_AllocateMemory(rom);
+	Snapshot6510* snapshot = NULL;
+	double start, init_seconds, restore_seconds;
+
+	if (state != NULL)
+	{
+		state->halt_on_brk = 1;
+		Init6510(state);
+		RunFrames(state, frames);
+		snapshot = C64_Snapshot(state);
+	}
+	if (snapshot == NULL)
+	{
+		printf("error: Couldn't allocate the machine\n");
+		C64_FreeMemory(state);
+		return 1;
+	}
+
+	start = TimerSeconds();
+	for (int i = 0; i < forks; i++)
+	{
+		Init6510(state);
+		RunFrames(state, frames + 1);
+	}
+	init_seconds = TimerSeconds() - start;
+
+	start = TimerSeconds();
+	for (int i = 0; i < forks; i++)
+	{
+		C64_Restore(state, snapshot);
+		RunFrames(state, 1);
+	}
+	restore_seconds = TimerSeconds() - start;
+
+	printf("warm state after %d frames, %d forks of 1 frame\n", frames, forks);
+	printf("method     seconds  forks/s\n");
+	printf("init       %-8.3f %.0f\n", init_seconds, forks / init_seconds);
+	printf("restore    %-8.3f %.0f\n", restore_seconds, forks / restore_seconds);
+
+	C64_FreeMemory(state);
+	C64_FreeSnapshot(snapshot);
+	return 0;
+}
+
+/*****************************************************************************
+ *** OPS: speed of every opcode and addressing mode                        ***
+ ***                                                                       ***
+ *** Every case is a synthetic stream of one instruction, OPS_COPIES      ***
+ *** copies of it followed by a JMP back, run through Emulate6510Op. The   ***
+ *** operands point at RAM ($80, $9000, ($70,X) and ($74),Y), never at     ***
+ *** I/O, so a case measures the handler and not a device. Extra cases:    ***
+ ***   - ADC and SBC also in decimal mode                                  ***
+ ***   - abs,X abs,Y and (zp),Y also with a page crossing                  ***
+ ***   - branches taken (to themselves) and not taken                      ***
+ ***   - JMP jumps to itself                                               ***
+ ***   - JSR calls an RTS, PHA/PHP are followed by PLA/PLP, so the stack   ***
+ ***     stays put; these report the average of the two instructions       ***
+ *** Not measured: BRK (halts), RTI and the unimplemented opcodes.         ***
+ ***                                                                       ***
+ *** Every case runs OPS_RUNS times, the fastest run is reported. Output  ***
+ *** is one JSON object per line and case, the last line is the total     ***
+ *** over all cases.                                                       ***
+ *****************************************************************************/
+#define OPS_CODE		0x1000
+#define OPS_RTS			0x0F00	// JSR target
+#define OPS_POINTER		0x9100	// JMP (ind) pointer
+#define OPS_COPIES		2048
+#define OPS_RUNS		3		// the fastest run counts
+
+typedef enum OpsVariant {
+	OPS_PLAIN, OPS_DECIMAL, OPS_PAGE_CROSS, OPS_TAKEN, OPS_NOT_TAKEN, OPS_PAIR
+} OpsVariant;
+
+static const char* const OpsVariantName[] = { "", "decimal", "page cross", "taken", "not taken", "pair" };
+
+/*
+  Writes the instruction for opcode at pc
+
+  returns its length
+*/
+static int EmitOp(uint8_t* memory, uint16_t pc, uint8_t opcode, OpsVariant variant)
+{
+	uint8_t mode = AddrMode6510[opcode];
+	uint16_t address = variant == OPS_PAGE_CROSS ? 0x90FF : 0x9000;
+
+	memory[pc] = opcode;
+	switch (mode)
+	{
+		case AM_IMM: memory[pc + 1] = 0x01; break;
+		case AM_ZPG:
+		case AM_ZPX:
+		case AM_ZPY: memory[pc + 1] = 0x80; break;
+		case AM_INX: memory[pc + 1] = 0x70; break;
+		case AM_INY: memory[pc + 1] = 0x74; break;
+		case AM_REL: memory[pc + 1] = variant == OPS_TAKEN ? 0xFE : 0x00; break;
+		case AM_ABS:
+		case AM_ABX:
+		case AM_ABY:
+			if (opcode == 0x4C)
+				address = pc;
+			else if (opcode == 0x20)
+				address = OPS_RTS;
+			memory[pc + 1] = address & 0xFF;
+			memory[pc + 2] = address >> 8;
+			break;
+		case AM_IND:
+			memory[pc + 1] = OPS_POINTER & 0xFF;
+			memory[pc + 2] = OPS_POINTER >> 8;
+			break;
+	}
+	return ModeLength6510[mode];
+}
+
+/*
+  Fills the machine with the stream for opcode and sets the registers
+
+  returns the status register to start with
+*/
+static uint8_t BuildOps(State6510* state, uint8_t opcode, OpsVariant variant)
+{
+	uint8_t* memory = state->memory;
+	uint8_t status = 0x30;
+	uint16_t pc = OPS_CODE;
+
+	memset(memory, 0, 0x10000);
+	memory[0x0000] = 0x2f;
+	memory[0x0001] = 0x37;
+	memory[0x71] = 0x00; // ($70,X) with X = 1
+	memory[0x72] = 0x90;
+	memory[0x74] = variant == OPS_PAGE_CROSS ? 0xFF : 0x00; // ($74),Y
+	memory[0x75] = 0x90;
+	memory[OPS_POINTER] = OPS_CODE & 0xFF;
+	memory[OPS_POINTER + 1] = OPS_CODE >> 8;
+	memory[OPS_RTS] = 0x60;
+
+	if (variant == OPS_DECIMAL)
+		status |= 0x08;
+	if (AddrMode6510[opcode] == AM_REL)
+	{
+		// Bits 7-6 select N, V, C or Z, bit 5 is the value that branches
+		static const uint8_t flag[4] = { 0x80, 0x40, 0x01, 0x02 };
+		int set = (opcode >> 5) & 1;
+
+		if (set == (variant == OPS_TAKEN))
+			status |= flag[opcode >> 6];
+	}
+	if (opcode == 0x4C || opcode == 0x6C || variant == OPS_TAKEN)
+		EmitOp(memory, pc, opcode, variant); // jumps to itself
+	else
+	{
+		for (int i = 0; i < OPS_COPIES; i++)
+		{
+			pc += EmitOp(memory, pc, opcode, variant);
+			if (opcode == 0x08 || opcode == 0x48)
+				memory[pc++] = opcode + 0x20; // PLP, PLA
+		}
+		memory[pc] = 0x4C;
+		memory[pc + 1] = OPS_CODE & 0xFF;
+		memory[pc + 2] = OPS_CODE >> 8;
+	}
+
+	C64_UpdateMemoryMap(state);
+	state->A = 0;
+	state->X = 1;
+	state->Y = 1;
+	state->SP = 0x01ff;
+	state->PC = OPS_CODE;
+	state->cycles = 0;
+	state->halted = 0;
+	return status;
+}
+
+typedef struct OpsTotal {
+	uint64_t instructions;
+	uint64_t cycles;
+	double seconds;
+	int cases;
+} OpsTotal;
+
+static void PrintOpsLine(const char* name, const char* opcode, const char* variant,
+	uint64_t instructions, uint64_t cycles, double seconds)
+{
+	printf("{\"case\":\"%s\",\"opcode\":\"%s\",\"variant\":\"%s\",\"instructions\":%llu,\"cycles\":%llu,"
+		"\"seconds\":%.6f,\"mips\":%.2f,\"ns_per_instruction\":%.3f,\"mhz\":%.2f}\n",
+		name, opcode, variant, (unsigned long long)instructions, (unsigned long long)cycles, seconds,
+		instructions / seconds / 1e6, seconds * 1e9 / instructions, cycles / seconds / 1e6);
+}
+
+static void RunOpsCase(State6510* state, uint8_t opcode, OpsVariant variant, int instructions,
+	const char* filter, OpsTotal* total)
+{
+	char line[DISASSEMBLY_LINE];
+	char code[4];
+	double start, elapsed, seconds = 0;
+
+	SetStatusRegister6510(state, BuildOps(state, opcode, variant));
+	DisassembleInstruction6510(OPS_CODE, state->memory + OPS_CODE, line);
+	if (filter != NULL && strstr(line + 15, filter) == NULL)
+		return;
+
+	for (int i = 0; i < instructions / 16; i++)	// warm up
+		Emulate6510Op(state);
+	for (int run = 0; run < OPS_RUNS; run++)
+	{
+		SetStatusRegister6510(state, BuildOps(state, opcode, variant));
+		start = TimerSeconds();
+		for (int i = 0; i < instructions; i++)
+			Emulate6510Op(state);
+		elapsed = TimerSeconds() - start;
+		if (run == 0 || elapsed < seconds)
+			seconds = elapsed;
+	}
+
+	sprintf(code, "%02X", opcode);
+	PrintOpsLine(line + 15, code, OpsVariantName[variant], instructions, state->cycles, seconds);
+	total->instructions += instructions;
+	total->cycles += state->cycles;
+	total->seconds += seconds;
+	total->cases++;
+}
+
+static int BenchOps(const C64ROMSet* rom, int instructions, const char* filter)
+{
+	State6510* state = C64_AllocateMemory(rom);
+	OpsTotal total = { 0, 0, 0, 0 };
+
+	if (state == NULL)
+	{
+		printf("error: Couldn't allocate the machine\n");
+		return 1;
+	}
+	for (int opcode = 0; opcode < 256; opcode++)
+	{
+		uint8_t mode = AddrMode6510[opcode];
+
+		if (Flow6510[opcode] == FLOW_UNIMPL || opcode == 0x00 || opcode == 0x40 ||
+			opcode == 0x60 || opcode == 0x28 || opcode == 0x68)
+			continue;
+		if (mode == AM_REL)
+		{
+			RunOpsCase(state, (uint8_t)opcode, OPS_TAKEN, instructions, filter, &total);
+			RunOpsCase(state, (uint8_t)opcode, OPS_NOT_TAKEN, instructions, filter, &total);
+			continue;
+		}
+		RunOpsCase(state, (uint8_t)opcode, (opcode == 0x20 || opcode == 0x08 || opcode == 0x48) ? OPS_PAIR : OPS_PLAIN,
+			instructions, filter, &total);
+		if (strcmp(Mnemonic6510[opcode], "ADC") == 0 || strcmp(Mnemonic6510[opcode], "SBC") == 0)
+			RunOpsCase(state, (uint8_t)opcode, OPS_DECIMAL, instructions, filter, &total);
+		if (mode == AM_ABX || mode == AM_ABY || mode == AM_INY)
+			RunOpsCase(state, (uint8_t)opcode, OPS_PAGE_CROSS, instructions, filter, &total);
+	}
+	if (total.cases > 0)
+		PrintOpsLine("all", "", "", total.instructions, total.cycles, total.seconds);
+
+	C64_FreeMemory(state);
+	return 0;
+}
+
+/*****************************************************************************
+ *** VIC: time the VIC takes to render a frame, per mode                   ***
+ ***                                                                       ***
+ *** The CPU runs INC $0400 in a loop over a screen, colour RAM and bitmap ***
+ *** filled with patterns, so one cell changes all the time and the rest   ***
+ *** stays. Every mode runs the frames without a screen, with one that     ***
+ *** renders every line and with one that tracks the dirty lines (the      ***
+ *** fastest of VIC_BENCH_RUNS runs each). The time over the run without a ***
+ *** screen is given in ms per frame, tracked also as a share of the 20 ms ***
+ *** a PAL frame lasts. With a prefix the last frame of every mode is      ***
+ *** saved as <prefix><mode>.ppm.                                          ***
+ *****************************************************************************/
+typedef struct VICBenchMode {
+	const char *name;
+	uint8_t d011, d016, d018;
+} VICBenchMode;
+
+static const VICBenchMode VICBenchModes[] = {
+	{ "text",       0x1B, 0x08, 0x14 }, // char ROM
+	{ "multitext",  0x1B, 0x18, 0x14 },
+	{ "ecm",        0x5B, 0x08, 0x14 },
+	{ "bitmap",     0x3B, 0x08, 0x18 }, // bitmap at $2000
+	{ "multibitmap", 0x3B, 0x18, 0x18 },
+};
+
+#define VIC_BENCH_RUNS	3	// the fastest run counts
+
+static double RunFramesTimed(State6510* state, int frames)
+{
+	double best = 0;
+
+	for (int run = 0; run < VIC_BENCH_RUNS; run++)
+	{
+		double start = TimerSeconds();
+		double seconds;
+
+		RunFrames(state, frames);
+		seconds = TimerSeconds() - start;
+		if (run == 0 || seconds < best)
+			best = seconds;
+	}
+	return best;
+}
+
+/*
+  Seconds for the frames with a screen, full = render every line. Returns
+  a negative time when the screen can not be allocated.
+*/
+static double RunScreenTimed(State6510* state, int frames, int full, double* skipped)
+{
+	double seconds;
+
+	if (C64_StartScreen(state))
+		return -1;
+	state->screen->full = (uint8_t)full;
+	seconds = RunFramesTimed(state, frames);
+	*skipped = (double)state->screen->skipped / (state->screen->skipped + state->screen->rendered);
+	return seconds;
+}
+
+/*
+  The screen, colour RAM, bitmap and colours all the VIC benchmarks use
+*/
+static void FillVICBench(State6510* state)
+{
+	for (int i = 0; i < 1000; i++)
+	{
+		Poke(state, 0x0400 + i, (uint8_t)i);
+		Poke(state, 0xD800 + i, (uint8_t)(i / 40 + i));
+	}
+	for (int i = 0; i < 8000; i++)
+		Poke(state, 0x2000 + i, (uint8_t)(i * 37 ^ i >> 3));
+	for (int i = 0; i < 5; i++)
+		Poke(state, 0xD020 + i, (uint8_t)(14 - i));
+}
+
+static int BenchVIC(const C64ROMSet* rom, int frames, const char* prefix)
+{
+	static const uint8_t loop[] = { 0xEE, 0x00, 0x04, 0x4C, 0x0E, 0x08 }; // $080E: INC $0400, JMP $080E
+	State6510* state = C64_AllocateMemory(rom);
+	char filename[1024];
+	int result = 0;
+
+	if (state == NULL)
+	{
+		printf("error: Couldn't allocate the machine\n");
+		return 1;
+	}
+	Init6510(state);
+	C64_AttachVIC(state);
+	for (int i = 0; i < (int)sizeof(loop); i++)
+		Poke(state, 0x080E + i, loop[i]);
+	FillVICBench(state);
+
+	printf("%d frames per mode\n", frames);
+	printf("mode         full ms/frame  tracked ms/frame  of 20 ms  lines skipped\n");
+	for (int mode = 0; mode < (int)(sizeof(VICBenchModes) / sizeof(VICBenchModes[0])); mode++)
+	{
+		const VICBenchMode* bench = &VICBenchModes[mode];
+		double cpu_seconds, full_seconds, tracked_seconds, skipped, full, tracked;
+
+		Poke(state, 0xD011, bench->d011);
+		Poke(state, 0xD016, bench->d016);
+		Poke(state, 0xD018, bench->d018);
+		cpu_seconds = RunFramesTimed(state, frames);
+		full_seconds = RunScreenTimed(state, frames, 1, &skipped);
+		C64_StopScreen(state);
+		tracked_seconds = RunScreenTimed(state, frames, 0, &skipped);
+		if (full_seconds < 0 || tracked_seconds < 0)
+		{
+			printf("error: Couldn't allocate the screen\n");
+			result = 1;
+			break;
+		}
+		full = (full_seconds - cpu_seconds) * 1000 / frames;
+		tracked = (tracked_seconds - cpu_seconds) * 1000 / frames;
+		printf("%-12s %-14.4f %-17.4f %6.2f %%  %.1f %%\n", bench->name, full, tracked, tracked * 100 / 20, skipped * 100);
+		if (prefix != NULL)
+		{
+			snprintf(filename, sizeof(filename), "%s%s.ppm", prefix, bench->name);
+			result |= C64_SavePPM(state->screen, filename);
+		}
+		C64_StopScreen(state);
+	}
+
+	C64_FreeMemory(state);
+	return result;
+}
+
+/*****************************************************************************
+ *** SPRITES: time the sprites take to show and collide                    ***
+ ***                                                                       ***
+ *** All 8 sprites over the text screen of the VIC bench, 20 pixels apart  ***
+ *** so they overlap each other and the text. "static" leaves them where   ***
+ *** they are, "multiplexed" moves all of them 42 lines down from a raster ***
+ *** IRQ 4 times a frame: 32 sprites a frame. Every case runs the frames   ***
+ *** with the sprites off and on, without a screen (the collisions only)   ***
+ *** and with a dirty tracking one, fastest of VIC_BENCH_RUNS each. The    ***
+ *** time the sprites add is given in ms per frame, on the screen also as  ***
+ *** a share of the 20 ms of a PAL frame. With a prefix the last frame of  ***
+ *** every case is saved as <prefix><case>.ppm.                            ***
+ *****************************************************************************/
+typedef struct SpriteBenchCase {
+	const char *name;
+	int sprites;               // shown per frame
+	uint8_t irq;               // $D01A: 1 = multiplexed by the raster IRQ
+} SpriteBenchCase;
+
+static const SpriteBenchCase SpriteBenchCases[] = {
+	{ "static",      8,  0x00 },
+	{ "multiplexed", 32, 0x01 },
+};
+
+static const uint8_t SpriteBands[] = { 50, 92, 134, 176 }; // Y of the sprites after each IRQ
+static const uint8_t SpriteIRQLines[] = { 40, 82, 124, 166 };
+
+static int BenchSprites(const C64ROMSet* rom, int frames, const char* prefix)
+{
+	static const uint8_t loop[] = { 0x58, 0xEE, 0x00, 0x04, 0x4C, 0x0F, 0x08 }; // $080E: CLI, INC $0400, JMP $080F
+	static const uint8_t multiplexer[] = {
+		0xA6, 0x02,                   // $0900: LDX $02       band
+		0xBD, 0x00, 0x0A,             //        LDA $0A00,X   its Y
+		0x8D, 0x01, 0xD0, 0x8D, 0x03, 0xD0, 0x8D, 0x05, 0xD0, 0x8D, 0x07, 0xD0, // STA $D001 - $D00F
+		0x8D, 0x09, 0xD0, 0x8D, 0x0B, 0xD0, 0x8D, 0x0D, 0xD0, 0x8D, 0x0F, 0xD0,
+		0xE8, 0x8A, 0x29, 0x03, 0x85, 0x02, // INX, TXA, AND #3, STA $02
+		0xAA,                         //        TAX
+		0xBD, 0x04, 0x0A,             //        LDA $0A04,X   line of the next band
+		0x8D, 0x12, 0xD0,             //        STA $D012
+		0xA9, 0x01, 0x8D, 0x19, 0xD0, //        LDA #1, STA $D019
+		0x4C, 0x81, 0xEA,             //        JMP $EA81
+	};
+	State6510* state = C64_AllocateMemory(rom);
+	char filename[1024];
+	int result = 0;
+
+	if (state == NULL)
+	{
+		printf("error: Couldn't allocate the machine\n");
+		return 1;
+	}
+	Init6510(state);
+	C64_AttachVIC(state);
+	for (int i = 0; i < (int)sizeof(loop); i++)
+		Poke(state, 0x080E + i, loop[i]);
+	for (int i = 0; i < (int)sizeof(multiplexer); i++)
+		Poke(state, 0x0900 + i, multiplexer[i]);
+	for (int i = 0; i < 4; i++)
+	{
+		Poke(state, 0x0A00 + i, SpriteBands[i]);
+		Poke(state, 0x0A04 + i, SpriteIRQLines[i]);
+	}
+	Poke(state, 0x0314, 0x00);
+	Poke(state, 0x0315, 0x09);
+	FillVICBench(state);
+	Poke(state, 0xD011, 0x1B);
+	Poke(state, 0xD016, 0x08);
+	Poke(state, 0xD018, 0x14);
+
+	// Sprite n at $3000 + n * 64 (pointer $C0 + n), the odd ones multicolor, 7 expanded
+	for (int n = 0; n < 8; n++)
+	{
+		Poke(state, 0x07F8 + n, (uint8_t)(0xC0 + n));
+		for (int i = 0; i < 63; i++)
+			Poke(state, 0x3000 + n * 64 + i, (uint8_t)((i % 3 == 1) ? 0xFF : 0x3C ^ (i * 7)));
+		Poke(state, 0xD000 + n * 2, (uint8_t)(40 + n * 20));
+		Poke(state, 0xD027 + n, (uint8_t)(n + 1));
+	}
+	Poke(state, 0xD01C, 0xAA);
+	Poke(state, 0xD01D, 0x80);
+	Poke(state, 0xD01B, 0x0F);
+	Poke(state, 0xD025, 11);
+	Poke(state, 0xD026, 12);
+
+	printf("%d frames per case\n", frames);
+	printf("case         sprites/frame  headless ms/frame  screen ms/frame  of 20 ms\n");
+	for (int i = 0; i < (int)(sizeof(SpriteBenchCases) / sizeof(SpriteBenchCases[0])); i++)
+	{
+		const SpriteBenchCase* bench = &SpriteBenchCases[i];
+		double seconds[2][2], skipped, headless, screen;
+
+		Poke(state, 0x02, 0);
+		Poke(state, 0xD012, SpriteIRQLines[0]);
+		Poke(state, 0xD01A, bench->irq);
+		for (int n = 0; n < 8; n++)
+			Poke(state, 0xD001 + n * 2, 100);
+		// [sprites on][screen]
+		for (int on = 0; on < 2; on++)
+		{
+			Poke(state, 0xD015, on ? 0xFF : 0x00);
+			seconds[on][0] = RunFramesTimed(state, frames);
+			seconds[on][1] = RunScreenTimed(state, frames, 0, &skipped);
+			if (seconds[on][1] < 0)
+				break;
+			if (!on || prefix == NULL)
+				C64_StopScreen(state);
+		}
+		if (seconds[0][1] < 0 || seconds[1][1] < 0)
+		{
+			printf("error: Couldn't allocate the screen\n");
+			result = 1;
+			break;
+		}
+		headless = (seconds[1][0] - seconds[0][0]) * 1000 / frames;
+		screen = (seconds[1][1] - seconds[0][1]) * 1000 / frames;
+		printf("%-12s %-14d %-18.4f %-16.4f %6.2f %%\n", bench->name, bench->sprites, headless, screen, screen * 100 / 20);
+		if (prefix != NULL)
+		{
+			snprintf(filename, sizeof(filename), "%s%s.ppm", prefix, bench->name);
+			result |= C64_SavePPM(state->screen, filename);
+			C64_StopScreen(state);
+		}
+	}
+
+	C64_FreeMemory(state);
+	return result;
+}
+
+/*****************************************************************************
+ *** BENCH: benchmark command line                                         ***
+ ***      6502 bench threads [max threads] [runs per thread]               ***
+ ***      6502 bench fork [forks] [frames]                                 ***
+ ***      6502 bench ops [instructions per case] [filter]                  ***
+ ***           filter = only the cases whose instruction contains it       ***
+ ***      6502 bench vic [frames per mode] [ppm prefix]                    ***
+ ***      6502 bench sprites [frames per case] [ppm prefix]                ***
+ *****************************************************************************/
+int BenchMain(const C64ROMSet* rom, int argc, char** argv)
+{
+	if (argc >= 1 && strcmp(argv[0], "threads") == 0)
+	{
+		int max_threads = (argc >= 2) ? atoi(argv[1]) : HostCores();
+		int runs = (argc >= 3) ? atoi(argv[2]) : 10;
+
+		if (max_threads < 1 || runs < 1)
+		{
+			printf("error: threads and runs must be at least 1\n");
+			return 1;
+		}
+		return BenchThreads(rom, max_threads, runs);
+	}
+
+	if (argc >= 1 && strcmp(argv[0], "fork") == 0)
+	{
+		int forks = (argc >= 2) ? atoi(argv[1]) : 1000;
+		int frames = (argc >= 3) ? atoi(argv[2]) : 50;
+
+		if (forks < 1 || frames < 0)
+		{
+			printf("error: forks must be at least 1\n");
+			return 1;
+		}
+		return BenchFork(rom, forks, frames);
+	}
+
+	if (argc >= 1 && strcmp(argv[0], "ops") == 0)
+	{
+		int instructions = (argc >= 2) ? atoi(argv[1]) : 1000000;
+
+		if (instructions < 1)
+		{
+			printf("error: instructions must be at least 1\n");
+			return 1;
+		}
+		return BenchOps(rom, instructions, (argc >= 3) ? argv[2] : NULL);
+	}
+
+	if (argc >= 1 && strcmp(argv[0], "vic") == 0)
+	{
+		int frames = (argc >= 2) ? atoi(argv[1]) : 500;
+
+		if (frames < 1)
+		{
+			printf("error: frames must be at least 1\n");
+			return 1;
+		}
+		return BenchVIC(rom, frames, (argc >= 3) ? argv[2] : NULL);
+	}
+
+	if (argc >= 1 && strcmp(argv[0], "sprites") == 0)
+	{
+		int frames = (argc >= 2) ? atoi(argv[1]) : 500;
+
+		if (frames < 1)
+		{
+			printf("error: frames must be at least 1\n");
+			return 1;
+		}
+		return BenchSprites(rom, frames, (argc >= 3) ? argv[2] : NULL);
+	}
+
+	printf("usage: 6502 bench threads [max threads] [runs per thread]\n");
+	printf("       6502 bench fork [forks] [frames]\n");
+	printf("       6502 bench ops [instructions per case] [filter]\n");
+	printf("       6502 bench vic [frames per mode] [ppm prefix]\n");
+	printf("       6502 bench sprites [frames per case] [ppm prefix]\n");
+	return 1;
+}
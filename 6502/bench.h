@@ -0,0 +1,5 @@
+#pragma once
+
+#include "6502.h"
+
+int BenchMain(const C64ROMSet* rom, int argc, char** argv);
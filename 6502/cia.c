@@ -0,0 +1,340 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "6502.h"
+
+/*****************************************************************************
+ *** CIA 6526: two timers, a time of day clock and the interrupt control   ***
+ ***                                                                       ***
+ *** A timer counts down once per cycle from its latch to 0 and is loaded  ***
+ *** again on the next cycle, so it underflows every latch + 1 cycles. It  ***
+ *** is never counted: a running timer keeps its value at a cycle (since)  ***
+ *** and an event at the cycle it underflows. Reading it works the value   ***
+ *** out from the cycles in between. Timer B can count the underflows of   ***
+ *** timer A instead, then it is counted by the underflow of A.            ***
+ ***                                                                       ***
+ *** The timers start counting on the cycle they are started (the real     ***
+ *** chip waits two), CNT, the serial port and the timer outputs on port B ***
+ *** are not there.                                                        ***
+ *****************************************************************************/
+#define CIA_TOD_TENTH		(C64_CYCLES_PER_SECOND / 10)
+
+// Events per CIA, after C64_EVENT_CIA1 or C64_EVENT_CIA2
+#define CIA_TIMER_A			0
+#define CIA_TIMER_B			1
+#define CIA_TOD				2
+
+static void CIAEvent(State6510* state, int event, uint64_t cycle);
+
+static int CIANumber(uint16_t address)
+{
+	return (address >> 8) == 0xDD;
+}
+
+/*
+  1 when the timer counts cycles, not underflows of timer A (or CNT)
+*/
+static int CountsCycles(const CIA6526* cia, int timer)
+{
+	// Bit 0 = started, bit 5 (and bit 6 for B) = counts something else
+	return (cia->cr[timer] & (timer == CIA_TIMER_A ? 0x21 : 0x61)) == 0x01;
+}
+
+static uint16_t TimerValue(const CIA6526* cia, int timer, uint64_t now)
+{
+	uint64_t elapsed = now - cia->since[timer];
+
+	if (!CountsCycles(cia, timer))
+		return cia->counter[timer];
+	if (elapsed <= cia->counter[timer])
+		return (uint16_t)(cia->counter[timer] - elapsed);
+	// One shot: stopped at the underflow, the event has not run yet
+	if (cia->cr[timer] & 0x08)
+		return cia->latch[timer];
+	return (uint16_t)(cia->latch[timer] - (elapsed - cia->counter[timer] - 1) % ((uint64_t)cia->latch[timer] + 1));
+}
+
+/*
+  Takes the value of a timer now, before its mode changes
+*/
+static void FreezeTimer(CIA6526* cia, int timer, uint64_t now)
+{
+	cia->counter[timer] = TimerValue(cia, timer, now);
+	cia->since[timer] = now;
+}
+
+static void ScheduleTimer(State6510* state, int number, int timer)
+{
+	CIA6526* cia = &state->cia[number];
+	int event = (number ? C64_EVENT_CIA2 : C64_EVENT_CIA1) + timer;
+
+	if (CountsCycles(cia, timer))
+		C64_ScheduleEvent(state, event, cia->since[timer] + cia->counter[timer] + 1, CIAEvent);
+	else
+		C64_CancelEvent(state, event);
+}
+
+/*
+  CIA 1 pulls IRQ, CIA 2 NMI, from an interrupt that is not masked until
+  ICR is read
+*/
+static void UpdateLine(State6510* state, int number)
+{
+	CIA6526* cia = &state->cia[number];
+
+	if ((cia->icr & 0x80) || (cia->icr & cia->mask & 0x1F) == 0)
+		return;
+	cia->icr |= 0x80;
+	if (number == 0)
+		C64_SetIRQ(state, C64_IRQ_CIA1, 1);
+	else
+		C64_SetNMI(state, C64_NMI_CIA2, 1);
+}
+
+static void ReleaseLine(State6510* state, int number)
+{
+	if (number == 0)
+		C64_SetIRQ(state, C64_IRQ_CIA1, 0);
+	else
+		C64_SetNMI(state, C64_NMI_CIA2, 0);
+}
+
+static void Underflow(State6510* state, int number, int timer, uint64_t cycle)
+{
+	CIA6526* cia = &state->cia[number];
+
+	cia->icr |= 1 << timer;
+	if (cia->cr[timer] & 0x08)
+		cia->cr[timer] &= ~0x01;
+	cia->counter[timer] = cia->latch[timer];
+	cia->since[timer] = cycle;
+	ScheduleTimer(state, number, timer);
+	// Timer B counting the underflows of A
+	if (timer == CIA_TIMER_A && (cia->cr[1] & 0x41) == 0x41)
+	{
+		if (cia->counter[1] == 0)
+			Underflow(state, number, CIA_TIMER_B, cycle);
+		else
+			cia->counter[1]--;
+	}
+	UpdateLine(state, number);
+}
+
+/*****************************************************************************
+ *** TIME OF DAY: BCD tenths, seconds, minutes and hours 1 - 12 with PM    ***
+ ***                                                                       ***
+ *** Reading hours latches the clock until tenths is read, writing hours   ***
+ *** stops it until tenths is written. Bit 7 of CRB selects the alarm for  ***
+ *** writes.                                                               ***
+ *****************************************************************************/
+static uint8_t IncrementBCD(uint8_t value)
+{
+	value++;
+	if ((value & 0x0F) == 0x0A)
+		value += 6;
+	return value;
+}
+
+static void TickTOD(State6510* state, int number, uint64_t cycle)
+{
+	CIA6526* cia = &state->cia[number];
+	uint8_t* tod = cia->tod;
+
+	tod[0] = IncrementBCD(tod[0]);
+	if (tod[0] == 0x10)
+	{
+		tod[0] = 0;
+		tod[1] = IncrementBCD(tod[1]);
+	}
+	if (tod[1] == 0x60)
+	{
+		tod[1] = 0;
+		tod[2] = IncrementBCD(tod[2]);
+	}
+	if (tod[2] == 0x60)
+	{
+		uint8_t hours = tod[3] & 0x1F;
+
+		tod[2] = 0;
+		if (hours == 0x11)
+			tod[3] = ((tod[3] ^ 0x80) & 0x80) | 0x12;
+		else
+			tod[3] = (tod[3] & 0x80) | (hours == 0x12 ? 0x01 : IncrementBCD(hours));
+	}
+	if (memcmp(tod, cia->alarm, 4) == 0)
+	{
+		cia->icr |= 0x04;
+		UpdateLine(state, number);
+	}
+	C64_ScheduleEvent(state, (number ? C64_EVENT_CIA2 : C64_EVENT_CIA1) + CIA_TOD, cycle + CIA_TOD_TENTH, CIAEvent);
+}
+
+static void WriteTOD(State6510* state, int number, int reg, uint8_t value)
+{
+	static const uint8_t bits[4] = { 0x0F, 0x7F, 0x7F, 0x9F };
+	CIA6526* cia = &state->cia[number];
+	int event = (number ? C64_EVENT_CIA2 : C64_EVENT_CIA1) + CIA_TOD;
+
+	if (cia->cr[1] & 0x80)
+	{
+		cia->alarm[reg] = value & bits[reg];
+		return;
+	}
+	cia->tod[reg] = value & bits[reg];
+	if (reg == 3)
+	{
+		cia->tod_stopped = 1;
+		C64_CancelEvent(state, event);
+	}
+	else if (reg == 0 && cia->tod_stopped)
+	{
+		cia->tod_stopped = 0;
+		C64_ScheduleEvent(state, event, state->cycles + CIA_TOD_TENTH, CIAEvent);
+	}
+}
+
+static uint8_t ReadTOD(CIA6526* cia, int reg)
+{
+	uint8_t value;
+
+	if (reg == 3 && !cia->tod_latched)
+	{
+		memcpy(cia->tod_latch, cia->tod, 4);
+		cia->tod_latched = 1;
+	}
+	value = cia->tod_latched ? cia->tod_latch[reg] : cia->tod[reg];
+	if (reg == 0)
+		cia->tod_latched = 0;
+	return value;
+}
+
+static void CIAEvent(State6510* state, int event, uint64_t cycle)
+{
+	int number = event >= C64_EVENT_CIA2;
+	int which = event - (number ? C64_EVENT_CIA2 : C64_EVENT_CIA1);
+
+	if (which == CIA_TOD)
+		TickTOD(state, number, cycle);
+	else
+		Underflow(state, number, which, cycle);
+}
+
+/*****************************************************************************
+ *** REGISTERS: $DC00 - $DC0F, repeated up to $DCFF, the same at $DD00     ***
+ *****************************************************************************/
+static uint8_t ReadCIA(State6510* state, uint16_t address)
+{
+	int number = CIANumber(address);
+	CIA6526* cia = &state->cia[number];
+	int reg = address & 0x0F;
+	uint8_t value;
+
+	switch (reg)
+	{
+	case 0x0: return cia->pra | ~cia->ddra; // inputs read 1
+	case 0x1: return cia->prb | ~cia->ddrb;
+	case 0x2: return cia->ddra;
+	case 0x3: return cia->ddrb;
+	case 0x4: return TimerValue(cia, CIA_TIMER_A, state->cycles) & 0xFF;
+	case 0x5: return TimerValue(cia, CIA_TIMER_A, state->cycles) >> 8;
+	case 0x6: return TimerValue(cia, CIA_TIMER_B, state->cycles) & 0xFF;
+	case 0x7: return TimerValue(cia, CIA_TIMER_B, state->cycles) >> 8;
+	case 0xC: return cia->sdr;
+	case 0xD:
+		// Reading clears the interrupts and releases the line
+		value = cia->icr;
+		cia->icr = 0;
+		if (value & 0x80)
+			ReleaseLine(state, number);
+		return value;
+	case 0xE: return cia->cr[0];
+	case 0xF: return cia->cr[1];
+	default:  return ReadTOD(cia, reg - 0x8);
+	}
+}
+
+static void WriteCIA(State6510* state, uint16_t address, uint8_t value)
+{
+	int number = CIANumber(address);
+	CIA6526* cia = &state->cia[number];
+	int reg = address & 0x0F;
+	int timer = (reg >> 1) & 1;
+
+	switch (reg)
+	{
+	case 0x0: cia->pra = value; break;
+	case 0x1: cia->prb = value; break;
+	case 0x2: cia->ddra = value; break;
+	case 0x3: cia->ddrb = value; break;
+	case 0x4:
+	case 0x6:
+		cia->latch[timer] = (cia->latch[timer] & 0xFF00) | value;
+		break;
+	case 0x5:
+	case 0x7:
+		cia->latch[timer] = (cia->latch[timer] & 0x00FF) | (value << 8);
+		// A stopped timer is loaded with the latch
+		if (!(cia->cr[timer] & 0x01))
+		{
+			cia->counter[timer] = cia->latch[timer];
+			cia->since[timer] = state->cycles;
+		}
+		break;
+	case 0xC: cia->sdr = value; break;
+	case 0xD:
+		// Bit 7 = 1 sets the mask bits that are 1, 0 clears them
+		if (value & 0x80)
+			cia->mask |= value & 0x1F;
+		else
+			cia->mask &= ~value;
+		UpdateLine(state, number);
+		break;
+	case 0xE:
+	case 0xF:
+		timer = reg - 0xE;
+		FreezeTimer(cia, timer, state->cycles);
+		// Bit 4 loads the latch once, it is not kept
+		if (value & 0x10)
+			cia->counter[timer] = cia->latch[timer];
+		cia->cr[timer] = value & ~0x10;
+		ScheduleTimer(state, number, timer);
+		break;
+	default:
+		WriteTOD(state, number, reg - 0x8, value);
+		break;
+	}
+}
+
+/*
+  Both CIAs to the state after a reset: timers stopped with all bits of
+  the latches set, no interrupts, the clock stopped at 1:00:00.0
+*/
+void C64_ResetCIAs(State6510* state)
+{
+	for (int number = 0; number < 2; number++)
+	{
+		CIA6526* cia = &state->cia[number];
+		int event = number ? C64_EVENT_CIA2 : C64_EVENT_CIA1;
+
+		memset(cia, 0, sizeof(*cia));
+		cia->latch[0] = cia->latch[1] = 0xFFFF;
+		cia->counter[0] = cia->counter[1] = 0xFFFF;
+		cia->tod[3] = 0x01;
+		cia->tod_stopped = 1;
+		C64_CancelEvent(state, event + CIA_TIMER_A);
+		C64_CancelEvent(state, event + CIA_TIMER_B);
+		C64_CancelEvent(state, event + CIA_TOD);
+		ReleaseLine(state, number);
+	}
+}
+
+/*
+  Puts CIA 1 at $DC00 and CIA 2 at $DD00, reset. Reset6510 resets them
+  again, they stay attached.
+*/
+void C64_AttachCIAs(State6510* state)
+{
+	C64_SetIOChip(state, 0xDC, ReadCIA, WriteCIA);
+	C64_SetIOChip(state, 0xDD, ReadCIA, WriteCIA);
+	C64_ResetCIAs(state);
+}
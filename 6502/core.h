@@ -0,0 +1,149 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "6502.h"
+
+/*
+	Internal to the 6510 core (6502.c and jit.c)
+*/
+
+/*****************************************************************************
+ *** DISPATCH ENGINE                                                       ***
+ *** Select at build time with /DCPU_DISPATCH=... (see Run6510)            ***
+ *****************************************************************************/
+#define CPU_DISPATCH_SWITCH		0
+#define CPU_DISPATCH_TABLE		1
+#define CPU_DISPATCH_THREADED	2
+#define CPU_DISPATCH_BLOCKS		3
+#define CPU_DISPATCH_JIT		4
+
+#ifndef CPU_DISPATCH
+#if defined(__GNUC__)
+#define CPU_DISPATCH CPU_DISPATCH_THREADED
+#else
+#define CPU_DISPATCH CPU_DISPATCH_TABLE
+#endif
+#endif
+
+#if CPU_DISPATCH == CPU_DISPATCH_THREADED && !defined(__GNUC__)
+#error "CPU_DISPATCH_THREADED needs computed goto (GCC or Clang)"
+#endif
+
+#if CPU_DISPATCH == CPU_DISPATCH_JIT && !(defined(__x86_64__) || defined(_M_X64))
+#error "CPU_DISPATCH_JIT generates x86-64 code"
+#endif
+
+/*
+	Instruction trace (see trace.h): /DCPU_TRACE=0 removes the check for
+	state->trace from the dispatch loops
+*/
+#ifndef CPU_TRACE
+#define CPU_TRACE 1
+#endif
+
+/*
+	Execution profile (see profile.h): off unless built with /DCPU_PROFILE=1,
+	then the dispatch loops count every instruction while state->profile
+	is set
+*/
+#ifndef CPU_PROFILE
+#define CPU_PROFILE 0
+#endif
+
+#if defined(_MSC_VER)
+#define INLINE __forceinline
+#else
+#define INLINE inline __attribute__((always_inline))
+#endif
+
+/*****************************************************************************
+ *** OPCODE TABLES (disasm.c)                                              ***
+ *** Shared by the disassembler, the block decoder and the benchmarks     ***
+ *****************************************************************************/
+enum AddressingMode6510 {
+	AM_IMP, AM_ACC, AM_IMM, AM_ZPG, AM_ZPX, AM_ZPY, AM_ABS,
+	AM_ABX, AM_ABY, AM_IND, AM_INX, AM_INY, AM_REL
+};
+
+#define FLOW_NEXT	0	// continues with the next instruction
+#define FLOW_JUMP	1	// may load PC (branches, JMP, JSR, RTS, RTI, BRK)
+#define FLOW_UNIMPL	2	// UnimplementedInstruction, PC only advances by one
+
+extern const char Mnemonic6510[256][4];
+extern const uint8_t AddrMode6510[256];
+extern const uint8_t ModeLength6510[13]; // per addressing mode
+extern const uint8_t Flow6510[256];
+
+/*****************************************************************************
+ *** ROM IMAGES (romdata.c, generated by rom/embed.py)                     ***
+ *****************************************************************************/
+extern const uint8_t BasicROM6510[8192];
+extern const uint8_t KernalROM6510[8192];
+extern const uint8_t CharROM6510[4096];
+
+/*****************************************************************************
+ *** BLOCK CACHE                                                           ***
+ ***                                                                       ***
+ *** With CPU_DISPATCH_BLOCKS and CPU_DISPATCH_JIT the code is decoded     ***
+ *** once into basic blocks: straight runs of instructions that end with a ***
+ *** branch, jump, return, BRK or an unimplemented opcode. A block keeps   ***
+ *** the handler, operands, addressing mode and base cycles of every       ***
+ *** instruction, so running it again does not read or decode anything.    ***
+ *** Blocks are found by PC in a direct mapped table.                      ***
+ ***                                                                       ***
+ *** Every byte of cached code is marked in a bitmap and its page is taken ***
+ *** off the Poke fast path. A write into marked code drops the blocks on  ***
+ *** that page, a write to the processor port (bank switch) drops them     ***
+ *** all. Code in I/O pages is never cached.                               ***
+ *****************************************************************************/
+#define CPU_BLOCK_CACHE			(CPU_DISPATCH == CPU_DISPATCH_BLOCKS || CPU_DISPATCH == CPU_DISPATCH_JIT)
+#define BLOCK_CACHE_ENTRIES		1024	// power of two
+#define BLOCK_MAX_OPS			16
+
+typedef void (*OpHandler6510)(State6510* state, uint8_t opcode1, uint8_t opcode2);
+typedef void (*JitCode6510)(State6510* state);
+
+typedef struct DecodedOp6510 {
+	OpHandler6510 handler;
+	uint8_t opcode0;
+	uint8_t opcode1;
+	uint8_t opcode2;
+	uint8_t mode;   // AddressingMode6510
+	uint8_t length; // bytes
+	uint8_t cycles; // base cycles, the handler adds the penalties
+} DecodedOp6510;
+
+typedef struct Block6510 {
+	uint16_t pc;    // address of the first instruction
+	uint16_t end;   // address after the last instruction
+	uint8_t  valid;
+	uint8_t  count; // instructions in ops
+	uint32_t runs;  // times run since it was decoded
+	JitCode6510 code; // native code, NULL = not translated (yet)
+	DecodedOp6510 ops[BLOCK_MAX_OPS];
+} Block6510;
+
+struct BlockCache6510 {
+	uint32_t epoch;            // changes whenever blocks are dropped
+	uint8_t  codepage[256];    // 1 = page holds cached code
+	uint8_t  code[0x10000 / 8]; // 1 bit per byte of cached code
+	BlockCacheStats6510 stats;
+	Block6510 blocks[BLOCK_CACHE_ENTRIES];
+	uint8_t  *jit_code;        // arena for the translated blocks, NULL until the first
+	uint8_t  jit_failed;       // 1 = the arena could not be allocated, nothing is translated
+	size_t   jit_used;         // bytes in use, the arena is emptied by a flush
+	State6510 *jit_check;      // reference machine for the differential check
+};
+
+/*****************************************************************************
+ *** JIT                                                                   ***
+ ***                                                                       ***
+ *** With CPU_DISPATCH_JIT a block that has run JIT_THRESHOLD times is     ***
+ *** translated to x86-64 code, see jit.c.                                 ***
+ *****************************************************************************/
+#define JIT_THRESHOLD			8
+#define JIT_ARENA_SIZE			(4 * 1024 * 1024)
+
+int JitCompileBlock(State6510* state, Block6510* block);
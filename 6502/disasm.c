@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "core.h"
+
+/*****************************************************************************
+ *** Mnemonic per opcode, undocumented opcodes included                    ***
+ *****************************************************************************/
+const char Mnemonic6510[256][4] =
+{
+/*	 0      1      2      3      4      5      6      7      8      9      A      B      C      D      E      F */
+	"BRK", "ORA", "JAM", "SLO", "NOP", "ORA", "ASL", "SLO", "PHP", "ORA", "ASL", "ANC", "NOP", "ORA", "ASL", "SLO", // 0
+	"BPL", "ORA", "JAM", "SLO", "NOP", "ORA", "ASL", "SLO", "CLC", "ORA", "NOP", "SLO", "NOP", "ORA", "ASL", "SLO", // 1
+	"JSR", "AND", "JAM", "RLA", "BIT", "AND", "ROL", "RLA", "PLP", "AND", "ROL", "ANC", "BIT", "AND", "ROL", "RLA", // 2
+	"BMI", "AND", "JAM", "RLA", "NOP", "AND", "ROL", "RLA", "SEC", "AND", "NOP", "RLA", "NOP", "AND", "ROL", "RLA", // 3
+	"RTI", "EOR", "JAM", "SRE", "NOP", "EOR", "LSR", "SRE", "PHA", "EOR", "LSR", "ASR", "JMP", "EOR", "LSR", "SRE", // 4
+	"BVC", "EOR", "JAM", "SRE", "NOP", "EOR", "LSR", "SRE", "CLI", "EOR", "NOP", "SRE", "NOP", "EOR", "LSR", "SRE", // 5
+	"RTS", "ADC", "JAM", "RRA", "NOP", "ADC", "ROR", "RRA", "PLA", "ADC", "ROR", "ARR", "JMP", "ADC", "ROR", "RRA", // 6
+	"BVS", "ADC", "JAM", "RRA", "NOP", "ADC", "ROR", "RRA", "SEI", "ADC", "NOP", "RRA", "NOP", "ADC", "ROR", "RRA", // 7
+	"NOP", "STA", "NOP", "SAX", "STY", "STA", "STX", "SAX", "DEY", "NOP", "TXA", "ANE", "STY", "STA", "STX", "SAX", // 8
+	"BCC", "STA", "JAM", "SHA", "STY", "STA", "STX", "SAX", "TYA", "STA", "TXS", "SHS", "SHY", "STA", "SHX", "SHA", // 9
+	"LDY", "LDA", "LDX", "LAX", "LDY", "LDA", "LDX", "LAX", "TAY", "LDA", "TAX", "LXA", "LDY", "LDA", "LDX", "LAX", // A
+	"BCS", "LDA", "JAM", "LAX", "LDY", "LDA", "LDX", "LAX", "CLV", "LDA", "TSX", "LAE", "LDY", "LDA", "LDX", "LAX", // B
+	"CPY", "CMP", "NOP", "DCP", "CPY", "CMP", "DEC", "DCP", "INY", "CMP", "DEX", "SBX", "CPY", "CMP", "DEC", "DCP", // C
+	"BNE", "CMP", "JAM", "DCP", "NOP", "CMP", "DEC", "DCP", "CLD", "CMP", "NOP", "DCP", "NOP", "CMP", "DEC", "DCP", // D
+	"CPX", "SBC", "NOP", "ISB", "CPX", "SBC", "INC", "ISB", "INX", "SBC", "NOP", "SBC", "CPX", "SBC", "INC", "ISB", // E
+	"BEQ", "SBC", "JAM", "ISB", "NOP", "SBC", "INC", "ISB", "SED", "SBC", "NOP", "ISB", "NOP", "SBC", "INC", "ISB"  // F
+};
+
+/*****************************************************************************
+ *** Addressing mode per opcode                                            ***
+ *****************************************************************************/
+const uint8_t AddrMode6510[256] =
+{
+/*	 0       1       2       3       4       5       6       7       8       9       A       B       C       D       E       F */
+	AM_IMP, AM_INX, AM_IMP, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_ACC, AM_IMM, AM_ABS, AM_ABS, AM_ABS, AM_ABS, // 0
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPX, AM_ZPX, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABX, AM_ABX, // 1
+	AM_ABS, AM_INX, AM_IMP, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_ACC, AM_IMM, AM_ABS, AM_ABS, AM_ABS, AM_ABS, // 2
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPX, AM_ZPX, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABX, AM_ABX, // 3
+	AM_IMP, AM_INX, AM_IMP, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_ACC, AM_IMM, AM_ABS, AM_ABS, AM_ABS, AM_ABS, // 4
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPX, AM_ZPX, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABX, AM_ABX, // 5
+	AM_IMP, AM_INX, AM_IMP, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_ACC, AM_IMM, AM_IND, AM_ABS, AM_ABS, AM_ABS, // 6
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPX, AM_ZPX, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABX, AM_ABX, // 7
+	AM_IMM, AM_INX, AM_IMM, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_IMP, AM_IMM, AM_ABS, AM_ABS, AM_ABS, AM_ABS, // 8
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPY, AM_ZPY, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABY, AM_ABY, // 9
+	AM_IMM, AM_INX, AM_IMM, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_IMP, AM_IMM, AM_ABS, AM_ABS, AM_ABS, AM_ABS, // A
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPY, AM_ZPY, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABY, AM_ABY, // B
+	AM_IMM, AM_INX, AM_IMM, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_IMP, AM_IMM, AM_ABS, AM_ABS, AM_ABS, AM_ABS, // C
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPX, AM_ZPX, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABX, AM_ABX, // D
+	AM_IMM, AM_INX, AM_IMM, AM_INX, AM_ZPG, AM_ZPG, AM_ZPG, AM_ZPG, AM_IMP, AM_IMM, AM_IMP, AM_IMM, AM_ABS, AM_ABS, AM_ABS, AM_ABS, // E
+	AM_REL, AM_INY, AM_IMP, AM_INY, AM_ZPX, AM_ZPX, AM_ZPX, AM_ZPX, AM_IMP, AM_ABY, AM_IMP, AM_ABY, AM_ABX, AM_ABX, AM_ABX, AM_ABX  // F
+};
+
+// Instruction length per addressing mode
+const uint8_t ModeLength6510[13] = { 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 2, 2, 2 };
+
+/*****************************************************************************
+ *** Control flow per opcode                                               ***
+ ***   FLOW_NEXT   = continues with the next instruction                   ***
+ ***   FLOW_JUMP   = may load PC (branches, JMP, JSR, RTS, RTI, BRK)       ***
+ ***   FLOW_UNIMPL = UnimplementedInstruction, PC only advances by one     ***
+ *****************************************************************************/
+const uint8_t Flow6510[256] =
+{
+/*	 0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F */
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 2, // 0
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 2, 0, 0, 2, // 1
+	 1, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, // 2
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 2, 0, 0, 2, // 3
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 0, 2, 1, 0, 0, 2, // 4
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 2, 0, 0, 2, // 5
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 0, 2, 1, 0, 0, 2, // 6
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 2, 0, 0, 2, // 7
+	 2, 0, 2, 2, 0, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 2, // 8
+	 1, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 2, 2, // 9
+	 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, // A
+	 1, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, // B
+	 0, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, // C
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 2, 0, 0, 2, // D
+	 0, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, // E
+	 1, 0, 2, 2, 2, 0, 0, 2, 0, 0, 2, 2, 2, 0, 0, 2  // F
+};
+
+/*****************************************************************************
+ *** Formatting                                                            ***
+ *** Hand written instead of sprintf, this runs for every line of a ROM or ***
+ *** trace                                                                 ***
+ *****************************************************************************/
+static const char Hex[] = "0123456789ABCDEF";
+
+static INLINE char* PutHex8(char* p, uint8_t value)
+{
+	p[0] = Hex[value >> 4];
+	p[1] = Hex[value & 15];
+	return p + 2;
+}
+
+static INLINE char* PutHex16(char* p, uint16_t value)
+{
+	return PutHex8(PutHex8(p, (uint8_t)(value >> 8)), (uint8_t)value);
+}
+
+static INLINE char* PutText(char* p, const char* text)
+{
+	while (*text)
+		*p++ = *text++;
+	return p;
+}
+
+/*
+  Writes one line "PC   bytes     MNE operand" (no newline, no '\0') for
+  the instruction at pc with the bytes code[0..2]
+
+  returns the end of the line
+*/
+static char* FormatInstruction(char* p, uint16_t pc, const uint8_t* code)
+{
+	uint8_t mode = AddrMode6510[code[0]];
+	uint8_t length = ModeLength6510[mode];
+	uint16_t address = (uint16_t)(code[1] | (code[2] << 8));
+
+	p = PutHex16(p, pc);
+	*p++ = ' ';
+	p = PutHex8(p, code[0]);
+	*p++ = ' ';
+	if (length > 1)
+		p = PutHex8(p, code[1]);
+	else
+		p = PutText(p, "  ");
+	*p++ = ' ';
+	if (length > 2)
+		p = PutHex8(p, code[2]);
+	else
+		p = PutText(p, "  ");
+	p = PutText(p, "  ");
+	p = PutText(p, Mnemonic6510[code[0]]);
+
+	switch (mode)
+	{
+		case AM_IMP: break;
+		case AM_ACC: p = PutText(p, " A"); break;
+		case AM_IMM: p = PutHex8(PutText(p, " #$"), code[1]); break;
+		case AM_ZPG: p = PutHex8(PutText(p, " $"), code[1]); break;
+		case AM_ZPX: p = PutText(PutHex8(PutText(p, " $"), code[1]), ",X"); break;
+		case AM_ZPY: p = PutText(PutHex8(PutText(p, " $"), code[1]), ",Y"); break;
+		case AM_ABS: p = PutHex16(PutText(p, " $"), address); break;
+		case AM_ABX: p = PutText(PutHex16(PutText(p, " $"), address), ",X"); break;
+		case AM_ABY: p = PutText(PutHex16(PutText(p, " $"), address), ",Y"); break;
+		case AM_IND: p = PutText(PutHex16(PutText(p, " ($"), address), ")"); break;
+		case AM_INX: p = PutText(PutHex8(PutText(p, " ($"), code[1]), ",X)"); break;
+		case AM_INY: p = PutText(PutHex8(PutText(p, " ($"), code[1]), "),Y"); break;
+		case AM_REL: p = PutHex16(PutText(p, " $"), (uint16_t)(pc + 2 + (int8_t)code[1])); break;
+	}
+	return p;
+}
+
+/*****************************************************************************
+ *** DISASSEMBLE INSTRUCTION: One instruction into line                    ***
+ *** code holds the 3 bytes at pc, line at least DISASSEMBLY_LINE chars    ***
+ *** Branch targets are shown as addresses                                 ***
+ ***                                                                       ***
+ *** returns the number of bytes of the op                                 ***
+ *****************************************************************************/
+int DisassembleInstruction6510(uint16_t pc, const uint8_t* code, char* line)
+{
+	*FormatInstruction(line, pc, code) = '\0';
+	return ModeLength6510[AddrMode6510[code[0]]];
+}
+
+/*****************************************************************************
+ *** Disassemble the instruction at pc to stdout, read through Peek        ***
+ ***                                                                       ***
+ *** returns the number of bytes of the op                                 ***
+ *****************************************************************************/
+int Disassemble6510Op(State6510* state, uint16_t pc)
+{
+	uint8_t code[3];
+	char line[DISASSEMBLY_LINE];
+	int length;
+
+	code[0] = Peek(state, pc);
+	code[1] = Peek(state, pc + 1);
+	code[2] = Peek(state, pc + 2);
+	length = DisassembleInstruction6510(pc, code, line);
+	puts(line);
+	return length;
+}
+
+/*****************************************************************************
+ *** DISASSEMBLE RANGE: A whole code image (a ROM, a PRG) into buffer      ***
+ *** image[0] is at address origin. One line per instruction, each ending  ***
+ *** with '\n'; an instruction cut off by the end of the image is shown as ***
+ *** .BYTE. Stops before the first line that does not fit in buffer, a     ***
+ *** buffer of size * DISASSEMBLY_LINE chars always holds everything.       ***
+ ***                                                                       ***
+ *** returns the number of chars in buffer (not counting the '\0')        ***
+ *****************************************************************************/
+size_t Disassemble6510Range(const uint8_t* image, size_t size, uint16_t origin, char* buffer, size_t buffer_size)
+{
+	char* p = buffer;
+	char* end = buffer + buffer_size;
+	size_t offset = 0;
+
+	while (offset < size && end - p >= DISASSEMBLY_LINE)
+	{
+		uint16_t pc = (uint16_t)(origin + offset);
+		const uint8_t* code = image + offset;
+		size_t length = ModeLength6510[AddrMode6510[code[0]]];
+
+		if (length > size - offset)
+		{
+			p = PutHex16(p, pc);
+			*p++ = ' ';
+			p = PutHex8(p, code[0]);
+			p = PutText(p, "        .BYTE $");
+			p = PutHex8(p, code[0]);
+			length = 1;
+		}
+		else
+			p = FormatInstruction(p, pc, code);
+		*p++ = '\n';
+		offset += length;
+	}
+	if (p < end)
+		*p = '\0';
+	return (size_t)(p - buffer);
+}
+
+/*****************************************************************************
+ *** DISASSEMBLE MEMORY: The range from..to (inclusive) as the CPU sees it ***
+ *** ROM where it is banked in, RAM under the I/O pages. Reads no I/O      ***
+ *** registers, so unlike Peek it has no side effects.                     ***
+ ***                                                                       ***
+ *** returns the number of chars in buffer, see Disassemble6510Range       ***
+ *****************************************************************************/
+size_t Disassemble6510Memory(State6510* state, uint16_t from, uint16_t to, char* buffer, size_t buffer_size)
+{
+	uint8_t* image = (uint8_t*)malloc(0x10000);
+	size_t size = (size_t)to - from + 1;
+	size_t result;
+	int page;
+
+	if (image == NULL || to < from)
+	{
+		free(image);
+		return 0;
+	}
+	for (page = 0x00; page <= 0xFF; page++)
+	{
+		const uint8_t* source = state->readmap[page];
+
+		if (source == NULL)
+			source = state->cow[page] != NULL ? state->cow[page] : state->memory + (page << 8);
+		memcpy(image + (page << 8), source, 0x100);
+	}
+	result = Disassemble6510Range(image + from, size, from, buffer, buffer_size);
+	free(image);
+	return result;
+}
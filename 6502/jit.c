@@ -0,0 +1,532 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "6502.h"
+#include "core.h"
+#include "platform.h"
+
+#if CPU_DISPATCH == CPU_DISPATCH_JIT
+
+/*****************************************************************************
+ *** JIT: Translate a decoded block to x86-64 code                         ***
+ ***                                                                       ***
+ *** The generated function is void code(State6510* state). It keeps the  ***
+ *** state in rbx and the cache epoch seen on entry in r12d, rax, rcx and  ***
+ *** rdx are scratch.                                                      ***
+ ***                                                                       ***
+ *** Loads, stores, ALU, compare, transfer, flag and branch instructions   ***
+ *** with immediate, zeropage, absolute or implied operands are translated ***
+ *** (see JitNative). Memory is accessed through the page tables, a page   ***
+ *** that is off the fast path (I/O, handler, cached code) takes a slow    ***
+ *** path that calls the opcode handler. Every other instruction always    ***
+ *** calls its handler, so the code is correct for any opcode.             ***
+ ***                                                                       ***
+ *** Like RunDecodedBlock the code leaves the block after an instruction   ***
+ *** when the budget is used up or when a handler changed the cache epoch  ***
+ *** (a write into cached code or a bank switch), with PC pointing at the  ***
+ *** next instruction. The translated instructions only store PC once they ***
+ *** are done, the handlers keep it up to date themselves.                 ***
+ *****************************************************************************/
+#define JIT_MAX_OP_CODE		160		// bytes one instruction can take, at most
+#define JIT_MAX_BLOCK_CODE	(BLOCK_MAX_OPS * JIT_MAX_OP_CODE + 64)
+#define JIT_MAX_EXITS		(BLOCK_MAX_OPS * 3)
+
+#define STATE(field)		((uint32_t)offsetof(State6510, field))
+
+// x86 registers
+#define RAX		0
+#define RCX		1
+#define RDX		2
+#define RBX		3
+
+// Condition codes for Jcc
+#define CC_Z	0x4
+#define CC_NZ	0x5
+#define CC_AE	0x3
+
+typedef struct Emitter6510 {
+	uint8_t *code;	// start of the function
+	uint8_t *p;		// next byte
+	uint8_t *exits[JIT_MAX_EXITS];	// rel32 of the jumps to the epilogue
+	int exit_count;
+} Emitter6510;
+
+/*
+  How an opcode is translated, JIT_CALL = through its handler
+*/
+enum JitKind6510 {
+	JIT_CALL, JIT_LOAD, JIT_STORE, JIT_AND, JIT_ORA, JIT_EOR, JIT_COMPARE,
+	JIT_TRANSFER, JIT_INC, JIT_DEC, JIT_FLAG, JIT_NOP, JIT_BRANCH
+};
+
+typedef struct JitNative6510 {
+	int kind;
+	uint32_t reg;	// register (offset in State6510) read or written
+	uint32_t reg2;	// JIT_TRANSFER: destination register
+} JitNative6510;
+
+/*****************************************************************************
+ *** Emitters                                                              ***
+ *****************************************************************************/
+static void Emit8(Emitter6510* e, uint8_t value)
+{
+	*e->p++ = value;
+}
+
+static void Emit32(Emitter6510* e, uint32_t value)
+{
+	memcpy(e->p, &value, 4);
+	e->p += 4;
+}
+
+static void Emit64(Emitter6510* e, uint64_t value)
+{
+	memcpy(e->p, &value, 8);
+	e->p += 8;
+}
+
+// ModRM for [base + disp32] with a register or opcode extension in reg
+static void EmitMem(Emitter6510* e, uint8_t reg, uint8_t base, uint32_t disp)
+{
+	Emit8(e, 0x80 | (reg << 3) | base);
+	Emit32(e, disp);
+}
+
+// movzx reg32, byte [rbx + offset]
+static void EmitLoadState(Emitter6510* e, uint8_t reg, uint32_t offset)
+{
+	Emit8(e, 0x0F);
+	Emit8(e, 0xB6);
+	EmitMem(e, reg, RBX, offset);
+}
+
+// mov byte [rbx + offset], reg8
+static void EmitStoreState(Emitter6510* e, uint8_t reg, uint32_t offset)
+{
+	Emit8(e, 0x88);
+	EmitMem(e, reg, RBX, offset);
+}
+
+// mov byte [rbx + offset], imm8
+static void EmitStoreStateImm8(Emitter6510* e, uint32_t offset, uint8_t value)
+{
+	Emit8(e, 0xC6);
+	EmitMem(e, 0, RBX, offset);
+	Emit8(e, value);
+}
+
+// mov word [rbx + offset], imm16
+static void EmitStoreStateImm16(Emitter6510* e, uint32_t offset, uint16_t value)
+{
+	Emit8(e, 0x66);
+	Emit8(e, 0xC7);
+	EmitMem(e, 0, RBX, offset);
+	Emit8(e, value & 0xFF);
+	Emit8(e, value >> 8);
+}
+
+// add qword [rbx + cycles], imm8
+static void EmitAddCycles(Emitter6510* e, uint8_t cycles)
+{
+	Emit8(e, 0x48);
+	Emit8(e, 0x83);
+	EmitMem(e, 0, RBX, STATE(cycles));
+	Emit8(e, cycles);
+}
+
+// inc qword [rbx + instructions]
+static void EmitCountInstruction(Emitter6510* e)
+{
+	Emit8(e, 0x48);
+	Emit8(e, 0xFF);
+	EmitMem(e, 0, RBX, STATE(instructions));
+}
+
+// mov rax, qword [rbx + offset]
+static void EmitLoadStateQword(Emitter6510* e, uint32_t offset)
+{
+	Emit8(e, 0x48);
+	Emit8(e, 0x8B);
+	EmitMem(e, RAX, RBX, offset);
+}
+
+// Jcc rel32, returns the rel32 to patch
+static uint8_t* EmitJcc(Emitter6510* e, uint8_t condition)
+{
+	Emit8(e, 0x0F);
+	Emit8(e, 0x80 | condition);
+	Emit32(e, 0);
+	return e->p - 4;
+}
+
+// jmp rel32, returns the rel32 to patch
+static uint8_t* EmitJmp(Emitter6510* e)
+{
+	Emit8(e, 0xE9);
+	Emit32(e, 0);
+	return e->p - 4;
+}
+
+// Points a rel32 at the current position
+static void PatchHere(Emitter6510* e, uint8_t* rel32)
+{
+	int32_t distance = (int32_t)(e->p - (rel32 + 4));
+
+	memcpy(rel32, &distance, 4);
+}
+
+static void EmitExit(Emitter6510* e, uint8_t condition)
+{
+	e->exits[e->exit_count++] = EmitJcc(e, condition);
+}
+
+// Store the low byte of reg in the N and Z results
+static void EmitSetNZ(Emitter6510* e, uint8_t reg)
+{
+	EmitStoreState(e, reg, STATE(sr.n_result));
+	EmitStoreState(e, reg, STATE(sr.z_result));
+}
+
+// Store the low byte of reg in a 6510 register and in the N and Z results
+static void EmitSetResult(Emitter6510* e, uint8_t reg, uint32_t offset)
+{
+	EmitStoreState(e, reg, offset);
+	EmitSetNZ(e, reg);
+}
+
+// Calls the opcode handler: handler(state, opcode1, opcode2)
+static void EmitCall(Emitter6510* e, const DecodedOp6510* op)
+{
+#if defined(_WIN32)
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xD9);	// mov rcx, rbx
+	Emit8(e, 0xBA); Emit32(e, op->opcode1);			// mov edx, opcode1
+	Emit8(e, 0x41); Emit8(e, 0xB8); Emit32(e, op->opcode2);	// mov r8d, opcode2
+#else
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xDF);	// mov rdi, rbx
+	Emit8(e, 0xBE); Emit32(e, op->opcode1);			// mov esi, opcode1
+	Emit8(e, 0xBA); Emit32(e, op->opcode2);			// mov edx, opcode2
+#endif
+	Emit8(e, 0x48); Emit8(e, 0xB8); Emit64(e, (uint64_t)(uintptr_t)op->handler);	// mov rax, handler
+	Emit8(e, 0xFF); Emit8(e, 0xD0);					// call rax
+}
+
+// Leave when the cache epoch is not the one seen on entry
+static void EmitEpochCheck(Emitter6510* e)
+{
+	EmitLoadStateQword(e, STATE(blocks));
+	Emit8(e, 0x44); Emit8(e, 0x3B);					// cmp r12d, [rax + epoch]
+	EmitMem(e, 4, RAX, (uint32_t)offsetof(BlockCache6510, epoch));
+	EmitExit(e, CC_NZ);
+}
+
+// Leave when the cycle budget is used up
+static void EmitBudgetCheck(Emitter6510* e)
+{
+	EmitLoadStateQword(e, STATE(cycles));
+	Emit8(e, 0x48); Emit8(e, 0x3B);					// cmp rax, [rbx + run_until]
+	EmitMem(e, RAX, RBX, STATE(run_until));
+	EmitExit(e, CC_AE);
+}
+
+static void EmitPrologue(Emitter6510* e)
+{
+	Emit8(e, 0x53);									// push rbx
+	Emit8(e, 0x41); Emit8(e, 0x54);					// push r12
+#if defined(_WIN32)
+	Emit8(e, 0x48); Emit8(e, 0x83); Emit8(e, 0xEC); Emit8(e, 0x28);	// sub rsp, 40
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xCB);	// mov rbx, rcx
+#else
+	Emit8(e, 0x48); Emit8(e, 0x83); Emit8(e, 0xEC); Emit8(e, 0x08);	// sub rsp, 8
+	Emit8(e, 0x48); Emit8(e, 0x89); Emit8(e, 0xFB);	// mov rbx, rdi
+#endif
+	EmitLoadStateQword(e, STATE(blocks));
+	Emit8(e, 0x44); Emit8(e, 0x8B);					// mov r12d, [rax + epoch]
+	EmitMem(e, 4, RAX, (uint32_t)offsetof(BlockCache6510, epoch));
+}
+
+static void EmitEpilogue(Emitter6510* e)
+{
+	for (int i = 0; i < e->exit_count; i++)
+		PatchHere(e, e->exits[i]);
+#if defined(_WIN32)
+	Emit8(e, 0x48); Emit8(e, 0x83); Emit8(e, 0xC4); Emit8(e, 0x28);	// add rsp, 40
+#else
+	Emit8(e, 0x48); Emit8(e, 0x83); Emit8(e, 0xC4); Emit8(e, 0x08);	// add rsp, 8
+#endif
+	Emit8(e, 0x41); Emit8(e, 0x5C);					// pop r12
+	Emit8(e, 0x5B);									// pop rbx
+	Emit8(e, 0xC3);									// ret
+}
+
+/*****************************************************************************
+ *** Translation per opcode                                                ***
+ *****************************************************************************/
+static JitNative6510 JitNative(uint8_t opcode)
+{
+	JitNative6510 native = { JIT_CALL, 0, 0 };
+
+	switch (opcode)
+	{
+	case 0xA9: case 0xA5: case 0xAD: native.kind = JIT_LOAD; native.reg = STATE(A); break;
+	case 0xA2: case 0xA6: case 0xAE: native.kind = JIT_LOAD; native.reg = STATE(X); break;
+	case 0xA0: case 0xA4: case 0xAC: native.kind = JIT_LOAD; native.reg = STATE(Y); break;
+	case 0x85: case 0x8D: native.kind = JIT_STORE; native.reg = STATE(A); break;
+	case 0x86: case 0x8E: native.kind = JIT_STORE; native.reg = STATE(X); break;
+	case 0x84: case 0x8C: native.kind = JIT_STORE; native.reg = STATE(Y); break;
+	case 0x29: case 0x25: case 0x2D: native.kind = JIT_AND; break;
+	case 0x09: case 0x05: case 0x0D: native.kind = JIT_ORA; break;
+	case 0x49: case 0x45: case 0x4D: native.kind = JIT_EOR; break;
+	case 0xC9: case 0xC5: case 0xCD: native.kind = JIT_COMPARE; native.reg = STATE(A); break;
+	case 0xE0: case 0xE4: case 0xEC: native.kind = JIT_COMPARE; native.reg = STATE(X); break;
+	case 0xC0: case 0xC4: case 0xCC: native.kind = JIT_COMPARE; native.reg = STATE(Y); break;
+	case 0xAA: native.kind = JIT_TRANSFER; native.reg = STATE(A); native.reg2 = STATE(X); break;
+	case 0xA8: native.kind = JIT_TRANSFER; native.reg = STATE(A); native.reg2 = STATE(Y); break;
+	case 0x8A: native.kind = JIT_TRANSFER; native.reg = STATE(X); native.reg2 = STATE(A); break;
+	case 0x98: native.kind = JIT_TRANSFER; native.reg = STATE(Y); native.reg2 = STATE(A); break;
+	case 0xE8: native.kind = JIT_INC; native.reg = STATE(X); break;
+	case 0xC8: native.kind = JIT_INC; native.reg = STATE(Y); break;
+	case 0xCA: native.kind = JIT_DEC; native.reg = STATE(X); break;
+	case 0x88: native.kind = JIT_DEC; native.reg = STATE(Y); break;
+	// CLI (0x58) is left out, its handler lets a pending IRQ in
+	case 0x18: case 0x38: case 0xD8: case 0xF8: case 0x78: case 0xB8:
+		native.kind = JIT_FLAG; break;
+	case 0xEA: native.kind = JIT_NOP; break;
+	case 0x10: case 0x30: case 0x50: case 0x70: case 0x90: case 0xB0: case 0xD0: case 0xF0:
+		native.kind = JIT_BRANCH; break;
+	}
+	return native;
+}
+
+/*
+  Gets the operand of a load, ALU or compare into ecx (map = readmap), or
+  only the page of a store into rax (map = writemap). For a memory operand
+  the jz to the slow path is returned, NULL for an immediate.
+*/
+static uint8_t* EmitOperand(Emitter6510* e, const DecodedOp6510* op, uint32_t map)
+{
+	uint16_t address = op->mode == AM_ABS ? (uint16_t)(op->opcode1 | (op->opcode2 << 8)) : op->opcode1;
+	uint8_t* slow;
+
+	if (op->mode == AM_IMM)
+	{
+		Emit8(e, 0xB9);								// mov ecx, imm32
+		Emit32(e, op->opcode1);
+		return NULL;
+	}
+	EmitLoadStateQword(e, map + 8 * (address >> 8));	// mov rax, [rbx + map + 8 * page]
+	Emit8(e, 0x48); Emit8(e, 0x85); Emit8(e, 0xC0);	// test rax, rax
+	slow = EmitJcc(e, CC_Z);
+	if (map == STATE(readmap))
+	{
+		Emit8(e, 0x0F); Emit8(e, 0xB6);				// movzx ecx, byte [rax + low]
+		EmitMem(e, RCX, RAX, address & 0xFF);
+	}
+	return slow;
+}
+
+/*
+  Conditional branch at the end of the block. Sets the flags of the host so
+  that NZ means the condition is true.
+*/
+static void EmitBranch(Emitter6510* e, const DecodedOp6510* op, uint16_t pc)
+{
+	uint16_t next_pc = (uint16_t)(pc + 2);
+	uint16_t target = (uint16_t)(next_pc + (int8_t)op->opcode1);
+	uint8_t taken_if;
+	uint8_t* not_taken;
+	uint8_t* done;
+
+	switch (op->opcode0)
+	{
+	case 0x10: case 0x30:	// N: test byte [n_result], 0x80
+		Emit8(e, 0xF6); EmitMem(e, 0, RBX, STATE(sr.n_result)); Emit8(e, 0x80);
+		taken_if = op->opcode0 == 0x30 ? CC_NZ : CC_Z;
+		break;
+	case 0x90: case 0xB0:	// C: test byte [c_result + 1], 1
+		Emit8(e, 0xF6); EmitMem(e, 0, RBX, STATE(sr.c_result) + 1); Emit8(e, 0x01);
+		taken_if = op->opcode0 == 0xB0 ? CC_NZ : CC_Z;
+		break;
+	case 0xD0: case 0xF0:	// Z: cmp byte [z_result], 0
+		Emit8(e, 0x80); EmitMem(e, 7, RBX, STATE(sr.z_result)); Emit8(e, 0x00);
+		taken_if = op->opcode0 == 0xF0 ? CC_Z : CC_NZ;
+		break;
+	default:				// V: ((v_op1 ^ v_result) & (v_op2 ^ v_result)) & 0x80
+		EmitLoadState(e, RCX, STATE(sr.v_result));
+		EmitLoadState(e, RAX, STATE(sr.v_op1));
+		Emit8(e, 0x31); Emit8(e, 0xC8);				// xor eax, ecx
+		EmitLoadState(e, RDX, STATE(sr.v_op2));
+		Emit8(e, 0x31); Emit8(e, 0xCA);				// xor edx, ecx
+		Emit8(e, 0x21); Emit8(e, 0xD0);				// and eax, edx
+		Emit8(e, 0xA8); Emit8(e, 0x80);				// test al, 0x80
+		taken_if = op->opcode0 == 0x70 ? CC_NZ : CC_Z;
+		break;
+	}
+	not_taken = EmitJcc(e, taken_if ^ 1);
+	EmitAddCycles(e, 1 + (((next_pc ^ target) & 0xFF00) != 0));
+	EmitStoreStateImm16(e, STATE(PC), target);
+	done = EmitJmp(e);
+	PatchHere(e, not_taken);
+	EmitStoreStateImm16(e, STATE(PC), next_pc);
+	PatchHere(e, done);
+}
+
+static void EmitFlag(Emitter6510* e, uint8_t opcode)
+{
+	switch (opcode)
+	{
+	case 0x18: EmitStoreStateImm16(e, STATE(sr.c_result), 0x000); break;	// CLC
+	case 0x38: EmitStoreStateImm16(e, STATE(sr.c_result), 0x100); break;	// SEC
+	case 0xD8: EmitStoreStateImm8(e, STATE(sr.D), 0); break;				// CLD
+	case 0xF8: EmitStoreStateImm8(e, STATE(sr.D), 1); break;				// SED
+	case 0x78: EmitStoreStateImm8(e, STATE(sr.I), 1); break;				// SEI
+	case 0xB8:																// CLV
+		EmitStoreStateImm8(e, STATE(sr.v_op1), 0);
+		EmitStoreStateImm8(e, STATE(sr.v_op2), 0);
+		EmitStoreStateImm8(e, STATE(sr.v_result), 0);
+		break;
+	}
+}
+
+/*
+  One instruction. The handlers keep PC up to date, the translated code
+  stores it when it is done.
+*/
+static void EmitInstruction(Emitter6510* e, const DecodedOp6510* op, uint16_t pc)
+{
+	JitNative6510 native = JitNative(op->opcode0);
+	uint16_t address = op->mode == AM_ABS ? (uint16_t)(op->opcode1 | (op->opcode2 << 8)) : op->opcode1;
+	uint8_t* slow = NULL;
+	uint8_t* done;
+
+	// A store to the processor port goes through Poke, which rebuilds the
+	// memory map (and leaves the block) only when the banks change
+	if (native.kind == JIT_STORE && address <= 0x0001)
+		native.kind = JIT_CALL;
+
+	EmitAddCycles(e, op->cycles);
+	EmitCountInstruction(e);
+	switch (native.kind)
+	{
+	case JIT_CALL:
+		EmitCall(e, op);
+		EmitEpochCheck(e);
+		return;
+	case JIT_BRANCH:
+		EmitBranch(e, op, pc);
+		return;
+	case JIT_LOAD:
+		slow = EmitOperand(e, op, STATE(readmap));
+		EmitSetResult(e, RCX, native.reg);
+		break;
+	case JIT_STORE:
+		slow = EmitOperand(e, op, STATE(writemap));
+		EmitLoadState(e, RCX, native.reg);
+		Emit8(e, 0x88);								// mov byte [rax + low], cl
+		EmitMem(e, RCX, RAX, address & 0xFF);
+		break;
+	case JIT_AND:
+	case JIT_ORA:
+	case JIT_EOR:
+		slow = EmitOperand(e, op, STATE(readmap));
+		EmitLoadState(e, RDX, STATE(A));
+		Emit8(e, native.kind == JIT_AND ? 0x21 : native.kind == JIT_ORA ? 0x09 : 0x31);
+		Emit8(e, 0xCA);								// op edx, ecx
+		EmitSetResult(e, RDX, STATE(A));
+		break;
+	case JIT_COMPARE:
+		slow = EmitOperand(e, op, STATE(readmap));
+		EmitLoadState(e, RDX, native.reg);
+		Emit8(e, 0x29); Emit8(e, 0xCA);				// sub edx, ecx
+		EmitSetNZ(e, RDX);
+		Emit8(e, 0x81); Emit8(e, 0xC2); Emit32(e, 0x100);	// add edx, 0x100
+		Emit8(e, 0x66); Emit8(e, 0x89);				// mov word [c_result], dx
+		EmitMem(e, RDX, RBX, STATE(sr.c_result));
+		break;
+	case JIT_TRANSFER:
+		EmitLoadState(e, RCX, native.reg);
+		EmitSetResult(e, RCX, native.reg2);
+		break;
+	case JIT_INC:
+	case JIT_DEC:
+		EmitLoadState(e, RCX, native.reg);
+		Emit8(e, 0x83); Emit8(e, native.kind == JIT_INC ? 0xC1 : 0xE9); Emit8(e, 0x01);	// add/sub ecx, 1
+		EmitSetResult(e, RCX, native.reg);
+		break;
+	case JIT_FLAG:
+		EmitFlag(e, op->opcode0);
+		break;
+	case JIT_NOP:
+		break;
+	}
+	if (slow != NULL)
+	{
+		// The page is off the fast path, let the handler do it
+		done = EmitJmp(e);
+		PatchHere(e, slow);
+		EmitCall(e, op);
+		EmitEpochCheck(e);
+		PatchHere(e, done);
+	}
+	EmitStoreStateImm16(e, STATE(PC), (uint16_t)(pc + op->length));
+}
+
+/*****************************************************************************
+ *** Translate a block into the arena of the block cache                   ***
+ ***                                                                       ***
+ *** The arena is allocated when the first block gets hot, so machines     ***
+ *** that never translate anything (pools, the JIT check reference) do not ***
+ *** map it. Its pages are executable and only made writable while a block ***
+ *** is written into them.                                                 ***
+ ***                                                                       ***
+ *** returns 0 when block->code is set, 1 when the arena is full or could  ***
+ *** not be set up (then jit_failed is set)                                ***
+ *****************************************************************************/
+int JitCompileBlock(State6510* state, Block6510* block)
+{
+	BlockCache6510* cache = state->blocks;
+	Emitter6510 e;
+	uint16_t pc = block->pc;
+	size_t start = (cache->jit_used + 15) & ~(size_t)15;
+
+	if (cache->jit_code == NULL)
+		cache->jit_code = (uint8_t*)AllocateExecutable(JIT_ARENA_SIZE);
+	if (cache->jit_code == NULL)
+	{
+		cache->jit_failed = 1;
+		return 1;
+	}
+	if (start + JIT_MAX_BLOCK_CODE > JIT_ARENA_SIZE)
+		return 1;
+	e.code = e.p = cache->jit_code + start;
+	e.exit_count = 0;
+	if (ProtectExecutable(e.code, JIT_MAX_BLOCK_CODE, 1))
+	{
+		cache->jit_failed = 1;
+		return 1;
+	}
+
+	EmitPrologue(&e);
+	for (int i = 0; i < block->count; i++)
+	{
+		const DecodedOp6510* op = &block->ops[i];
+
+		EmitInstruction(&e, op, pc);
+		pc = (uint16_t)(pc + op->length);
+		if (i < block->count - 1)
+			EmitBudgetCheck(&e);
+	}
+	EmitEpilogue(&e);
+	if (ProtectExecutable(e.code, (size_t)(e.p - e.code), 0))
+	{
+		cache->jit_failed = 1;
+		return 1;
+	}
+
+	cache->jit_used = (size_t)(e.p - cache->jit_code);
+	cache->stats.compiled++;
+	block->code = (JitCode6510)(void*)e.code;
+	return 0;
+}
+
+#endif
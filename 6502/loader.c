@@ -0,0 +1,292 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "platform.h"
+
+/*****************************************************************************
+ *** LOADING PROGRAMS                                                      ***
+ ***                                                                       ***
+ *** Files are read straight into the RAM of the machine with one pread,   ***
+ *** there is no buffer in between. An archive is mapped once and its      ***
+ *** programs are copied from the mapping, no system call per program.     ***
+ *** A program has to fit below $10000, otherwise nothing is loaded.       ***
+ ***                                                                       ***
+ *** RAM is written directly, not through Poke, so the machine should not  ***
+ *** have run code at that place since Reset6510 (the block cache would    ***
+ *** not see the new code).                                                ***
+ *****************************************************************************/
+/*
+  Loads a headerless file into RAM at offset. Returns 1 when the file can
+  not be read or does not fit, without a message: the caller knows how to
+  report it.
+*/
+int C64_LoadFile(State6510* state, const char* filename, uint16_t offset)
+{
+	HostFile file;
+	uint64_t size;
+	int error;
+
+	if (OpenHostFile(filename, &file, &size))
+		return 1;
+	error = offset + size > 0x10000;
+	if (!error)
+	{
+		C64_OwnMemoryRange(state, offset, (uint32_t)size);
+		error = ReadHostFile(file, state->memory + offset, (size_t)size, 0) != size;
+	}
+	CloseHostFile(file);
+	return error;
+}
+
+/*
+  Loads a PRG file at the address in its first two bytes. start and end
+  (the first address after the program) can be NULL. Returns 1 when the
+  file can not be read, has no header or does not fit.
+*/
+int C64_LoadPRG(State6510* state, const char* filename, uint16_t* start, uint16_t* end)
+{
+	HostFile file;
+	uint64_t size;
+	uint8_t header[2] = { 0, 0 };
+	uint32_t load;
+	int error;
+
+	if (OpenHostFile(filename, &file, &size))
+		return 1;
+	error = size < 2 || ReadHostFile(file, header, 2, 0) != 2;
+	load = header[0] | (header[1] << 8);
+	if (!error)
+		error = load + (size - 2) > 0x10000;
+	if (!error)
+	{
+		C64_OwnMemoryRange(state, (uint16_t)load, (uint32_t)(size - 2));
+		error = ReadHostFile(file, state->memory + load, (size_t)(size - 2), 2) != size - 2;
+	}
+	CloseHostFile(file);
+	if (!error && start != NULL)
+		*start = (uint16_t)load;
+	if (!error && end != NULL)
+		*end = (uint16_t)(load + size - 2);
+	return error;
+}
+
+/*****************************************************************************
+ *** ARCHIVES                                                              ***
+ ***                                                                       ***
+ *** Many programs in one file, so a batch of short jobs opens one file    ***
+ *** instead of one per job. The files are stored as they are, a PRG with  ***
+ *** its header.                                                           ***
+ ***                                                                       ***
+ *** "6510PAK1", the number of members (uint32), 4 reserved bytes, then    ***
+ *** one entry per member sorted by name, then the data. Little endian.    ***
+ *****************************************************************************/
+#define ARCHIVE_MAGIC		"6510PAK1"
+#define ARCHIVE_NAME		32		// longest name with '\0'
+
+typedef struct ArchiveEntry {
+	char     name[ARCHIVE_NAME];  // the file name without its directory
+	uint32_t offset;              // from the start of the archive
+	uint32_t size;
+} ArchiveEntry;
+
+struct C64Archive {
+	const uint8_t *data;          // the whole archive, mapped
+	size_t   size;
+	uint32_t count;
+	const ArchiveEntry *entries;
+};
+
+/*
+  Maps an archive, NULL when it can not be read or is damaged
+*/
+C64Archive* C64_OpenArchive(const char* filename)
+{
+	C64Archive* archive = (C64Archive*)calloc(1, sizeof(C64Archive));
+	HostFile file;
+	uint64_t size;
+	uint8_t header[16];
+	uint32_t count = 0;
+
+	if (archive == NULL)
+		return NULL;
+	// One open: the header is read and checked, then the file is mapped
+	if (OpenHostFile(filename, &file, &size) == 0)
+	{
+		if (size >= 16 && (size_t)size == size && ReadHostFile(file, header, 16, 0) == 16 &&
+			memcmp(header, ARCHIVE_MAGIC, 8) == 0)
+		{
+			memcpy(&count, header + 8, 4);
+			if (count <= (size - 16) / sizeof(ArchiveEntry))
+				archive->data = (const uint8_t*)MapHostFile(file, (size_t)size);
+		}
+		CloseHostFile(file);
+	}
+	if (archive->data == NULL)
+	{
+		printf("error: %s is not an archive\n", filename);
+		C64_CloseArchive(archive);
+		return NULL;
+	}
+	archive->size = (size_t)size;
+	archive->count = count;
+	archive->entries = (const ArchiveEntry*)(archive->data + 16);
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if ((uint64_t)archive->entries[i].offset + archive->entries[i].size > size)
+		{
+			printf("error: %s is damaged\n", filename);
+			C64_CloseArchive(archive);
+			return NULL;
+		}
+	}
+	return archive;
+}
+
+void C64_CloseArchive(C64Archive* archive)
+{
+	if (archive == NULL)
+		return;
+	UnmapFile(archive->data, archive->size);
+	free(archive);
+}
+
+/*
+  Returns the number of the member with this name, -1 if there is none
+*/
+int C64_FindInArchive(const C64Archive* archive, const char* name)
+{
+	int low = 0;
+	int high = (int)archive->count - 1;
+
+	while (low <= high)
+	{
+		int middle = (low + high) / 2;
+		int order = strncmp(name, archive->entries[middle].name, ARCHIVE_NAME);
+
+		if (order == 0)
+			return middle;
+		if (order < 0)
+			high = middle - 1;
+		else
+			low = middle + 1;
+	}
+	return -1;
+}
+
+/*
+  Loads a member into RAM: at load when it is headerless, at the address
+  in its header with load = C64_PRG_HEADER. start and end as for
+  C64_LoadPRG. Returns 1 when it has no header or does not fit.
+*/
+int C64_LoadFromArchive(State6510* state, const C64Archive* archive, int member, int32_t load, uint16_t* start, uint16_t* end)
+{
+	const ArchiveEntry* entry = &archive->entries[member];
+	const uint8_t* data = archive->data + entry->offset;
+	uint32_t size = entry->size;
+
+	if (load == C64_PRG_HEADER)
+	{
+		if (size < 2)
+			return 1;
+		load = data[0] | (data[1] << 8);
+		data += 2;
+		size -= 2;
+	}
+	if (load < 0 || (uint32_t)load + size > 0x10000)
+		return 1;
+	C64_OwnMemoryRange(state, (uint16_t)load, size);
+	memcpy(state->memory + load, data, size);
+	if (start != NULL)
+		*start = (uint16_t)load;
+	if (end != NULL)
+		*end = (uint16_t)(load + size);
+	return 0;
+}
+
+static int CompareEntries(const void* a, const void* b)
+{
+	return strncmp(((const ArchiveEntry*)a)->name, ((const ArchiveEntry*)b)->name, ARCHIVE_NAME);
+}
+
+/*
+  Writes the files into a new archive, named without their directory.
+  Returns 1 on an error (printed).
+*/
+int C64_WriteArchive(const char* filename, int count, char** files)
+{
+	uint32_t header[2] = { (uint32_t)count, 0 };
+	ArchiveEntry* entries = (ArchiveEntry*)calloc(count > 0 ? count : 1, sizeof(ArchiveEntry));
+	uint8_t* data = NULL;
+	uint64_t used = 0;
+	FILE* f;
+	int error = entries == NULL;
+
+	for (int i = 0; i < count && !error; i++)
+	{
+		const char* name = files[i];
+		HostFile file;
+		uint64_t size;
+		uint8_t* grown;
+
+		for (const char* p = files[i]; *p; p++)
+			if (*p == '/' || *p == '\\')
+				name = p + 1;
+		if (strlen(name) >= ARCHIVE_NAME || OpenHostFile(files[i], &file, &size))
+		{
+			printf("error: Couldn't read %s (or its name is longer than %d)\n", files[i], ARCHIVE_NAME - 1);
+			error = 1;
+			break;
+		}
+		grown = (size <= 0x10002 && used + size < 0x7FFFFFFF) ? (uint8_t*)realloc(data, (size_t)(used + size + 1)) : NULL;
+		if (grown == NULL || ReadHostFile(file, grown + used, (size_t)size, 0) != size)
+		{
+			printf("error: Couldn't read %s\n", files[i]);
+			error = 1;
+		}
+		else
+		{
+			strcpy(entries[i].name, name);
+			entries[i].offset = (uint32_t)used;
+			entries[i].size = (uint32_t)size;
+			used += size;
+		}
+		if (grown != NULL)
+			data = grown;
+		CloseHostFile(file);
+	}
+	if (!error)
+	{
+		qsort(entries, count, sizeof(ArchiveEntry), CompareEntries);
+		for (int i = 1; i < count && !error; i++)
+		{
+			if (CompareEntries(&entries[i - 1], &entries[i]) == 0)
+			{
+				printf("error: %s is in the list twice\n", entries[i].name);
+				error = 1;
+			}
+		}
+	}
+	if (!error)
+	{
+		uint32_t start = 16 + (uint32_t)count * sizeof(ArchiveEntry);
+
+		for (int i = 0; i < count; i++)
+			entries[i].offset += start;
+		f = fopen(filename, "wb");
+		error = f == NULL ||
+			fwrite(ARCHIVE_MAGIC, 1, 8, f) != 8 ||
+			fwrite(header, sizeof(header), 1, f) != 1 ||
+			fwrite(entries, sizeof(ArchiveEntry), count, f) != (size_t)count ||
+			(used > 0 && fwrite(data, 1, (size_t)used, f) != used);
+		if (f != NULL && fclose(f) != 0)
+			error = 1;
+		if (error)
+			printf("error: Couldn't write %s\n", filename);
+	}
+	free(entries);
+	free(data);
+	return error;
+}
@@ -0,0 +1,448 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "core.h"
+#include "lockstep.h"
+#include "runner.h"
+#include "platform.h"
+
+/*****************************************************************************
+ *** Comparing the machines                                                ***
+ *****************************************************************************/
+static void GetRegisters(State6510* state, LockstepRegisters6510* registers)
+{
+	registers->PC = state->PC;
+	registers->SP = state->SP;
+	registers->A = state->A;
+	registers->X = state->X;
+	registers->Y = state->Y;
+	registers->SR = GetStatusRegister6510(state);
+	registers->halted = state->halted;
+	registers->cycles = state->cycles;
+	registers->instructions = state->instructions;
+}
+
+/*
+  Fills in the registers of both machines, returns 1 when they differ
+*/
+static int DifferentRegisters(State6510* engine, State6510* reference, LockstepReport6510* report)
+{
+	LockstepRegisters6510* a = &report->engine;
+	LockstepRegisters6510* b = &report->reference;
+
+	GetRegisters(engine, a);
+	GetRegisters(reference, b);
+	return a->PC != b->PC || a->SP != b->SP || a->A != b->A || a->X != b->X || a->Y != b->Y ||
+		a->SR != b->SR || a->halted != b->halted || a->cycles != b->cycles || a->instructions != b->instructions;
+}
+
+/*
+  Counts the RAM bytes that differ and lists the first ones, returns 1
+  when there are any. Both machines own all of their memory.
+*/
+static int DifferentMemory(State6510* engine, State6510* reference, LockstepReport6510* report)
+{
+	report->bytes = 0;
+	if (memcmp(engine->memory, reference->memory, 0x10000) == 0)
+		return 0;
+	for (int address = 0x0000; address <= 0xFFFF; address++)
+	{
+		if (engine->memory[address] == reference->memory[address])
+			continue;
+		if (report->bytes < LOCKSTEP_BYTES)
+		{
+			report->address[report->bytes] = (uint16_t)address;
+			report->engine_value[report->bytes] = engine->memory[address];
+			report->reference_value[report->bytes] = reference->memory[address];
+		}
+		report->bytes++;
+	}
+	return 1;
+}
+
+/*
+  Runs the engine up to target instructions, or until it halts, and the
+  reference with the same cycle budgets, so the events and interrupts of
+  both run at the same points. A budget of n cycles runs at most n
+  instructions (each takes two cycles or more), so the engine does not run
+  past target.
+*/
+static void RunTo(State6510* engine, State6510* reference, uint64_t target)
+{
+	while (!engine->halted && engine->instructions < target)
+	{
+		uint64_t left = target - engine->instructions;
+		int budget = left < C64_CYCLES_PER_FRAME ? (int)left : C64_CYCLES_PER_FRAME;
+
+		Run6510(engine, budget);
+		RunReference6510(reference, budget);
+	}
+}
+
+/*
+  Both machines go back to the start of the window and run it again one
+  instruction at a time, comparing everything after each, up to the first
+  difference
+*/
+static void Replay(State6510* engine, State6510* reference, const Snapshot6510* snapshot, uint64_t end, LockstepReport6510* report)
+{
+	LockstepReport6510 window = *report;
+	uint16_t history[LOCKSTEP_HISTORY];
+	uint64_t count = 0;
+
+	C64_Restore(engine, snapshot);
+	C64_OwnMemory(engine);
+	C64_Restore(reference, snapshot);
+	C64_OwnMemory(reference);
+	report->exact = 0;
+	while (reference->instructions < end && !(engine->halted && reference->halted))
+	{
+		uint16_t pc = reference->PC;
+
+		history[count++ % LOCKSTEP_HISTORY] = pc;
+		RunTo(engine, reference, engine->instructions + 1);
+		if (DifferentRegisters(engine, reference, report) | DifferentMemory(engine, reference, report))
+		{
+			report->exact = 1;
+			report->instruction = reference->instructions;
+			report->pc = pc;
+			break;
+		}
+	}
+
+	// Not found again: report what the window compare saw
+	if (!report->exact)
+		*report = window;
+
+	// The instructions up to the difference, as the reference sees them now
+	report->lines = 0;
+	for (uint64_t i = count > LOCKSTEP_HISTORY ? count - LOCKSTEP_HISTORY : 0; i < count; i++)
+	{
+		uint16_t pc = history[i % LOCKSTEP_HISTORY];
+		uint8_t code[3] = { Peek(reference, pc), Peek(reference, pc + 1), Peek(reference, pc + 2) };
+
+		DisassembleInstruction6510(pc, code, report->context[report->lines++]);
+	}
+}
+
+/*****************************************************************************
+ *** LOCKSTEP: Run the machine next to the reference and compare them      ***
+ ***                                                                       ***
+ *** Runs until both halt or max_instructions (0 = no limit). The machine  ***
+ *** ends where the engine stopped, after a difference where the replay    ***
+ *** stopped.                                                              ***
+ ***                                                                       ***
+ *** returns 0 when the machines agree, 1 when they differ (see report),   ***
+ *** -1 when memory ran out                                                ***
+ *****************************************************************************/
+int Lockstep6510(State6510* state, uint64_t max_instructions, uint64_t interval, LockstepReport6510* report)
+{
+	uint64_t window = interval > LOCKSTEP_WINDOW ? interval : LOCKSTEP_WINDOW;
+	Snapshot6510* snapshot;
+	State6510* reference;
+	int result = 0;
+
+	memset(report, 0, sizeof(*report));
+	if (interval < 1)
+		interval = 1;
+	C64_OwnMemory(state);
+	snapshot = C64_Snapshot(state);
+	reference = (snapshot != NULL) ? C64_Fork(snapshot) : NULL;
+	if (reference == NULL)
+	{
+		C64_FreeSnapshot(snapshot);
+		return -1;
+	}
+	reference->trace = NULL;
+	reference->profile = NULL;
+	C64_OwnMemory(reference);
+
+	while (!(state->halted && reference->halted) && (max_instructions == 0 || state->instructions < max_instructions))
+	{
+		uint64_t at = state->instructions;
+		uint64_t end = at + window;
+		int differ = 0;
+
+		if (max_instructions != 0 && end > max_instructions)
+			end = max_instructions;
+		// The machines are the same here
+		C64_FreeSnapshot(snapshot);
+		snapshot = C64_Snapshot(state);
+		if (snapshot == NULL)
+		{
+			result = -1;
+			break;
+		}
+
+		while (!differ && at < end && !(state->halted && reference->halted))
+		{
+			at = (end - at > interval) ? at + interval : end;
+			RunTo(state, reference, at);
+			differ = DifferentRegisters(state, reference, report);
+		}
+		if (differ || DifferentMemory(state, reference, report))
+		{
+			report->instruction = state->instructions;
+			report->pc = state->PC;
+			Replay(state, reference, snapshot, end, report);
+			result = 1;
+			break;
+		}
+	}
+
+	C64_FreeSnapshot(snapshot);
+	C64_FreeMemory(reference);
+	return result;
+}
+
+static void PrintRegisters(const char* name, const LockstepRegisters6510* r)
+{
+	printf("%-10s PC=$%04X A=$%02X X=$%02X Y=$%02X SP=$%04X SR=$%02X cycles=%llu instructions=%llu%s\n",
+		name, r->PC, r->A, r->X, r->Y, r->SP, r->SR, (unsigned long long)r->cycles,
+		(unsigned long long)r->instructions, r->halted ? " halted" : "");
+}
+
+void PrintLockstepReport6510(const char* name, const LockstepReport6510* report)
+{
+	if (report->exact)
+		printf("lockstep: %s differs after instruction %llu at $%04X\n", name,
+			(unsigned long long)report->instruction, report->pc);
+	else
+		printf("lockstep: %s differs at instruction %llu, the replay from the last snapshot did not\n", name,
+			(unsigned long long)report->instruction);
+	PrintRegisters("engine", &report->engine);
+	PrintRegisters("reference", &report->reference);
+	for (int i = 0; i < report->bytes && i < LOCKSTEP_BYTES; i++)
+		printf("RAM $%04X: engine $%02X, reference $%02X\n", report->address[i], report->engine_value[i], report->reference_value[i]);
+	if (report->bytes > LOCKSTEP_BYTES)
+		printf("... %d bytes differ\n", report->bytes);
+	for (int i = 0; i < report->lines; i++)
+		printf("%s%s\n", i == report->lines - 1 ? "> " : "  ", report->context[i]);
+}
+
+/*****************************************************************************
+ *** RANDOM PROGRAMS                                                       ***
+ ***                                                                       ***
+ *** RAM from $0002 to $9FFF is filled with random opcodes, implemented    ***
+ *** ones only (and no BRK), operands included, so a jump to any address   ***
+ *** in there still finds code. The registers are random too. Programs     ***
+ *** overwrite themselves, switch banks and jump into the ROMs, which is   ***
+ *** what the block cache and the JIT have to get right. They end on a     ***
+ *** BRK in empty RAM or after max instructions.                           ***
+ *****************************************************************************/
+typedef struct LockstepJob {
+	C64Pool  *machines;            // one per job
+	uint64_t first;                // seed of the first program
+	int      programs;
+	int      step;                 // this job runs first, first + step, ...
+	uint64_t instructions;
+	uint64_t interval;
+	volatile uint64_t *stop;       // set by the first job that finds a difference
+	uint64_t seed;                 // out: the program that differs, ~0 = none
+	uint64_t executed;             // out: instructions run
+	int      failed;               // out: out of memory
+	int      started;              // runs in its own thread
+	LockstepReport6510 report;
+} LockstepJob;
+
+static uint64_t NextRandom(uint64_t* x)
+{
+	// xorshift64*
+	*x ^= *x >> 12;
+	*x ^= *x << 25;
+	*x ^= *x >> 27;
+	return *x * 0x2545F4914F6CDD1DULL;
+}
+
+static void RandomProgram(State6510* state, uint64_t seed)
+{
+	uint8_t opcodes[256];
+	int count = 0;
+	uint64_t x = seed * 0x9E3779B97F4A7C15ULL + 1;
+
+	for (int op = 0x01; op <= 0xFF; op++)
+		if (Flow6510[op] != FLOW_UNIMPL)
+			opcodes[count++] = (uint8_t)op;
+
+	Reset6510(state);
+	state->halt_on_brk = 1;
+	C64_OwnMemoryRange(state, 0x0000, 0xA000);
+	for (int address = 0x0002; address < 0xA000; address++)
+		state->memory[address] = opcodes[NextRandom(&x) % count];
+	state->A = (uint8_t)NextRandom(&x);
+	state->X = (uint8_t)NextRandom(&x);
+	state->Y = (uint8_t)NextRandom(&x);
+	state->SP = 0x0100 | (uint8_t)NextRandom(&x);
+	SetStatusRegister6510(state, (uint8_t)NextRandom(&x) | 0x30);
+	state->PC = (uint16_t)(0x0200 + NextRandom(&x) % 0x9E00);
+}
+
+static void LockstepJobRun(void* arg)
+{
+	LockstepJob* job = (LockstepJob*)arg;
+	State6510* state = C64_TakeMachine(job->machines);
+
+	job->seed = ~0ULL;
+	if (state == NULL)
+	{
+		job->failed = 1;
+		return;
+	}
+	for (int i = 0; i < job->programs && !AtomicLoad64(job->stop); i += job->step)
+	{
+		int result;
+
+		RandomProgram(state, job->first + i);
+		result = Lockstep6510(state, job->instructions, job->interval, &job->report);
+		job->executed += state->instructions;
+		if (result != 0)
+		{
+			job->failed = result < 0;
+			job->seed = job->first + i;
+			AtomicStore64(job->stop, 1);
+			break;
+		}
+	}
+	C64_ReturnMachine(job->machines, state);
+}
+
+static int LockstepRandom(const C64ROMSet* rom, uint64_t first, int programs, uint64_t instructions, uint64_t interval, int threads)
+{
+	static const char* engines[] = { "switch", "table", "threaded", "blocks", "jit" };
+	LockstepJob* jobs = (LockstepJob*)calloc(threads, sizeof(LockstepJob));
+	Thread6510* handles = (Thread6510*)calloc(threads, sizeof(Thread6510));
+	C64Pool* machines = C64_CreatePool(rom, threads);
+	volatile uint64_t stop = 0;
+	uint64_t executed = 0;
+	int differ = -1;
+	int failed = 0;
+	double start;
+
+	if (jobs == NULL || handles == NULL || machines == NULL)
+	{
+		printf("error: Out of memory\n");
+		free(jobs);
+		free(handles);
+		C64_FreePool(machines);
+		return 1;
+	}
+	start = TimerSeconds();
+	for (int i = 0; i < threads; i++)
+	{
+		jobs[i].machines = machines;
+		jobs[i].first = first + i;
+		jobs[i].programs = programs - i;
+		jobs[i].step = threads;
+		jobs[i].instructions = instructions;
+		jobs[i].interval = interval;
+		jobs[i].stop = &stop;
+		jobs[i].started = StartThread(&handles[i], LockstepJobRun, &jobs[i]) == 0;
+		if (!jobs[i].started)
+			LockstepJobRun(&jobs[i]);
+	}
+	for (int i = 0; i < threads; i++)
+	{
+		if (jobs[i].started)
+			JoinThread(handles[i]);
+		executed += jobs[i].executed;
+		failed |= jobs[i].failed;
+		// The lowest seed that differs, so a rerun finds the same one
+		if (jobs[i].seed != ~0ULL && !jobs[i].failed && (differ < 0 || jobs[i].seed < jobs[differ].seed))
+			differ = i;
+	}
+
+	printf("lockstep: %s engine against Emulate6510Op, %llu instructions in %.2f seconds\n",
+		engines[CPU_DISPATCH], (unsigned long long)executed, TimerSeconds() - start);
+	if (failed)
+		printf("error: Out of memory\n");
+	if (differ >= 0)
+	{
+		char name[32];
+
+		sprintf(name, "program %llu", (unsigned long long)jobs[differ].seed);
+		PrintLockstepReport6510(name, &jobs[differ].report);
+	}
+	else if (!failed)
+		printf("no differences in %d programs\n", programs);
+
+	free(jobs);
+	free(handles);
+	C64_FreePool(machines);
+	return (differ >= 0 || failed) ? 1 : 0;
+}
+
+/*****************************************************************************
+ *** LOCKSTEP: command line                                                ***
+ ***      6502 lockstep random [programs] [instructions] [interval]        ***
+ ***                           [threads] [first seed]                      ***
+ ***      6502 lockstep <manifest> [interval]                              ***
+ ***           the test programs of a manifest (see runner.h), each up to  ***
+ ***           its instruction limit                                       ***
+ *** interval = instructions between register compares, 1 = lockstep       ***
+ *****************************************************************************/
+int LockstepMain(const C64ROMSet* rom, int argc, char** argv)
+{
+	TestCase6510* tests = NULL;
+	State6510* state;
+	uint64_t interval;
+	int count;
+	int result = 0;
+
+	if (argc >= 1 && strcmp(argv[0], "random") == 0)
+	{
+		int programs = (argc >= 2) ? atoi(argv[1]) : 1000;
+		uint64_t instructions = (argc >= 3) ? strtoull(argv[2], NULL, 10) : 100000;
+		int threads = (argc >= 5) ? atoi(argv[4]) : HostCores();
+
+		interval = (argc >= 4) ? strtoull(argv[3], NULL, 10) : 1;
+		if (programs < 1 || instructions < 1 || interval < 1 || threads < 1)
+		{
+			printf("error: programs, instructions, interval and threads must be at least 1\n");
+			return 1;
+		}
+		return LockstepRandom(rom, (argc >= 6) ? strtoull(argv[5], NULL, 10) : 1, programs, instructions, interval, threads);
+	}
+
+	if (argc < 1)
+	{
+		printf("usage: 6502 lockstep random [programs] [instructions] [interval] [threads] [first seed]\n");
+		printf("       6502 lockstep <manifest> [interval]\n");
+		return 1;
+	}
+	interval = (argc >= 2) ? strtoull(argv[1], NULL, 10) : 1;
+	count = LoadTestManifest6510(argv[0], &tests);
+	if (count < 0)
+		return 1;
+	state = C64_AllocateMemory(rom);
+	if (state == NULL || interval < 1)
+	{
+		C64_FreeMemory(state);
+		FreeTestManifest6510(tests, count);
+		return 1;
+	}
+	for (int i = 0; i < count; i++)
+	{
+		LockstepReport6510 report;
+		int differ;
+
+		if (LoadTest6510(state, &tests[i]))
+		{
+			printf("%-20s couldn't load %s\n", tests[i].name, tests[i].file);
+			result = 1;
+			continue;
+		}
+		differ = Lockstep6510(state, tests[i].max_instructions, interval, &report);
+		if (differ > 0)
+			PrintLockstepReport6510(tests[i].name, &report);
+		else
+			printf("%-20s %s after %llu instructions\n", tests[i].name, differ == 0 ? "same" : "out of memory",
+				(unsigned long long)state->instructions);
+		result |= differ != 0;
+	}
+	C64_FreeMemory(state);
+	FreeTestManifest6510(tests, count);
+	return result;
+}
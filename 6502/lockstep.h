@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "6502.h"
+
+/*
+	Lockstep differential test
+
+	Runs a machine with the dispatch engine of this build (Run6510) next to
+	a copy of it that runs the reference, Emulate6510Op, through
+	RunReference6510 with the same cycle budgets, so the events and
+	interrupts (CIA timers, raster lines) of both happen at the same points.
+	It compares the two: registers, flags, cycles and instruction counts every interval
+	instructions, the 64K of RAM every LOCKSTEP_WINDOW instructions (or
+	interval, if that is more). A snapshot is taken at the start of every
+	window. When the machines differ, both go back to it and replay the
+	window one instruction at a time with everything compared after every
+	instruction, which finds the first instruction that went wrong.
+
+	Handlers on I/O pages would see every access twice, so this is for
+	plain CPU code, like the JIT check.
+*/
+#define LOCKSTEP_WINDOW		1024
+#define LOCKSTEP_HISTORY	8	// instructions shown up to the difference
+#define LOCKSTEP_BYTES		8	// differing RAM bytes shown
+
+typedef struct LockstepRegisters6510 {
+	uint16_t PC;
+	uint16_t SP;
+	uint8_t  A;
+	uint8_t  X;
+	uint8_t  Y;
+	uint8_t  SR;
+	uint8_t  halted;
+	uint64_t cycles;
+	uint64_t instructions;
+} LockstepRegisters6510;
+
+typedef struct LockstepReport6510 {
+	int      exact;               // 0 when the replay did not differ again
+	uint64_t instruction;         // the instruction after which the machines differ (1 = first)
+	uint16_t pc;                  // where it is
+	LockstepRegisters6510 engine; // after it
+	LockstepRegisters6510 reference;
+	int      bytes;               // RAM bytes that differ
+	uint16_t address[LOCKSTEP_BYTES];
+	uint8_t  engine_value[LOCKSTEP_BYTES];
+	uint8_t  reference_value[LOCKSTEP_BYTES];
+	int      lines;
+	char     context[LOCKSTEP_HISTORY][DISASSEMBLY_LINE]; // the instructions up to it, as run by the reference
+} LockstepReport6510;
+
+int Lockstep6510(State6510* state, uint64_t max_instructions, uint64_t interval, LockstepReport6510* report);
+void PrintLockstepReport6510(const char* name, const LockstepReport6510* report);
+int LockstepMain(const C64ROMSet* rom, int argc, char** argv);
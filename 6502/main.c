@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "6502.h"
+#include "bench.h"
+#include "trace.h"
+#include "profile.h"
+#include "runner.h"
+#include "lockstep.h"
+#include "vic.h"
+
+/*****************************************************************************
+ *** 6502                     run the test program from Init6510           ***
+ *** 6502 jitcheck            the same, with the JIT checked against the   ***
+ ***                          interpreter (CPU_DISPATCH_JIT builds)        ***
+ *** 6502 trace record <file> the same, every instruction written to file  ***
+ *** 6502 trace show <file>   print a trace file as text                   ***
+ *** 6502 profile [<file> [<symbols>]]                                     ***
+ ***                          the same, then the hot spots and call tree;  ***
+ ***                          folded stacks for flamegraph.pl to file.     ***
+ ***                          Routines are named from ./rom/kernal.sym,    ***
+ ***                          basic.sym and <symbols> (CPU_PROFILE=1)      ***
+ *** 6502 video <file> [frames]                                            ***
+ ***                          the same with the VIC rendering, up to       ***
+ ***                          frames: the last frame to file if it ends in ***
+ ***                          .ppm, else every frame as Y4M                ***
+ *** 6502 disasm rom          disassemble the BASIC and KERNAL ROMs        ***
+ *** 6502 disasm <file> <org> disassemble a code file loaded at org (hex)  ***
+ *** 6502 test [<manifest>]   run the test programs of a manifest, see     ***
+ ***                          runner.h                                     ***
+ *** 6502 batch <jobs> ...    the same on a pool of threads, JSON lines    ***
+ *** 6502 pack <archive> <files>                                           ***
+ ***                          put programs into one archive for manifests  ***
+ *** 6502 lockstep ...        the engine of this build against             ***
+ ***                          Emulate6510Op, see LockstepMain              ***
+ *** 6502 bench ...           benchmarks, see BenchMain                    ***
+ *****************************************************************************/
+/*
+  Disassembles a whole image with one write to stdout
+*/
+static int PrintDisassembly(const uint8_t* image, size_t size, uint16_t origin)
+{
+	size_t buffer_size = size * DISASSEMBLY_LINE + 1;
+	char* buffer = (char*)malloc(buffer_size);
+
+	if (buffer == NULL)
+		return 1;
+	fwrite(buffer, 1, Disassemble6510Range(image, size, origin, buffer, buffer_size), stdout);
+	free(buffer);
+	return 0;
+}
+
+static int IsPPM(const char* filename)
+{
+	size_t length = strlen(filename);
+
+	return length > 4 && strcmp(filename + length - 4, ".ppm") == 0;
+}
+
+static int DisassembleFile(const char* filename, uint16_t origin)
+{
+	FILE* f = fopen(filename, "rb");
+	uint8_t* image = (uint8_t*)malloc(0x10000);
+	size_t size;
+	int result;
+
+	if (f == NULL || image == NULL)
+	{
+		printf("error: Couldn't open %s\n", filename);
+		if (f != NULL)
+			fclose(f);
+		free(image);
+		return 1;
+	}
+	size = fread(image, 1, 0x10000 - origin, f);
+	fclose(f);
+	result = PrintDisassembly(image, size, origin);
+	free(image);
+	return result;
+}
+
+int main (int argc, char**argv)
+{
+	int done = 0;
+	int result = 0;
+	int frames = 0;
+	C64ROMSet* rom;
+	State6510* state;
+	BlockCacheStats6510 blocks;
+
+	if (argc > 3 && strcmp(argv[1], "trace") == 0 && strcmp(argv[2], "show") == 0)
+		return RenderTrace6510(argv[3]);
+	if (argc > 2 && strcmp(argv[1], "pack") == 0)
+		return C64_WriteArchive(argv[2], argc - 3, argv + 3);
+	if (argc > 3 && strcmp(argv[1], "disasm") == 0)
+		return DisassembleFile(argv[2], (uint16_t)strtoul(argv[3], NULL, 16));
+
+	rom = C64_AllocateROM();
+	if (rom == NULL) return 1;
+	if (C64_LoadROM(rom)) return 1;
+
+	if (argc > 2 && strcmp(argv[1], "disasm") == 0 && strcmp(argv[2], "rom") == 0)
+	{
+		result = PrintDisassembly(rom->pBasicROM, 8192, 0xA000) ||
+			PrintDisassembly(rom->pKernalROM, 8192, 0xE000);
+		C64_FreeROM(rom);
+		return result;
+	}
+	if (argc > 1 && strcmp(argv[1], "test") == 0)
+	{
+		result = TestMain(rom, argc - 2, argv + 2);
+		C64_FreeROM(rom);
+		return result;
+	}
+	if (argc > 1 && strcmp(argv[1], "batch") == 0)
+	{
+		result = BatchMain(rom, argc - 2, argv + 2);
+		C64_FreeROM(rom);
+		return result;
+	}
+	if (argc > 1 && strcmp(argv[1], "lockstep") == 0)
+	{
+		result = LockstepMain(rom, argc - 2, argv + 2);
+		C64_FreeROM(rom);
+		return result;
+	}
+	if (argc > 1 && strcmp(argv[1], "bench") == 0)
+	{
+		result = BenchMain(rom, argc - 2, argv + 2);
+		C64_FreeROM(rom);
+		return result;
+	}
+
+	state = C64_AllocateMemory(rom);
+	if (state == NULL) return 1;
+	Init6510(state);
+	// The test program ends on a BRK
+	state->halt_on_brk = 1;
+	// The timer IRQ (the KERNAL's 1/60 second jiffy) comes from CIA 1
+	C64_AttachCIAs(state);
+	if (argc > 1 && strcmp(argv[1], "jitcheck") == 0 && EnableJitCheck6510(state))
+	{
+		fprintf(stderr, "jitcheck needs a CPU_DISPATCH_JIT build\n");
+		C64_FreeMemory(state);
+		C64_FreeROM(rom);
+		return 1;
+	}
+	if (argc > 3 && strcmp(argv[1], "trace") == 0 && strcmp(argv[2], "record") == 0 && StartTrace6510(state, argv[3]))
+	{
+		C64_FreeMemory(state);
+		C64_FreeROM(rom);
+		return 1;
+	}
+	if (argc > 1 && strcmp(argv[1], "profile") == 0 && StartProfile6510(state))
+	{
+		fprintf(stderr, "profile needs a CPU_PROFILE=1 build\n");
+		C64_FreeMemory(state);
+		C64_FreeROM(rom);
+		return 1;
+	}
+	if (argc > 2 && strcmp(argv[1], "video") == 0)
+	{
+		C64_AttachVIC(state);
+		if (C64_StartScreen(state) || (!IsPPM(argv[2]) && C64_RecordY4M(state, argv[2])))
+		{
+			C64_FreeMemory(state);
+			C64_FreeROM(rom);
+			return 1;
+		}
+		if (argc > 3)
+			frames = atoi(argv[3]);
+	}
+	if (state->profile != NULL)
+	{
+		LoadSymbols6510(state, "./rom/kernal.sym");
+		LoadSymbols6510(state, "./rom/basic.sym");
+		if (argc > 3 && LoadSymbols6510(state, argv[3]))
+			fprintf(stderr, "Couldn't read the symbols in %s\n", argv[3]);
+	}
+
+	while (done == 0)
+	{
+		Run6510(state, C64_CYCLES_PER_FRAME);
+		done = state->halted || (frames > 0 && state->screen->frames >= (uint64_t)frames);
+	}
+
+	GetBlockCacheStats6510(state, &blocks);
+	if (blocks.hits + blocks.misses > 0)
+		printf("block cache: %llu hits, %llu misses, %llu invalidations, %llu flushes, %llu compiled\n",
+			(unsigned long long)blocks.hits, (unsigned long long)blocks.misses,
+			(unsigned long long)blocks.invalidations, (unsigned long long)blocks.flushes,
+			(unsigned long long)blocks.compiled);
+	if (blocks.checked > 0)
+		printf("JIT check: %llu instructions compared\n", (unsigned long long)blocks.checked);
+	if (state->trace != NULL && StopTrace6510(state))
+		result = 1;
+	if (state->screen != NULL)
+	{
+		printf("video: %llu frames, %llu lines rendered, %llu skipped\n", (unsigned long long)state->screen->frames,
+			(unsigned long long)state->screen->rendered, (unsigned long long)state->screen->skipped);
+		if (IsPPM(argv[2]) && C64_SavePPM(state->screen, argv[2]))
+			result = 1;
+		if (C64_StopScreen(state))
+			result = 1;
+	}
+	if (state->profile != NULL)
+	{
+		PrintProfile6510(state, 20);
+		printf("\n");
+		PrintCallTree6510(state, 0.1);
+		if (argc > 2 && WriteFoldedProfile6510(state, argv[2]))
+			result = 1;
+	}
+
+	C64_FreeMemory(state);
+	C64_FreeROM(rom);
+	return result;
+}
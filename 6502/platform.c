@@ -0,0 +1,329 @@
+#include <stdlib.h>
+
+#include "platform.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*****************************************************************************
+ *** Threads                                                               ***
+ *****************************************************************************/
+typedef struct ThreadStart6510 {
+	ThreadFunc6510 func;
+	void *arg;
+} ThreadStart6510;
+
+#if defined(_WIN32)
+static DWORD WINAPI ThreadEntry(LPVOID param)
+#else
+static void* ThreadEntry(void* param)
+#endif
+{
+	ThreadStart6510 start = *(ThreadStart6510*)param;
+
+	free(param);
+	start.func(start.arg);
+	return 0;
+}
+
+/*
+  Returns 0 when the thread is running
+*/
+int StartThread(Thread6510* thread, ThreadFunc6510 func, void* arg)
+{
+	ThreadStart6510* start = (ThreadStart6510*)malloc(sizeof(ThreadStart6510));
+
+	if (start == NULL)
+		return 1;
+	start->func = func;
+	start->arg = arg;
+#if defined(_WIN32)
+	*thread = CreateThread(NULL, 0, ThreadEntry, start, 0, NULL);
+	if (*thread != NULL)
+		return 0;
+#else
+	if (pthread_create(thread, NULL, ThreadEntry, start) == 0)
+		return 0;
+#endif
+	free(start);
+	return 1;
+}
+
+void JoinThread(Thread6510 thread)
+{
+#if defined(_WIN32)
+	WaitForSingleObject(thread, INFINITE);
+	CloseHandle(thread);
+#else
+	pthread_join(thread, NULL);
+#endif
+}
+
+void SleepMilliseconds(int milliseconds)
+{
+#if defined(_WIN32)
+	Sleep(milliseconds);
+#else
+	struct timespec duration;
+
+	duration.tv_sec = milliseconds / 1000;
+	duration.tv_nsec = (long)(milliseconds % 1000) * 1000000L;
+	nanosleep(&duration, NULL);
+#endif
+}
+
+/*****************************************************************************
+ *** Host information                                                      ***
+ *****************************************************************************/
+int HostCores(void)
+{
+#if defined(_WIN32)
+	SYSTEM_INFO info;
+
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+	return (cores > 0) ? (int)cores : 1;
+#endif
+}
+
+/*
+  Monotonic time in seconds, only useful for differences
+*/
+double TimerSeconds(void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER frequency, counter;
+
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+/*****************************************************************************
+ *** Executable memory                                                     ***
+ *****************************************************************************/
+/*
+  Memory for generated code, NULL on failure. It is never writable and
+  executable at the same time: it starts out read/write, ProtectExecutable
+  makes the code executable once it is written.
+*/
+void* AllocateExecutable(size_t size)
+{
+#if defined(_WIN32)
+	return VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+	void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return memory == MAP_FAILED ? NULL : memory;
+#endif
+}
+
+/*
+  Makes the pages that hold size bytes at memory read/write (writable = 1)
+  or read/execute (writable = 0). Returns 1 on failure.
+*/
+int ProtectExecutable(void* memory, size_t size, int writable)
+{
+#if defined(_WIN32)
+	DWORD old;
+
+	return !VirtualProtect(memory, size, writable ? PAGE_READWRITE : PAGE_EXECUTE_READ, &old);
+#else
+	uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+	uintptr_t start = (uintptr_t)memory & ~(page - 1);
+	uintptr_t end = ((uintptr_t)memory + size + page - 1) & ~(page - 1);
+
+	return mprotect((void*)start, end - start, writable ? PROT_READ | PROT_WRITE : PROT_READ | PROT_EXEC) != 0;
+#endif
+}
+
+void FreeExecutable(void* memory, size_t size)
+{
+	if (memory == NULL)
+		return;
+#if defined(_WIN32)
+	(void)size;
+	VirtualFree(memory, 0, MEM_RELEASE);
+#else
+	munmap(memory, size);
+#endif
+}
+
+/*****************************************************************************
+ *** Page memory                                                           ***
+ *****************************************************************************/
+/*
+  Read and write memory straight from the OS, page aligned and zeroed (the
+  pages are only backed when they are first written). NULL on failure.
+*/
+void* AllocatePages(size_t size)
+{
+#if defined(_WIN32)
+	return VirtualAlloc(NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+	void* memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	return memory == MAP_FAILED ? NULL : memory;
+#endif
+}
+
+void FreePages(void* memory, size_t size)
+{
+	if (memory == NULL)
+		return;
+#if defined(_WIN32)
+	(void)size;
+	VirtualFree(memory, 0, MEM_RELEASE);
+#else
+	munmap(memory, size);
+#endif
+}
+
+/*****************************************************************************
+ *** Files                                                                 ***
+ *****************************************************************************/
+/*
+  Opens a file for reading and gets its size, returns 0 when it is open
+*/
+int OpenHostFile(const char* filename, HostFile* file, uint64_t* size)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER length;
+
+	*file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (*file == INVALID_HANDLE_VALUE)
+		return 1;
+	if (!GetFileSizeEx(*file, &length))
+	{
+		CloseHandle(*file);
+		return 1;
+	}
+	*size = (uint64_t)length.QuadPart;
+	return 0;
+#else
+	struct stat info;
+
+	*file = open(filename, O_RDONLY);
+	if (*file < 0)
+		return 1;
+	if (fstat(*file, &info) != 0)
+	{
+		close(*file);
+		return 1;
+	}
+	*size = (uint64_t)info.st_size;
+	return 0;
+#endif
+}
+
+/*
+  Reads from offset straight into buffer (pread, no file position and no
+  stdio buffer in between), returns the number of bytes read
+*/
+size_t ReadHostFile(HostFile file, void* buffer, size_t size, uint64_t offset)
+{
+	size_t done = 0;
+
+	while (done < size)
+	{
+#if defined(_WIN32)
+		OVERLAPPED position = { 0 };
+		DWORD count = 0;
+
+		position.Offset = (DWORD)(offset + done);
+		position.OffsetHigh = (DWORD)((offset + done) >> 32);
+		if (!ReadFile(file, (uint8_t*)buffer + done, (DWORD)(size - done), &count, &position) || count == 0)
+			break;
+#else
+		ssize_t count = pread(file, (uint8_t*)buffer + done, size - done, (off_t)(offset + done));
+
+		if (count <= 0)
+			break;
+#endif
+		done += (size_t)count;
+	}
+	return done;
+}
+
+void CloseHostFile(HostFile file)
+{
+#if defined(_WIN32)
+	CloseHandle(file);
+#else
+	close(file);
+#endif
+}
+
+/*****************************************************************************
+ *** Mapped files                                                          ***
+ *****************************************************************************/
+/*
+  Maps the first size bytes of an open file read only, NULL on failure.
+  The pages come from the file cache, so every process that maps the file
+  shares them. The mapping stays when the file is closed.
+*/
+const void* MapHostFile(HostFile file, size_t size)
+{
+#if defined(_WIN32)
+	HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	void* memory = NULL;
+
+	if (mapping != NULL)
+	{
+		memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+		CloseHandle(mapping);
+	}
+	return memory;
+#else
+	void* memory = mmap(NULL, size, PROT_READ, MAP_SHARED, file, 0);
+
+	return memory == MAP_FAILED ? NULL : memory;
+#endif
+}
+
+/*
+  Maps the first size bytes of a file, NULL when it can not be opened or
+  is shorter
+*/
+const void* MapFile(const char* filename, size_t size)
+{
+	HostFile file;
+	uint64_t length;
+	const void* memory = NULL;
+
+	if (OpenHostFile(filename, &file, &length))
+		return NULL;
+	if (length >= size)
+		memory = MapHostFile(file, size);
+	CloseHostFile(file);
+	return memory;
+}
+
+void UnmapFile(const void* memory, size_t size)
+{
+	if (memory == NULL)
+		return;
+#if defined(_WIN32)
+	(void)size;
+	UnmapViewOfFile(memory);
+#else
+	munmap((void*)memory, size);
+#endif
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+	Small layer over the host OS for the things the C library does not
+	offer: threads, a high resolution timer, the number of cores,
+	executable and page aligned memory, mapped files and the atomics for
+	passing data between threads.
+	Windows uses the Win32 API, everything else POSIX.
+*/
+#if defined(_WIN32)
+typedef void* Thread6510;
+typedef void* HostFile;
+#else
+#include <pthread.h>
+typedef pthread_t Thread6510;
+typedef int HostFile;
+#endif
+
+typedef void (*ThreadFunc6510)(void* arg);
+
+int StartThread(Thread6510* thread, ThreadFunc6510 func, void* arg);
+void JoinThread(Thread6510 thread);
+void SleepMilliseconds(int milliseconds);
+int HostCores(void);
+double TimerSeconds(void);
+void* AllocateExecutable(size_t size);
+int ProtectExecutable(void* memory, size_t size, int writable);
+void FreeExecutable(void* memory, size_t size);
+void* AllocatePages(size_t size);
+void FreePages(void* memory, size_t size);
+int OpenHostFile(const char* filename, HostFile* file, uint64_t* size);
+size_t ReadHostFile(HostFile file, void* buffer, size_t size, uint64_t offset);
+void CloseHostFile(HostFile file);
+const void* MapHostFile(HostFile file, size_t size);
+const void* MapFile(const char* filename, size_t size);
+void UnmapFile(const void* memory, size_t size);
+
+/*
+	Atomic 64 bit load (acquire) and store (release), enough for a ring
+	buffer with one thread writing and one reading. Compare and exchange
+	stores desired when *p is still expected and returns 1 if it did.
+*/
+#if defined(_MSC_VER)
+#include <intrin.h>
+static __inline uint64_t AtomicLoad64(volatile uint64_t* p)
+{
+	uint64_t value = *p;
+	_ReadWriteBarrier();
+	return value;
+}
+static __inline void AtomicStore64(volatile uint64_t* p, uint64_t value)
+{
+	_ReadWriteBarrier();
+	*p = value;
+}
+static __inline int AtomicCompareExchange64(volatile uint64_t* p, uint64_t expected, uint64_t desired)
+{
+	return (uint64_t)_InterlockedCompareExchange64((volatile __int64*)p, (__int64)desired, (__int64)expected) == expected;
+}
+#else
+static inline uint64_t AtomicLoad64(volatile uint64_t* p)
+{
+	return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+static inline void AtomicStore64(volatile uint64_t* p, uint64_t value)
+{
+	__atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+static inline int AtomicCompareExchange64(volatile uint64_t* p, uint64_t expected, uint64_t desired)
+{
+	return __atomic_compare_exchange_n(p, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+#endif
@@ -0,0 +1,476 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "core.h"
+#include "profile.h"
+
+/*****************************************************************************
+ *** START PROFILE: Count every instruction of the machine from now on     ***
+ ***                                                                       ***
+ *** returns 0 when the profile runs, 1 when the build has no profiler     ***
+ *****************************************************************************/
+int StartProfile6510(State6510* state)
+{
+#if CPU_PROFILE
+	Profile6510* profile = state->profile;
+
+	if (profile != NULL)
+		return 0;
+	profile = (Profile6510*)calloc(1, sizeof(Profile6510));
+	if (profile == NULL)
+		return 1;
+	profile->nodes = (CallNode6510*)malloc(PROFILE_NODES * sizeof(CallNode6510));
+	if (profile->nodes == NULL)
+	{
+		free(profile);
+		return 1;
+	}
+	memset(&profile->nodes[0], 0, sizeof(CallNode6510));
+	profile->nodes[0].parent = profile->nodes[0].child = profile->nodes[0].sibling = -1;
+	profile->node_count = 1;
+	profile->last_pc = state->PC;
+	profile->last_cycles = state->cycles;
+	state->profile = profile;
+	return 0;
+#else
+	(void)state;
+	return 1;
+#endif
+}
+
+void StopProfile6510(State6510* state)
+{
+	if (state->profile == NULL)
+		return;
+	free(state->profile->nodes);
+	free(state->profile->symbols);
+	free(state->profile);
+	state->profile = NULL;
+}
+
+/*****************************************************************************
+ *** Shadow call stack                                                     ***
+ *****************************************************************************/
+/*
+  Drops the frames whose return address is no longer on the stack: their
+  SP is below sp, the SP before the current push or after the pull
+*/
+static void DropFrames(Profile6510* profile, unsigned sp)
+{
+	while (profile->depth > 0 && profile->stack[profile->depth - 1].sp < sp)
+		profile->depth--;
+	profile->node = profile->depth > 0 ? profile->stack[profile->depth - 1].node : 0;
+}
+
+/*
+  Called after JSR or BRK (or an interrupt) pushed its pushed bytes and
+  loaded PC with the routine
+*/
+void ProfileCall6510(State6510* state, int pushed)
+{
+	Profile6510* profile = state->profile;
+	CallNode6510* nodes = profile->nodes;
+	int32_t child;
+
+	DropFrames(profile, state->SP + pushed);
+	if (profile->depth == PROFILE_DEPTH)
+		return;
+	for (child = nodes[profile->node].child; child >= 0; child = nodes[child].sibling)
+		if (nodes[child].routine == state->PC)
+			break;
+	if (child < 0 && profile->node_count < PROFILE_NODES)
+	{
+		child = profile->node_count++;
+		nodes[child].routine = state->PC;
+		nodes[child].parent = profile->node;
+		nodes[child].child = -1;
+		nodes[child].sibling = nodes[profile->node].child;
+		nodes[child].calls = 0;
+		nodes[child].cycles = 0;
+		nodes[profile->node].child = child;
+	}
+	if (child < 0)
+		child = profile->node; // tree full
+	nodes[child].calls++;
+	profile->stack[profile->depth].node = child;
+	profile->stack[profile->depth].sp = state->SP;
+	profile->depth++;
+	profile->node = child;
+}
+
+/*
+  Called after RTS or RTI pulled the return address
+*/
+void ProfileReturn6510(State6510* state)
+{
+	DropFrames(state->profile, state->SP);
+}
+
+/*****************************************************************************
+ *** LOAD SYMBOLS: Routine names for the call tree                         ***
+ *** One symbol per line, either "FFD2 CHROUT" (hex address, "$" optional) ***
+ *** or a VICE label "al C:ffd2 .CHROUT". ";" and "#" start a comment.     ***
+ *** Can be called more than once, the first name for an address is kept. ***
+ ***                                                                       ***
+ *** returns 0 when the file was read                                      ***
+ *****************************************************************************/
+static int FindSymbol(const Profile6510* profile, uint16_t address, int* index)
+{
+	int low = 0;
+	int high = profile->symbol_count - 1;
+
+	while (low <= high)
+	{
+		int middle = (low + high) / 2;
+
+		if (profile->symbols[middle].address == address)
+		{
+			*index = middle;
+			return 1;
+		}
+		if (profile->symbols[middle].address < address)
+			low = middle + 1;
+		else
+			high = middle - 1;
+	}
+	*index = low;
+	return 0;
+}
+
+int LoadSymbols6510(State6510* state, const char* filename)
+{
+	Profile6510* profile = state->profile;
+	FILE* f;
+	char line[256];
+
+	if (profile == NULL)
+		return 1;
+	f = fopen(filename, "r");
+	if (f == NULL)
+		return 1;
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		char name[PROFILE_SYMBOL];
+		unsigned address;
+		Symbol6510* symbols;
+		int index;
+
+		line[strcspn(line, ";#\r\n")] = '\0';
+		if (sscanf(line, " al C:%x .%31s", &address, name) != 2 &&
+			sscanf(line, " $%x %31s", &address, name) != 2 &&
+			sscanf(line, " %x %31s", &address, name) != 2)
+			continue;
+		if (address > 0xFFFF || FindSymbol(profile, (uint16_t)address, &index))
+			continue;
+		symbols = (Symbol6510*)realloc(profile->symbols, (profile->symbol_count + 1) * sizeof(Symbol6510));
+		if (symbols == NULL)
+			break;
+		// Insert sorted by address
+		memmove(&symbols[index + 1], &symbols[index], (profile->symbol_count - index) * sizeof(Symbol6510));
+		symbols[index].address = (uint16_t)address;
+		strcpy(symbols[index].name, name);
+		profile->symbols = symbols;
+		profile->symbol_count++;
+	}
+	fclose(f);
+	return 0;
+}
+
+/*
+  Name of a routine: its symbol, otherwise its address
+*/
+static const char* RoutineName(const Profile6510* profile, uint16_t address, char* buffer)
+{
+	int index;
+
+	if (FindSymbol(profile, address, &index))
+		return profile->symbols[index].name;
+	sprintf(buffer, "$%04X", address);
+	return buffer;
+}
+
+/*
+  Adds the cycles of the last instruction, the core does that when the
+  next one starts
+*/
+static void FlushProfile(State6510* state)
+{
+	Profile6510* profile = state->profile;
+	uint64_t cycles = state->cycles - profile->last_cycles;
+
+	profile->cycles[profile->last_pc] += cycles;
+	profile->opcode_cycles[profile->last_opcode] += cycles;
+	profile->nodes[profile->last_node].cycles += cycles;
+	profile->last_node = profile->node;
+	profile->last_cycles = state->cycles;
+}
+
+/*
+  The code byte at address as the CPU sees it, without calling I/O
+  handlers
+*/
+static uint8_t ReadCode(State6510* state, uint16_t address)
+{
+	const uint8_t* page = state->readmap[address >> 8];
+
+	if (page == NULL)
+		page = state->cow[address >> 8] != NULL ? state->cow[address >> 8] : state->memory + (address & 0xFF00);
+	return page[address & 0xFF];
+}
+
+static void DisassembleAt(State6510* state, uint16_t pc, char* line)
+{
+	uint8_t code[3];
+
+	code[0] = ReadCode(state, pc);
+	code[1] = ReadCode(state, (uint16_t)(pc + 1));
+	code[2] = ReadCode(state, (uint16_t)(pc + 2));
+	DisassembleInstruction6510(pc, code, line);
+}
+
+typedef struct HotSpot {
+	uint64_t cycles;
+	uint64_t count;
+	uint32_t key; // PC or opcode
+} HotSpot;
+
+static int CompareHotSpots(const void* a, const void* b)
+{
+	const HotSpot* x = (const HotSpot*)a;
+	const HotSpot* y = (const HotSpot*)b;
+
+	if (x->cycles != y->cycles)
+		return x->cycles < y->cycles ? 1 : -1;
+	return x->key < y->key ? -1 : (x->key > y->key);
+}
+
+/*
+  Collects the entries that ran at least once, most cycles first
+
+  returns the number of entries in spots
+*/
+static int SortHotSpots(const uint64_t* count, const uint64_t* cycles, int size, HotSpot* spots)
+{
+	int n = 0;
+
+	for (int key = 0; key < size; key++)
+	{
+		if (count[key] == 0)
+			continue;
+		spots[n].cycles = cycles[key];
+		spots[n].count = count[key];
+		spots[n].key = (uint32_t)key;
+		n++;
+	}
+	qsort(spots, n, sizeof(HotSpot), CompareHotSpots);
+	return n;
+}
+
+/*****************************************************************************
+ *** PRINT PROFILE: The top addresses and opcodes by cycles                ***
+ *****************************************************************************/
+void PrintProfile6510(State6510* state, int top)
+{
+	Profile6510* profile = state->profile;
+	HotSpot* spots;
+	uint64_t total = 0;
+	char line[DISASSEMBLY_LINE];
+	int n;
+
+	if (profile == NULL)
+		return;
+	spots = (HotSpot*)malloc(0x10000 * sizeof(HotSpot));
+	if (spots == NULL)
+		return;
+	FlushProfile(state);
+	for (int opcode = 0; opcode < 256; opcode++)
+		total += profile->opcode_cycles[opcode];
+	if (total == 0)
+		total = 1;
+
+	n = SortHotSpots(profile->count, profile->cycles, 0x10000, spots);
+	printf("Hot spots: %d addresses executed, top %d by cycles\n", n, n < top ? n : top);
+	printf("      cycles      %%    instructions  code\n");
+	for (int i = 0; i < n && i < top; i++)
+	{
+		DisassembleAt(state, (uint16_t)spots[i].key, line);
+		printf("%12llu %6.2f %15llu  %s\n", (unsigned long long)spots[i].cycles,
+			100.0 * spots[i].cycles / total, (unsigned long long)spots[i].count, line);
+	}
+
+	n = SortHotSpots(profile->opcode_count, profile->opcode_cycles, 256, spots);
+	printf("\nOpcodes: %d used, top %d by cycles\n", n, n < top ? n : top);
+	printf("      cycles      %%    instructions  opcode\n");
+	for (int i = 0; i < n && i < top; i++)
+		printf("%12llu %6.2f %15llu  %02X %s\n", (unsigned long long)spots[i].cycles,
+			100.0 * spots[i].cycles / total, (unsigned long long)spots[i].count,
+			spots[i].key, Mnemonic6510[spots[i].key]);
+	free(spots);
+}
+
+/*
+  Inclusive cycles per node. A callee is always created after its caller,
+  so one pass from the last node to the first adds every node to its
+  parent after all its own callees were added to it.
+
+  returns an array of node_count entries, NULL when out of memory
+*/
+static uint64_t* InclusiveCycles(const Profile6510* profile)
+{
+	uint64_t* inclusive = (uint64_t*)malloc(profile->node_count * sizeof(uint64_t));
+
+	if (inclusive == NULL)
+		return NULL;
+	for (int32_t i = 0; i < profile->node_count; i++)
+		inclusive[i] = profile->nodes[i].cycles;
+	for (int32_t i = profile->node_count - 1; i > 0; i--)
+		inclusive[profile->nodes[i].parent] += inclusive[i];
+	return inclusive;
+}
+
+static void PrintNode(const Profile6510* profile, const uint64_t* inclusive, int32_t node, int depth, uint64_t min_cycles)
+{
+	const CallNode6510* nodes = profile->nodes;
+	char buffer[8];
+	int32_t printed = -1;
+
+	printf("%12llu %12llu %10llu  %*s%s\n", (unsigned long long)inclusive[node],
+		(unsigned long long)nodes[node].cycles, (unsigned long long)nodes[node].calls,
+		depth * 2, "", node == 0 ? "top" : RoutineName(profile, nodes[node].routine, buffer));
+
+	// Callees by inclusive cycles, largest first
+	for (;;)
+	{
+		int32_t next = -1;
+
+		for (int32_t child = nodes[node].child; child >= 0; child = nodes[child].sibling)
+		{
+			if (inclusive[child] < min_cycles)
+				continue;
+			if (printed >= 0 && (inclusive[child] > inclusive[printed] ||
+				(inclusive[child] == inclusive[printed] && child <= printed)))
+				continue;
+			if (next < 0 || inclusive[child] > inclusive[next] ||
+				(inclusive[child] == inclusive[next] && child < next))
+				next = child;
+		}
+		if (next < 0)
+			break;
+		PrintNode(profile, inclusive, next, depth + 1, min_cycles);
+		printed = next;
+	}
+}
+
+typedef struct RoutineTotal {
+	uint64_t inclusive;
+	uint64_t exclusive;
+	uint64_t calls;
+} RoutineTotal;
+
+/*****************************************************************************
+ *** PRINT CALL TREE: Inclusive/exclusive cycles and calls per call path,  ***
+ *** paths below min_percent of all cycles are left out. Then the same per ***
+ *** routine over all paths, recursive calls are counted once inclusive.   ***
+ *****************************************************************************/
+void PrintCallTree6510(State6510* state, double min_percent)
+{
+	Profile6510* profile = state->profile;
+	uint64_t* inclusive;
+	RoutineTotal* totals;
+	HotSpot* spots;
+	char buffer[8];
+	int n = 0;
+
+	if (profile == NULL)
+		return;
+	FlushProfile(state);
+	inclusive = InclusiveCycles(profile);
+	totals = (RoutineTotal*)calloc(0x10000, sizeof(RoutineTotal));
+	spots = (HotSpot*)malloc(0x10000 * sizeof(HotSpot));
+	if (inclusive == NULL || totals == NULL || spots == NULL)
+	{
+		free(inclusive);
+		free(totals);
+		free(spots);
+		return;
+	}
+
+	printf("Call tree: %d nodes\n", profile->node_count);
+	printf("   inclusive    exclusive      calls  routine\n");
+	PrintNode(profile, inclusive, 0, 0, (uint64_t)(inclusive[0] * min_percent / 100.0));
+
+	for (int32_t i = 1; i < profile->node_count; i++)
+	{
+		const CallNode6510* node = &profile->nodes[i];
+		RoutineTotal* total = &totals[node->routine];
+		int32_t caller = node->parent;
+
+		while (caller > 0 && profile->nodes[caller].routine != node->routine)
+			caller = profile->nodes[caller].parent;
+		if (caller <= 0)
+			total->inclusive += inclusive[i];
+		total->exclusive += node->cycles;
+		total->calls += node->calls;
+	}
+	for (int routine = 0; routine < 0x10000; routine++)
+	{
+		if (totals[routine].calls == 0)
+			continue;
+		spots[n].cycles = totals[routine].inclusive;
+		spots[n].count = totals[routine].calls;
+		spots[n].key = (uint32_t)routine;
+		n++;
+	}
+	qsort(spots, n, sizeof(HotSpot), CompareHotSpots);
+	printf("\nRoutines: %d called\n", n);
+	printf("   inclusive    exclusive      calls  routine\n");
+	for (int i = 0; i < n && i < 20; i++)
+		printf("%12llu %12llu %10llu  %s\n", (unsigned long long)spots[i].cycles,
+			(unsigned long long)totals[spots[i].key].exclusive, (unsigned long long)spots[i].count,
+			RoutineName(profile, (uint16_t)spots[i].key, buffer));
+
+	free(spots);
+	free(totals);
+	free(inclusive);
+}
+
+/*****************************************************************************
+ *** WRITE FOLDED PROFILE: Exclusive cycles per call path in the folded    ***
+ *** stack format of flamegraph.pl, "top;CHROUT;$E716 cycles"             ***
+ ***                                                                       ***
+ *** returns 0 when the file was written                                   ***
+ *****************************************************************************/
+int WriteFoldedProfile6510(State6510* state, const char* filename)
+{
+	Profile6510* profile = state->profile;
+	int32_t path[PROFILE_DEPTH + 1];
+	char buffer[8];
+	FILE* f;
+
+	if (profile == NULL)
+		return 1;
+	f = fopen(filename, "w");
+	if (f == NULL)
+	{
+		printf("error: Couldn't write %s\n", filename);
+		return 1;
+	}
+	FlushProfile(state);
+	for (int32_t i = 0; i < profile->node_count; i++)
+	{
+		int depth = 0;
+
+		if (profile->nodes[i].cycles == 0)
+			continue;
+		for (int32_t node = i; node > 0 && depth < PROFILE_DEPTH; node = profile->nodes[node].parent)
+			path[depth++] = node;
+		fputs("top", f);
+		while (depth > 0)
+			fprintf(f, ";%s", RoutineName(profile, profile->nodes[path[--depth]].routine, buffer));
+		fprintf(f, " %llu\n", (unsigned long long)profile->nodes[i].cycles);
+	}
+	return fclose(f) != 0;
+}
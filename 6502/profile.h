@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "6502.h"
+
+/*
+	Execution profile
+
+	Only in builds with /DCPU_PROFILE=1 (see core.h), otherwise the
+	counters are not even looked at. While a profile runs, the core counts
+	per address and per opcode how often an instruction ran and how many
+	cycles it took, penalties included. The cycles of an instruction are
+	known when the next one starts, so they are added then (and by
+	FlushProfile for the last one).
+
+	Call graph: JSR and BRK push a frame on a shadow call stack, RTS and
+	RTI pop it, and every instruction adds its cycles to the call tree node
+	of the routine it runs in (exclusive cycles). The inclusive cycles of a
+	node are its own plus those of the nodes below it. A frame also keeps
+	the SP after the call, so code that drops return addresses from the
+	stack (PLA PLA, TXS) or returns with RTS into a pushed address does not
+	leave stale frames behind.
+
+	Routines are named from symbol files, see LoadSymbols6510.
+*/
+#define PROFILE_NODES		65536	// call tree nodes, deeper calls stay in the caller
+#define PROFILE_DEPTH		256
+#define PROFILE_SYMBOL		32		// longest name with '\0'
+
+typedef struct CallNode6510 {
+	uint16_t routine;  // entry address, 0 for the root
+	int32_t  parent;   // -1 for the root
+	int32_t  child;    // first callee, -1 = none
+	int32_t  sibling;  // next callee of the parent, -1 = none
+	uint64_t calls;
+	uint64_t cycles;   // exclusive
+} CallNode6510;
+
+typedef struct CallFrame6510 {
+	int32_t  node;
+	uint16_t sp;       // SP right after the return address was pushed
+} CallFrame6510;
+
+typedef struct Symbol6510 {
+	uint16_t address;
+	char     name[PROFILE_SYMBOL];
+} Symbol6510;
+
+struct Profile6510 {
+	uint64_t count[0x10000];     // instructions executed per PC
+	uint64_t cycles[0x10000];    // cycles per PC
+	uint64_t opcode_count[256];
+	uint64_t opcode_cycles[256];
+	uint16_t last_pc;            // instruction whose cycles are not added yet
+	uint8_t  last_opcode;
+	int32_t  last_node;
+	uint64_t last_cycles;        // state->cycles when it started
+
+	CallNode6510 *nodes;         // nodes[0] is the root
+	int32_t  node_count;
+	int32_t  node;               // routine running now
+	CallFrame6510 stack[PROFILE_DEPTH];
+	int      depth;
+
+	Symbol6510 *symbols;         // sorted by address
+	int      symbol_count;
+};
+
+int StartProfile6510(State6510* state);
+void StopProfile6510(State6510* state);
+void ProfileCall6510(State6510* state, int pushed);
+void ProfileReturn6510(State6510* state);
+int LoadSymbols6510(State6510* state, const char* filename);
+void PrintProfile6510(State6510* state, int top);
+void PrintCallTree6510(State6510* state, double min_percent);
+int WriteFoldedProfile6510(State6510* state, const char* filename);
@@ -0,0 +1,30 @@
+# Writes ../romdata.c with the ROM images of this directory as constant
+# data, see C64_LoadROM. Run by the build when a .rom file changes.
+import os
+
+ROMS = [
+	("basic.rom", "BasicROM6510", 8192),
+	("kernal.rom", "KernalROM6510", 8192),
+	("char.rom", "CharROM6510", 4096),
+]
+
+here = os.path.dirname(os.path.abspath(__file__))
+lines = [
+	"// Generated by rom/embed.py from the images in rom/, do not edit",
+	"#include <stdint.h>",
+	"",
+	"#include \"core.h\"",
+]
+for filename, name, size in ROMS:
+	with open(os.path.join(here, filename), "rb") as f:
+		data = f.read()
+	if len(data) != size:
+		raise SystemExit("error: %s is %d bytes, not %d" % (filename, len(data), size))
+	lines.append("")
+	lines.append("const uint8_t %s[%d] = {" % (name, size))
+	for i in range(0, size, 16):
+		lines.append("\t" + ",".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+	lines.append("};")
+
+with open(os.path.join(here, "..", "romdata.c"), "w", newline="\n") as f:
+	f.write("\n".join(lines) + "\n")
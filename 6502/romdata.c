@@ -0,0 +1,1293 @@
+// Generated by rom/embed.py from the images in rom/, do not edit
+#include <stdint.h>
+
+#include "core.h"
+
+const uint8_t BasicROM6510[8192] = {
+	0x94,0xE3,0x7B,0xE3,0x43,0x42,0x4D,0x42,0x41,0x53,0x49,0x43,0x30,0xA8,0x41,0xA7,
+	0x1D,0xAD,0xF7,0xA8,0xA4,0xAB,0xBE,0xAB,0x80,0xB0,0x05,0xAC,0xA4,0xA9,0x9F,0xA8,
+	0x70,0xA8,0x27,0xA9,0x1C,0xA8,0x82,0xA8,0xD1,0xA8,0x3A,0xA9,0x2E,0xA8,0x4A,0xA9,
+	0x2C,0xB8,0x67,0xE1,0x55,0xE1,0x64,0xE1,0xB2,0xB3,0x23,0xB8,0x7F,0xAA,0x9F,0xAA,
+	0x56,0xA8,0x9B,0xA6,0x5D,0xA6,0x85,0xAA,0x29,0xE1,0xBD,0xE1,0xC6,0xE1,0x7A,0xAB,
+	0x41,0xA6,0x39,0xBC,0xCC,0xBC,0x58,0xBC,0x10,0x03,0x7D,0xB3,0x9E,0xB3,0x71,0xBF,
+	0x97,0xE0,0xEA,0xB9,0xED,0xBF,0x64,0xE2,0x6B,0xE2,0xB4,0xE2,0x0E,0xE3,0x0D,0xB8,
+	0x7C,0xB7,0x65,0xB4,0xAD,0xB7,0x8B,0xB7,0xEC,0xB6,0x00,0xB7,0x2C,0xB7,0x37,0xB7,
+	0x79,0x69,0xB8,0x79,0x52,0xB8,0x7B,0x2A,0xBA,0x7B,0x11,0xBB,0x7F,0x7A,0xBF,0x50,
+	0xE8,0xAF,0x46,0xE5,0xAF,0x7D,0xB3,0xBF,0x5A,0xD3,0xAE,0x64,0x15,0xB0,0x45,0x4E,
+	0xC4,0x46,0x4F,0xD2,0x4E,0x45,0x58,0xD4,0x44,0x41,0x54,0xC1,0x49,0x4E,0x50,0x55,
+	0x54,0xA3,0x49,0x4E,0x50,0x55,0xD4,0x44,0x49,0xCD,0x52,0x45,0x41,0xC4,0x4C,0x45,
+	0xD4,0x47,0x4F,0x54,0xCF,0x52,0x55,0xCE,0x49,0xC6,0x52,0x45,0x53,0x54,0x4F,0x52,
+	0xC5,0x47,0x4F,0x53,0x55,0xC2,0x52,0x45,0x54,0x55,0x52,0xCE,0x52,0x45,0xCD,0x53,
+	0x54,0x4F,0xD0,0x4F,0xCE,0x57,0x41,0x49,0xD4,0x4C,0x4F,0x41,0xC4,0x53,0x41,0x56,
+	0xC5,0x56,0x45,0x52,0x49,0x46,0xD9,0x44,0x45,0xC6,0x50,0x4F,0x4B,0xC5,0x50,0x52,
+	0x49,0x4E,0x54,0xA3,0x50,0x52,0x49,0x4E,0xD4,0x43,0x4F,0x4E,0xD4,0x4C,0x49,0x53,
+	0xD4,0x43,0x4C,0xD2,0x43,0x4D,0xC4,0x53,0x59,0xD3,0x4F,0x50,0x45,0xCE,0x43,0x4C,
+	0x4F,0x53,0xC5,0x47,0x45,0xD4,0x4E,0x45,0xD7,0x54,0x41,0x42,0xA8,0x54,0xCF,0x46,
+	0xCE,0x53,0x50,0x43,0xA8,0x54,0x48,0x45,0xCE,0x4E,0x4F,0xD4,0x53,0x54,0x45,0xD0,
+	0xAB,0xAD,0xAA,0xAF,0xDE,0x41,0x4E,0xC4,0x4F,0xD2,0xBE,0xBD,0xBC,0x53,0x47,0xCE,
+	0x49,0x4E,0xD4,0x41,0x42,0xD3,0x55,0x53,0xD2,0x46,0x52,0xC5,0x50,0x4F,0xD3,0x53,
+	0x51,0xD2,0x52,0x4E,0xC4,0x4C,0x4F,0xC7,0x45,0x58,0xD0,0x43,0x4F,0xD3,0x53,0x49,
+	0xCE,0x54,0x41,0xCE,0x41,0x54,0xCE,0x50,0x45,0x45,0xCB,0x4C,0x45,0xCE,0x53,0x54,
+	0x52,0xA4,0x56,0x41,0xCC,0x41,0x53,0xC3,0x43,0x48,0x52,0xA4,0x4C,0x45,0x46,0x54,
+	0xA4,0x52,0x49,0x47,0x48,0x54,0xA4,0x4D,0x49,0x44,0xA4,0x47,0xCF,0x00,0x54,0x4F,
+	0x4F,0x20,0x4D,0x41,0x4E,0x59,0x20,0x46,0x49,0x4C,0x45,0xD3,0x46,0x49,0x4C,0x45,
+	0x20,0x4F,0x50,0x45,0xCE,0x46,0x49,0x4C,0x45,0x20,0x4E,0x4F,0x54,0x20,0x4F,0x50,
+	0x45,0xCE,0x46,0x49,0x4C,0x45,0x20,0x4E,0x4F,0x54,0x20,0x46,0x4F,0x55,0x4E,0xC4,
+	0x44,0x45,0x56,0x49,0x43,0x45,0x20,0x4E,0x4F,0x54,0x20,0x50,0x52,0x45,0x53,0x45,
+	0x4E,0xD4,0x4E,0x4F,0x54,0x20,0x49,0x4E,0x50,0x55,0x54,0x20,0x46,0x49,0x4C,0xC5,
+	0x4E,0x4F,0x54,0x20,0x4F,0x55,0x54,0x50,0x55,0x54,0x20,0x46,0x49,0x4C,0xC5,0x4D,
+	0x49,0x53,0x53,0x49,0x4E,0x47,0x20,0x46,0x49,0x4C,0x45,0x20,0x4E,0x41,0x4D,0xC5,
+	0x49,0x4C,0x4C,0x45,0x47,0x41,0x4C,0x20,0x44,0x45,0x56,0x49,0x43,0x45,0x20,0x4E,
+	0x55,0x4D,0x42,0x45,0xD2,0x4E,0x45,0x58,0x54,0x20,0x57,0x49,0x54,0x48,0x4F,0x55,
+	0x54,0x20,0x46,0x4F,0xD2,0x53,0x59,0x4E,0x54,0x41,0xD8,0x52,0x45,0x54,0x55,0x52,
+	0x4E,0x20,0x57,0x49,0x54,0x48,0x4F,0x55,0x54,0x20,0x47,0x4F,0x53,0x55,0xC2,0x4F,
+	0x55,0x54,0x20,0x4F,0x46,0x20,0x44,0x41,0x54,0xC1,0x49,0x4C,0x4C,0x45,0x47,0x41,
+	0x4C,0x20,0x51,0x55,0x41,0x4E,0x54,0x49,0x54,0xD9,0x4F,0x56,0x45,0x52,0x46,0x4C,
+	0x4F,0xD7,0x4F,0x55,0x54,0x20,0x4F,0x46,0x20,0x4D,0x45,0x4D,0x4F,0x52,0xD9,0x55,
+	0x4E,0x44,0x45,0x46,0x27,0x44,0x20,0x53,0x54,0x41,0x54,0x45,0x4D,0x45,0x4E,0xD4,
+	0x42,0x41,0x44,0x20,0x53,0x55,0x42,0x53,0x43,0x52,0x49,0x50,0xD4,0x52,0x45,0x44,
+	0x49,0x4D,0x27,0x44,0x20,0x41,0x52,0x52,0x41,0xD9,0x44,0x49,0x56,0x49,0x53,0x49,
+	0x4F,0x4E,0x20,0x42,0x59,0x20,0x5A,0x45,0x52,0xCF,0x49,0x4C,0x4C,0x45,0x47,0x41,
+	0x4C,0x20,0x44,0x49,0x52,0x45,0x43,0xD4,0x54,0x59,0x50,0x45,0x20,0x4D,0x49,0x53,
+	0x4D,0x41,0x54,0x43,0xC8,0x53,0x54,0x52,0x49,0x4E,0x47,0x20,0x54,0x4F,0x4F,0x20,
+	0x4C,0x4F,0x4E,0xC7,0x46,0x49,0x4C,0x45,0x20,0x44,0x41,0x54,0xC1,0x46,0x4F,0x52,
+	0x4D,0x55,0x4C,0x41,0x20,0x54,0x4F,0x4F,0x20,0x43,0x4F,0x4D,0x50,0x4C,0x45,0xD8,
+	0x43,0x41,0x4E,0x27,0x54,0x20,0x43,0x4F,0x4E,0x54,0x49,0x4E,0x55,0xC5,0x55,0x4E,
+	0x44,0x45,0x46,0x27,0x44,0x20,0x46,0x55,0x4E,0x43,0x54,0x49,0x4F,0xCE,0x56,0x45,
+	0x52,0x49,0x46,0xD9,0x4C,0x4F,0x41,0xC4,0x9E,0xA1,0xAC,0xA1,0xB5,0xA1,0xC2,0xA1,
+	0xD0,0xA1,0xE2,0xA1,0xF0,0xA1,0xFF,0xA1,0x10,0xA2,0x25,0xA2,0x35,0xA2,0x3B,0xA2,
+	0x4F,0xA2,0x5A,0xA2,0x6A,0xA2,0x72,0xA2,0x7F,0xA2,0x90,0xA2,0x9D,0xA2,0xAA,0xA2,
+	0xBA,0xA2,0xC8,0xA2,0xD5,0xA2,0xE4,0xA2,0xED,0xA2,0x00,0xA3,0x0E,0xA3,0x1E,0xA3,
+	0x24,0xA3,0x83,0xA3,0x0D,0x4F,0x4B,0x0D,0x00,0x20,0x20,0x45,0x52,0x52,0x4F,0x52,
+	0x00,0x20,0x49,0x4E,0x20,0x00,0x0D,0x0A,0x52,0x45,0x41,0x44,0x59,0x2E,0x0D,0x0A,
+	0x00,0x0D,0x0A,0x42,0x52,0x45,0x41,0x4B,0x00,0xA0,0xBA,0xE8,0xE8,0xE8,0xE8,0xBD,
+	0x01,0x01,0xC9,0x81,0xD0,0x21,0xA5,0x4A,0xD0,0x0A,0xBD,0x02,0x01,0x85,0x49,0xBD,
+	0x03,0x01,0x85,0x4A,0xDD,0x03,0x01,0xD0,0x07,0xA5,0x49,0xDD,0x02,0x01,0xF0,0x07,
+	0x8A,0x18,0x69,0x12,0xAA,0xD0,0xD8,0x60,0x20,0x08,0xA4,0x85,0x31,0x84,0x32,0x38,
+	0xA5,0x5A,0xE5,0x5F,0x85,0x22,0xA8,0xA5,0x5B,0xE5,0x60,0xAA,0xE8,0x98,0xF0,0x23,
+	0xA5,0x5A,0x38,0xE5,0x22,0x85,0x5A,0xB0,0x03,0xC6,0x5B,0x38,0xA5,0x58,0xE5,0x22,
+	0x85,0x58,0xB0,0x08,0xC6,0x59,0x90,0x04,0xB1,0x5A,0x91,0x58,0x88,0xD0,0xF9,0xB1,
+	0x5A,0x91,0x58,0xC6,0x5B,0xC6,0x59,0xCA,0xD0,0xF2,0x60,0x0A,0x69,0x3E,0xB0,0x35,
+	0x85,0x22,0xBA,0xE4,0x22,0x90,0x2E,0x60,0xC4,0x34,0x90,0x28,0xD0,0x04,0xC5,0x33,
+	0x90,0x22,0x48,0xA2,0x09,0x98,0x48,0xB5,0x57,0xCA,0x10,0xFA,0x20,0x26,0xB5,0xA2,
+	0xF7,0x68,0x95,0x61,0xE8,0x30,0xFA,0x68,0xA8,0x68,0xC4,0x34,0x90,0x06,0xD0,0x05,
+	0xC5,0x33,0xB0,0x01,0x60,0xA2,0x10,0x6C,0x00,0x03,0x8A,0x0A,0xAA,0xBD,0x26,0xA3,
+	0x85,0x22,0xBD,0x27,0xA3,0x85,0x23,0x20,0xCC,0xFF,0xA9,0x00,0x85,0x13,0x20,0xD7,
+	0xAA,0x20,0x45,0xAB,0xA0,0x00,0xB1,0x22,0x48,0x29,0x7F,0x20,0x47,0xAB,0xC8,0x68,
+	0x10,0xF4,0x20,0x7A,0xA6,0xA9,0x69,0xA0,0xA3,0x20,0x1E,0xAB,0xA4,0x3A,0xC8,0xF0,
+	0x03,0x20,0xC2,0xBD,0xA9,0x76,0xA0,0xA3,0x20,0x1E,0xAB,0xA9,0x80,0x20,0x90,0xFF,
+	0x6C,0x02,0x03,0x20,0x60,0xA5,0x86,0x7A,0x84,0x7B,0x20,0x73,0x00,0xAA,0xF0,0xF0,
+	0xA2,0xFF,0x86,0x3A,0x90,0x06,0x20,0x79,0xA5,0x4C,0xE1,0xA7,0x20,0x6B,0xA9,0x20,
+	0x79,0xA5,0x84,0x0B,0x20,0x13,0xA6,0x90,0x44,0xA0,0x01,0xB1,0x5F,0x85,0x23,0xA5,
+	0x2D,0x85,0x22,0xA5,0x60,0x85,0x25,0xA5,0x5F,0x88,0xF1,0x5F,0x18,0x65,0x2D,0x85,
+	0x2D,0x85,0x24,0xA5,0x2E,0x69,0xFF,0x85,0x2E,0xE5,0x60,0xAA,0x38,0xA5,0x5F,0xE5,
+	0x2D,0xA8,0xB0,0x03,0xE8,0xC6,0x25,0x18,0x65,0x22,0x90,0x03,0xC6,0x23,0x18,0xB1,
+	0x22,0x91,0x24,0xC8,0xD0,0xF9,0xE6,0x23,0xE6,0x25,0xCA,0xD0,0xF2,0x20,0x59,0xA6,
+	0x20,0x33,0xA5,0xAD,0x00,0x02,0xF0,0x88,0x18,0xA5,0x2D,0x85,0x5A,0x65,0x0B,0x85,
+	0x58,0xA4,0x2E,0x84,0x5B,0x90,0x01,0xC8,0x84,0x59,0x20,0xB8,0xA3,0xA5,0x14,0xA4,
+	0x15,0x8D,0xFE,0x01,0x8C,0xFF,0x01,0xA5,0x31,0xA4,0x32,0x85,0x2D,0x84,0x2E,0xA4,
+	0x0B,0x88,0xB9,0xFC,0x01,0x91,0x5F,0x88,0x10,0xF8,0x20,0x59,0xA6,0x20,0x33,0xA5,
+	0x4C,0x80,0xA4,0xA5,0x2B,0xA4,0x2C,0x85,0x22,0x84,0x23,0x18,0xA0,0x01,0xB1,0x22,
+	0xF0,0x1D,0xA0,0x04,0xC8,0xB1,0x22,0xD0,0xFB,0xC8,0x98,0x65,0x22,0xAA,0xA0,0x00,
+	0x91,0x22,0xA5,0x23,0x69,0x00,0xC8,0x91,0x22,0x86,0x22,0x85,0x23,0x90,0xDD,0x60,
+	0xA2,0x00,0x20,0x12,0xE1,0xC9,0x0D,0xF0,0x0D,0x9D,0x00,0x02,0xE8,0xE0,0x59,0x90,
+	0xF1,0xA2,0x17,0x4C,0x37,0xA4,0x4C,0xCA,0xAA,0x6C,0x04,0x03,0xA6,0x7A,0xA0,0x04,
+	0x84,0x0F,0xBD,0x00,0x02,0x10,0x07,0xC9,0xFF,0xF0,0x3E,0xE8,0xD0,0xF4,0xC9,0x20,
+	0xF0,0x37,0x85,0x08,0xC9,0x22,0xF0,0x56,0x24,0x0F,0x70,0x2D,0xC9,0x3F,0xD0,0x04,
+	0xA9,0x99,0xD0,0x25,0xC9,0x30,0x90,0x04,0xC9,0x3C,0x90,0x1D,0x84,0x71,0xA0,0x00,
+	0x84,0x0B,0x88,0x86,0x7A,0xCA,0xC8,0xE8,0xBD,0x00,0x02,0x38,0xF9,0x9E,0xA0,0xF0,
+	0xF5,0xC9,0x80,0xD0,0x30,0x05,0x0B,0xA4,0x71,0xE8,0xC8,0x99,0xFB,0x01,0xB9,0xFB,
+	0x01,0xF0,0x36,0x38,0xE9,0x3A,0xF0,0x04,0xC9,0x49,0xD0,0x02,0x85,0x0F,0x38,0xE9,
+	0x55,0xD0,0x9F,0x85,0x08,0xBD,0x00,0x02,0xF0,0xDF,0xC5,0x08,0xF0,0xDB,0xC8,0x99,
+	0xFB,0x01,0xE8,0xD0,0xF0,0xA6,0x7A,0xE6,0x0B,0xC8,0xB9,0x9D,0xA0,0x10,0xFA,0xB9,
+	0x9E,0xA0,0xD0,0xB4,0xBD,0x00,0x02,0x10,0xBE,0x99,0xFD,0x01,0xC6,0x7B,0xA9,0xFF,
+	0x85,0x7A,0x60,0xA5,0x2B,0xA6,0x2C,0xA0,0x01,0x85,0x5F,0x86,0x60,0xB1,0x5F,0xF0,
+	0x1F,0xC8,0xC8,0xA5,0x15,0xD1,0x5F,0x90,0x18,0xF0,0x03,0x88,0xD0,0x09,0xA5,0x14,
+	0x88,0xD1,0x5F,0x90,0x0C,0xF0,0x0A,0x88,0xB1,0x5F,0xAA,0x88,0xB1,0x5F,0xB0,0xD7,
+	0x18,0x60,0xD0,0xFD,0xA9,0x00,0xA8,0x91,0x2B,0xC8,0x91,0x2B,0xA5,0x2B,0x18,0x69,
+	0x02,0x85,0x2D,0xA5,0x2C,0x69,0x00,0x85,0x2E,0x20,0x8E,0xA6,0xA9,0x00,0xD0,0x2D,
+	0x20,0xE7,0xFF,0xA5,0x37,0xA4,0x38,0x85,0x33,0x84,0x34,0xA5,0x2D,0xA4,0x2E,0x85,
+	0x2F,0x84,0x30,0x85,0x31,0x84,0x32,0x20,0x1D,0xA8,0xA2,0x19,0x86,0x16,0x68,0xA8,
+	0x68,0xA2,0xFA,0x9A,0x48,0x98,0x48,0xA9,0x00,0x85,0x3E,0x85,0x10,0x60,0x18,0xA5,
+	0x2B,0x69,0xFF,0x85,0x7A,0xA5,0x2C,0x69,0xFF,0x85,0x7B,0x60,0x90,0x06,0xF0,0x04,
+	0xC9,0xAB,0xD0,0xE9,0x20,0x6B,0xA9,0x20,0x13,0xA6,0x20,0x79,0x00,0xF0,0x0C,0xC9,
+	0xAB,0xD0,0x8E,0x20,0x73,0x00,0x20,0x6B,0xA9,0xD0,0x86,0x68,0x68,0xA5,0x14,0x05,
+	0x15,0xD0,0x06,0xA9,0xFF,0x85,0x14,0x85,0x15,0xA0,0x01,0x84,0x0F,0xB1,0x5F,0xF0,
+	0x43,0x20,0x2C,0xA8,0x20,0xD7,0xAA,0xC8,0xB1,0x5F,0xAA,0xC8,0xB1,0x5F,0xC5,0x15,
+	0xD0,0x04,0xE4,0x14,0xF0,0x02,0xB0,0x2C,0x84,0x49,0x20,0xCD,0xBD,0xA9,0x20,0xA4,
+	0x49,0x29,0x7F,0x20,0x47,0xAB,0xC9,0x22,0xD0,0x06,0xA5,0x0F,0x49,0xFF,0x85,0x0F,
+	0xC8,0xF0,0x11,0xB1,0x5F,0xD0,0x10,0xA8,0xB1,0x5F,0xAA,0xC8,0xB1,0x5F,0x86,0x5F,
+	0x85,0x60,0xD0,0xB5,0x4C,0x86,0xE3,0x6C,0x06,0x03,0x10,0xD7,0xC9,0xFF,0xF0,0xD3,
+	0x24,0x0F,0x30,0xCF,0x38,0xE9,0x7F,0xAA,0x84,0x49,0xA0,0xFF,0xCA,0xF0,0x08,0xC8,
+	0xB9,0x9E,0xA0,0x10,0xFA,0x30,0xF5,0xC8,0xB9,0x9E,0xA0,0x30,0xB2,0x20,0x47,0xAB,
+	0xD0,0xF5,0xA9,0x80,0x85,0x10,0x20,0xA5,0xA9,0x20,0x8A,0xA3,0xD0,0x05,0x8A,0x69,
+	0x0F,0xAA,0x9A,0x68,0x68,0xA9,0x09,0x20,0xFB,0xA3,0x20,0x06,0xA9,0x18,0x98,0x65,
+	0x7A,0x48,0xA5,0x7B,0x69,0x00,0x48,0xA5,0x3A,0x48,0xA5,0x39,0x48,0xA9,0xA4,0x20,
+	0xFF,0xAE,0x20,0x8D,0xAD,0x20,0x8A,0xAD,0xA5,0x66,0x09,0x7F,0x25,0x62,0x85,0x62,
+	0xA9,0x8B,0xA0,0xA7,0x85,0x22,0x84,0x23,0x4C,0x43,0xAE,0xA9,0xBC,0xA0,0xB9,0x20,
+	0xA2,0xBB,0x20,0x79,0x00,0xC9,0xA9,0xD0,0x06,0x20,0x73,0x00,0x20,0x8A,0xAD,0x20,
+	0x2B,0xBC,0x20,0x38,0xAE,0xA5,0x4A,0x48,0xA5,0x49,0x48,0xA9,0x81,0x48,0x20,0x2C,
+	0xA8,0xA5,0x7A,0xA4,0x7B,0xC0,0x02,0xEA,0xF0,0x04,0x85,0x3D,0x84,0x3E,0xA0,0x00,
+	0xB1,0x7A,0xD0,0x43,0xA0,0x02,0xB1,0x7A,0x18,0xD0,0x03,0x4C,0x4B,0xA8,0xC8,0xB1,
+	0x7A,0x85,0x39,0xC8,0xB1,0x7A,0x85,0x3A,0x98,0x65,0x7A,0x85,0x7A,0x90,0x02,0xE6,
+	0x7B,0x6C,0x08,0x03,0x20,0x73,0x00,0x20,0xED,0xA7,0x4C,0xAE,0xA7,0xF0,0x3C,0xE9,
+	0x80,0x90,0x11,0xC9,0x23,0xB0,0x17,0x0A,0xA8,0xB9,0x0D,0xA0,0x48,0xB9,0x0C,0xA0,
+	0x48,0x4C,0x73,0x00,0x4C,0xA5,0xA9,0xC9,0x3A,0xF0,0xD6,0x4C,0x08,0xAF,0xC9,0x4B,
+	0xD0,0xF9,0x20,0x73,0x00,0xA9,0xA4,0x20,0xFF,0xAE,0x4C,0xA0,0xA8,0x38,0xA5,0x2B,
+	0xE9,0x01,0xA4,0x2C,0xB0,0x01,0x88,0x85,0x41,0x84,0x42,0x60,0x20,0xE1,0xFF,0xB0,
+	0x01,0x18,0xD0,0x3C,0xA5,0x7A,0xA4,0x7B,0xA6,0x3A,0xE8,0xF0,0x0C,0x85,0x3D,0x84,
+	0x3E,0xA5,0x39,0xA4,0x3A,0x85,0x3B,0x84,0x3C,0x68,0x68,0xA9,0x81,0xA0,0xA3,0x90,
+	0x03,0x4C,0x69,0xA4,0x4C,0x86,0xE3,0xD0,0x17,0xA2,0x1A,0xA4,0x3E,0xD0,0x03,0x4C,
+	0x37,0xA4,0xA5,0x3D,0x85,0x7A,0x84,0x7B,0xA5,0x3B,0xA4,0x3C,0x85,0x39,0x84,0x3A,
+	0x60,0x08,0xA9,0x00,0x20,0x90,0xFF,0x28,0xD0,0x03,0x4C,0x59,0xA6,0x20,0x60,0xA6,
+	0x4C,0x97,0xA8,0xA9,0x03,0x20,0xFB,0xA3,0xA5,0x7B,0x48,0xA5,0x7A,0x48,0xA5,0x3A,
+	0x48,0xA5,0x39,0x48,0xA9,0x8D,0x48,0x20,0x79,0x00,0x20,0xA0,0xA8,0x4C,0xAE,0xA7,
+	0x20,0x6B,0xA9,0x20,0x09,0xA9,0x38,0xA5,0x39,0xE5,0x14,0xA5,0x3A,0xE5,0x15,0xB0,
+	0x0B,0x98,0x38,0x65,0x7A,0xA6,0x7B,0x90,0x07,0xE8,0xB0,0x04,0xA5,0x2B,0xA6,0x2C,
+	0x20,0x17,0xA6,0x90,0x1E,0xA5,0x5F,0xE9,0x01,0x85,0x7A,0xA5,0x60,0xE9,0x00,0x85,
+	0x7B,0x60,0xD0,0xFD,0xA9,0xFF,0x85,0x4A,0x20,0x8A,0xA3,0x9A,0xC9,0x8D,0xF0,0x0B,
+	0xA2,0x0C,0x2C,0xA2,0x11,0x4C,0x37,0xA4,0x4C,0x08,0xAF,0x68,0x68,0x85,0x39,0x68,
+	0x85,0x3A,0x68,0x85,0x7A,0x68,0x85,0x7B,0x20,0x06,0xA9,0x98,0x18,0x65,0x7A,0x85,
+	0x7A,0x90,0x02,0xE6,0x7B,0x60,0xA2,0x3A,0x2C,0xA2,0x00,0x86,0x07,0xA0,0x00,0x84,
+	0x08,0xA5,0x08,0xA6,0x07,0x85,0x07,0x86,0x08,0xB1,0x7A,0xF0,0xE8,0xC5,0x08,0xF0,
+	0xE4,0xC8,0xC9,0x22,0xD0,0xF3,0xF0,0xE9,0x20,0x9E,0xAD,0x20,0x79,0x00,0xC9,0x89,
+	0xF0,0x05,0xA9,0xA7,0x20,0xFF,0xAE,0xA5,0x61,0xD0,0x05,0x20,0x09,0xA9,0xF0,0xBB,
+	0x20,0x79,0x00,0xB0,0x03,0x4C,0xA0,0xA8,0x4C,0xED,0xA7,0x20,0x9E,0xB7,0x48,0xC9,
+	0x8D,0xF0,0x04,0xC9,0x89,0xD0,0x91,0xC6,0x65,0xD0,0x04,0x68,0x4C,0xEF,0xA7,0x20,
+	0x73,0x00,0x20,0x6B,0xA9,0xC9,0x2C,0xF0,0xEE,0x68,0x60,0xA2,0x00,0x86,0x14,0x86,
+	0x15,0xB0,0xF7,0xE9,0x2F,0x85,0x07,0xA5,0x15,0x85,0x22,0xC9,0x19,0xB0,0xD4,0xA5,
+	0x14,0x0A,0x26,0x22,0x0A,0x26,0x22,0x65,0x14,0x85,0x14,0xA5,0x22,0x65,0x15,0x85,
+	0x15,0x06,0x14,0x26,0x15,0xA5,0x14,0x65,0x07,0x85,0x14,0x90,0x02,0xE6,0x15,0x20,
+	0x73,0x00,0x4C,0x71,0xA9,0x20,0x8B,0xB0,0x85,0x49,0x84,0x4A,0xA9,0xB2,0x20,0xFF,
+	0xAE,0xA5,0x0E,0x48,0xA5,0x0D,0x48,0x20,0x9E,0xAD,0x68,0x2A,0x20,0x90,0xAD,0xD0,
+	0x18,0x68,0x10,0x12,0x20,0x1B,0xBC,0x20,0xBF,0xB1,0xA0,0x00,0xA5,0x64,0x91,0x49,
+	0xC8,0xA5,0x65,0x91,0x49,0x60,0x4C,0xD0,0xBB,0x68,0xA4,0x4A,0xC0,0xBF,0xD0,0x4C,
+	0x20,0xA6,0xB6,0xC9,0x06,0xD0,0x3D,0xA0,0x00,0x84,0x61,0x84,0x66,0x84,0x71,0x20,
+	0x1D,0xAA,0x20,0xE2,0xBA,0xE6,0x71,0xA4,0x71,0x20,0x1D,0xAA,0x20,0x0C,0xBC,0xAA,
+	0xF0,0x05,0xE8,0x8A,0x20,0xED,0xBA,0xA4,0x71,0xC8,0xC0,0x06,0xD0,0xDF,0x20,0xE2,
+	0xBA,0x20,0x9B,0xBC,0xA6,0x64,0xA4,0x63,0xA5,0x65,0x4C,0xDB,0xFF,0xB1,0x22,0x20,
+	0x80,0x00,0x90,0x03,0x4C,0x48,0xB2,0xE9,0x2F,0x4C,0x7E,0xBD,0xA0,0x02,0xB1,0x64,
+	0xC5,0x34,0x90,0x17,0xD0,0x07,0x88,0xB1,0x64,0xC5,0x33,0x90,0x0E,0xA4,0x65,0xC4,
+	0x2E,0x90,0x08,0xD0,0x0D,0xA5,0x64,0xC5,0x2D,0xB0,0x07,0xA5,0x64,0xA4,0x65,0x4C,
+	0x68,0xAA,0xA0,0x00,0xB1,0x64,0x20,0x75,0xB4,0xA5,0x50,0xA4,0x51,0x85,0x6F,0x84,
+	0x70,0x20,0x7A,0xB6,0xA9,0x61,0xA0,0x00,0x85,0x50,0x84,0x51,0x20,0xDB,0xB6,0xA0,
+	0x00,0xB1,0x50,0x91,0x49,0xC8,0xB1,0x50,0x91,0x49,0xC8,0xB1,0x50,0x91,0x49,0x60,
+	0x20,0x86,0xAA,0x4C,0xB5,0xAB,0x20,0x9E,0xB7,0xF0,0x05,0xA9,0x2C,0x20,0xFF,0xAE,
+	0x08,0x86,0x13,0x20,0x18,0xE1,0x28,0x4C,0xA0,0xAA,0x20,0x21,0xAB,0x20,0x79,0x00,
+	0xF0,0x35,0xF0,0x43,0xC9,0xA3,0xF0,0x50,0xC9,0xA6,0x18,0xF0,0x4B,0xC9,0x2C,0xF0,
+	0x37,0xC9,0x3B,0xF0,0x5E,0x20,0x9E,0xAD,0x24,0x0D,0x30,0xDE,0x20,0xDD,0xBD,0x20,
+	0x87,0xB4,0x20,0x21,0xAB,0x20,0x3B,0xAB,0xD0,0xD3,0xA9,0x00,0x9D,0x00,0x02,0xA2,
+	0xFF,0xA0,0x01,0xA5,0x13,0xD0,0x10,0xA9,0x0D,0x20,0x47,0xAB,0x24,0x13,0x10,0x05,
+	0xA9,0x0A,0x20,0x47,0xAB,0x49,0xFF,0x60,0x38,0x20,0xF0,0xFF,0x98,0x38,0xE9,0x0A,
+	0xB0,0xFC,0x49,0xFF,0x69,0x01,0xD0,0x16,0x08,0x38,0x20,0xF0,0xFF,0x84,0x09,0x20,
+	0x9B,0xB7,0xC9,0x29,0xD0,0x59,0x28,0x90,0x06,0x8A,0xE5,0x09,0x90,0x05,0xAA,0xE8,
+	0xCA,0xD0,0x06,0x20,0x73,0x00,0x4C,0xA2,0xAA,0x20,0x3B,0xAB,0xD0,0xF2,0x20,0x87,
+	0xB4,0x20,0xA6,0xB6,0xAA,0xA0,0x00,0xE8,0xCA,0xF0,0xBC,0xB1,0x22,0x20,0x47,0xAB,
+	0xC8,0xC9,0x0D,0xD0,0xF3,0x20,0xE5,0xAA,0x4C,0x28,0xAB,0xA5,0x13,0xF0,0x03,0xA9,
+	0x20,0x2C,0xA9,0x1D,0x2C,0xA9,0x3F,0x20,0x0C,0xE1,0x29,0xFF,0x60,0xA5,0x11,0xF0,
+	0x11,0x30,0x04,0xA0,0xFF,0xD0,0x04,0xA5,0x3F,0xA4,0x40,0x85,0x39,0x84,0x3A,0x4C,
+	0x08,0xAF,0xA5,0x13,0xF0,0x05,0xA2,0x18,0x4C,0x37,0xA4,0xA9,0x0C,0xA0,0xAD,0x20,
+	0x1E,0xAB,0xA5,0x3D,0xA4,0x3E,0x85,0x7A,0x84,0x7B,0x60,0x20,0xA6,0xB3,0xC9,0x23,
+	0xD0,0x10,0x20,0x73,0x00,0x20,0x9E,0xB7,0xA9,0x2C,0x20,0xFF,0xAE,0x86,0x13,0x20,
+	0x1E,0xE1,0xA2,0x01,0xA0,0x02,0xA9,0x00,0x8D,0x01,0x02,0xA9,0x40,0x20,0x0F,0xAC,
+	0xA6,0x13,0xD0,0x13,0x60,0x20,0x9E,0xB7,0xA9,0x2C,0x20,0xFF,0xAE,0x86,0x13,0x20,
+	0x1E,0xE1,0x20,0xCE,0xAB,0xA5,0x13,0x20,0xCC,0xFF,0xA2,0x00,0x86,0x13,0x60,0xC9,
+	0x22,0xD0,0x0B,0x20,0xBD,0xAE,0xA9,0x3B,0x20,0xFF,0xAE,0x20,0x21,0xAB,0x20,0xA6,
+	0xB3,0xA9,0x2C,0x8D,0xFF,0x01,0x20,0xF9,0xAB,0xA5,0x13,0xF0,0x0D,0x20,0xB7,0xFF,
+	0x29,0x02,0xF0,0x06,0x20,0xB5,0xAB,0x4C,0xF8,0xA8,0xAD,0x00,0x02,0xD0,0x1E,0xA5,
+	0x13,0xD0,0xE3,0x20,0x06,0xA9,0x4C,0xFB,0xA8,0xA5,0x13,0xD0,0x06,0x20,0x45,0xAB,
+	0x20,0x3B,0xAB,0x4C,0x60,0xA5,0xA6,0x41,0xA4,0x42,0xA9,0x98,0x2C,0xA9,0x00,0x85,
+	0x11,0x86,0x43,0x84,0x44,0x20,0x8B,0xB0,0x85,0x49,0x84,0x4A,0xA5,0x7A,0xA4,0x7B,
+	0x85,0x4B,0x84,0x4C,0xA6,0x43,0xA4,0x44,0x86,0x7A,0x84,0x7B,0x20,0x79,0x00,0xD0,
+	0x20,0x24,0x11,0x50,0x0C,0x20,0x24,0xE1,0x8D,0x00,0x02,0xA2,0xFF,0xA0,0x01,0xD0,
+	0x0C,0x30,0x75,0xA5,0x13,0xD0,0x03,0x20,0x45,0xAB,0x20,0xF9,0xAB,0x86,0x7A,0x84,
+	0x7B,0x20,0x73,0x00,0x24,0x0D,0x10,0x31,0x24,0x11,0x50,0x09,0xE8,0x86,0x7A,0xA9,
+	0x00,0x85,0x07,0xF0,0x0C,0x85,0x07,0xC9,0x22,0xF0,0x07,0xA9,0x3A,0x85,0x07,0xA9,
+	0x2C,0x18,0x85,0x08,0xA5,0x7A,0xA4,0x7B,0x69,0x00,0x90,0x01,0xC8,0x20,0x8D,0xB4,
+	0x20,0xE2,0xB7,0x20,0xDA,0xA9,0x4C,0x91,0xAC,0x20,0xF3,0xBC,0xA5,0x0E,0x20,0xC2,
+	0xA9,0x20,0x79,0x00,0xF0,0x07,0xC9,0x2C,0xF0,0x03,0x4C,0x4D,0xAB,0xA5,0x7A,0xA4,
+	0x7B,0x85,0x43,0x84,0x44,0xA5,0x4B,0xA4,0x4C,0x85,0x7A,0x84,0x7B,0x20,0x79,0x00,
+	0xF0,0x2D,0x20,0xFD,0xAE,0x4C,0x15,0xAC,0x20,0x06,0xA9,0xC8,0xAA,0xD0,0x12,0xA2,
+	0x0D,0xC8,0xB1,0x7A,0xF0,0x6C,0xC8,0xB1,0x7A,0x85,0x3F,0xC8,0xB1,0x7A,0xC8,0x85,
+	0x40,0x20,0xFB,0xA8,0x20,0x79,0x00,0xAA,0xE0,0x83,0xD0,0xDC,0x4C,0x51,0xAC,0xA5,
+	0x43,0xA4,0x44,0xA6,0x11,0x10,0x03,0x4C,0x27,0xA8,0xA0,0x00,0xB1,0x43,0xF0,0x0B,
+	0xA5,0x13,0xD0,0x07,0xA9,0xFC,0xA0,0xAC,0x4C,0x1E,0xAB,0x60,0x3F,0x45,0x58,0x54,
+	0x52,0x41,0x20,0x49,0x47,0x4E,0x4F,0x52,0x45,0x44,0x0D,0x00,0x3F,0x52,0x45,0x44,
+	0x4F,0x20,0x46,0x52,0x4F,0x4D,0x20,0x53,0x54,0x41,0x52,0x54,0x0D,0x00,0xD0,0x04,
+	0xA0,0x00,0xF0,0x03,0x20,0x8B,0xB0,0x85,0x49,0x84,0x4A,0x20,0x8A,0xA3,0xF0,0x05,
+	0xA2,0x0A,0x4C,0x37,0xA4,0x9A,0x8A,0x18,0x69,0x04,0x48,0x69,0x06,0x85,0x24,0x68,
+	0xA0,0x01,0x20,0xA2,0xBB,0xBA,0xBD,0x09,0x01,0x85,0x66,0xA5,0x49,0xA4,0x4A,0x20,
+	0x67,0xB8,0x20,0xD0,0xBB,0xA0,0x01,0x20,0x5D,0xBC,0xBA,0x38,0xFD,0x09,0x01,0xF0,
+	0x17,0xBD,0x0F,0x01,0x85,0x39,0xBD,0x10,0x01,0x85,0x3A,0xBD,0x12,0x01,0x85,0x7A,
+	0xBD,0x11,0x01,0x85,0x7B,0x4C,0xAE,0xA7,0x8A,0x69,0x11,0xAA,0x9A,0x20,0x79,0x00,
+	0xC9,0x2C,0xD0,0xF1,0x20,0x73,0x00,0x20,0x24,0xAD,0x20,0x9E,0xAD,0x18,0x24,0x38,
+	0x24,0x0D,0x30,0x03,0xB0,0x03,0x60,0xB0,0xFD,0xA2,0x16,0x4C,0x37,0xA4,0xA6,0x7A,
+	0xD0,0x02,0xC6,0x7B,0xC6,0x7A,0xA2,0x00,0x24,0x48,0x8A,0x48,0xA9,0x01,0x20,0xFB,
+	0xA3,0x20,0x83,0xAE,0xA9,0x00,0x85,0x4D,0x20,0x79,0x00,0x38,0xE9,0xB1,0x90,0x17,
+	0xC9,0x03,0xB0,0x13,0xC9,0x01,0x2A,0x49,0x01,0x45,0x4D,0xC5,0x4D,0x90,0x61,0x85,
+	0x4D,0x20,0x73,0x00,0x4C,0xBB,0xAD,0xA6,0x4D,0xD0,0x2C,0xB0,0x7B,0x69,0x07,0x90,
+	0x77,0x65,0x0D,0xD0,0x03,0x4C,0x3D,0xB6,0x69,0xFF,0x85,0x22,0x0A,0x65,0x22,0xA8,
+	0x68,0xD9,0x80,0xA0,0xB0,0x67,0x20,0x8D,0xAD,0x48,0x20,0x20,0xAE,0x68,0xA4,0x4B,
+	0x10,0x17,0xAA,0xF0,0x56,0xD0,0x5F,0x46,0x0D,0x8A,0x2A,0xA6,0x7A,0xD0,0x02,0xC6,
+	0x7B,0xC6,0x7A,0xA0,0x1B,0x85,0x4D,0xD0,0xD7,0xD9,0x80,0xA0,0xB0,0x48,0x90,0xD9,
+	0xB9,0x82,0xA0,0x48,0xB9,0x81,0xA0,0x48,0x20,0x33,0xAE,0xA5,0x4D,0x4C,0xA9,0xAD,
+	0x4C,0x08,0xAF,0xA5,0x66,0xBE,0x80,0xA0,0xA8,0x68,0x85,0x22,0xE6,0x22,0x68,0x85,
+	0x23,0x98,0x48,0x20,0x1B,0xBC,0xA5,0x65,0x48,0xA5,0x64,0x48,0xA5,0x63,0x48,0xA5,
+	0x62,0x48,0xA5,0x61,0x48,0x6C,0x22,0x00,0xA0,0xFF,0x68,0xF0,0x23,0xC9,0x64,0xF0,
+	0x03,0x20,0x8D,0xAD,0x84,0x4B,0x68,0x4A,0x85,0x12,0x68,0x85,0x69,0x68,0x85,0x6A,
+	0x68,0x85,0x6B,0x68,0x85,0x6C,0x68,0x85,0x6D,0x68,0x85,0x6E,0x45,0x66,0x85,0x6F,
+	0xA5,0x61,0x60,0x6C,0x0A,0x03,0xA9,0x00,0x85,0x0D,0x20,0x73,0x00,0xB0,0x03,0x4C,
+	0xF3,0xBC,0x20,0x13,0xB1,0x90,0x03,0x4C,0x28,0xAF,0xC9,0xFF,0xD0,0x0F,0xA9,0xA8,
+	0xA0,0xAE,0x20,0xA2,0xBB,0x4C,0x73,0x00,0x82,0x49,0x0F,0xDA,0xA1,0xC9,0x2E,0xF0,
+	0xDE,0xC9,0xAB,0xF0,0x58,0xC9,0xAA,0xF0,0xD1,0xC9,0x22,0xD0,0x0F,0xA5,0x7A,0xA4,
+	0x7B,0x69,0x00,0x90,0x01,0xC8,0x20,0x87,0xB4,0x4C,0xE2,0xB7,0xC9,0xA8,0xD0,0x13,
+	0xA0,0x18,0xD0,0x3B,0x20,0xBF,0xB1,0xA5,0x65,0x49,0xFF,0xA8,0xA5,0x64,0x49,0xFF,
+	0x4C,0x91,0xB3,0xC9,0xA5,0xD0,0x03,0x4C,0xF4,0xB3,0xC9,0xB4,0x90,0x03,0x4C,0xA7,
+	0xAF,0x20,0xFA,0xAE,0x20,0x9E,0xAD,0xA9,0x29,0x2C,0xA9,0x28,0x2C,0xA9,0x2C,0xA0,
+	0x00,0xD1,0x7A,0xD0,0x03,0x4C,0x73,0x00,0xA2,0x0B,0x4C,0x37,0xA4,0xA0,0x15,0x68,
+	0x68,0x4C,0xFA,0xAD,0x38,0xA5,0x64,0xE9,0x00,0xA5,0x65,0xE9,0xA0,0x90,0x08,0xA9,
+	0xA2,0xE5,0x64,0xA9,0xE3,0xE5,0x65,0x60,0x20,0x8B,0xB0,0x85,0x64,0x84,0x65,0xA6,
+	0x45,0xA4,0x46,0xA5,0x0D,0xF0,0x26,0xA9,0x00,0x85,0x70,0x20,0x14,0xAF,0x90,0x1C,
+	0xE0,0x54,0xD0,0x18,0xC0,0xC9,0xD0,0x14,0x20,0x84,0xAF,0x84,0x5E,0x88,0x84,0x71,
+	0xA0,0x06,0x84,0x5D,0xA0,0x24,0x20,0x68,0xBE,0x4C,0x6F,0xB4,0x60,0x24,0x0E,0x10,
+	0x0D,0xA0,0x00,0xB1,0x64,0xAA,0xC8,0xB1,0x64,0xA8,0x8A,0x4C,0x91,0xB3,0x20,0x14,
+	0xAF,0x90,0x2D,0xE0,0x54,0xD0,0x1B,0xC0,0x49,0xD0,0x25,0x20,0x84,0xAF,0x98,0xA2,
+	0xA0,0x4C,0x4F,0xBC,0x20,0xDE,0xFF,0x86,0x64,0x84,0x63,0x85,0x65,0xA0,0x00,0x84,
+	0x62,0x60,0xE0,0x53,0xD0,0x0A,0xC0,0x54,0xD0,0x06,0x20,0xB7,0xFF,0x4C,0x3C,0xBC,
+	0xA5,0x64,0xA4,0x65,0x4C,0xA2,0xBB,0x0A,0x48,0xAA,0x20,0x73,0x00,0xE0,0x8F,0x90,
+	0x20,0x20,0xFA,0xAE,0x20,0x9E,0xAD,0x20,0xFD,0xAE,0x20,0x8F,0xAD,0x68,0xAA,0xA5,
+	0x65,0x48,0xA5,0x64,0x48,0x8A,0x48,0x20,0x9E,0xB7,0x68,0xA8,0x8A,0x48,0x4C,0xD6,
+	0xAF,0x20,0xF1,0xAE,0x68,0xA8,0xB9,0xEA,0x9F,0x85,0x55,0xB9,0xEB,0x9F,0x85,0x56,
+	0x20,0x54,0x00,0x4C,0x8D,0xAD,0xA0,0xFF,0x2C,0xA0,0x00,0x84,0x0B,0x20,0xBF,0xB1,
+	0xA5,0x64,0x45,0x0B,0x85,0x07,0xA5,0x65,0x45,0x0B,0x85,0x08,0x20,0xFC,0xBB,0x20,
+	0xBF,0xB1,0xA5,0x65,0x45,0x0B,0x25,0x08,0x45,0x0B,0xA8,0xA5,0x64,0x45,0x0B,0x25,
+	0x07,0x45,0x0B,0x4C,0x91,0xB3,0x20,0x90,0xAD,0xB0,0x13,0xA5,0x6E,0x09,0x7F,0x25,
+	0x6A,0x85,0x6A,0xA9,0x69,0xA0,0x00,0x20,0x5B,0xBC,0xAA,0x4C,0x61,0xB0,0xA9,0x00,
+	0x85,0x0D,0xC6,0x4D,0x20,0xA6,0xB6,0x85,0x61,0x86,0x62,0x84,0x63,0xA5,0x6C,0xA4,
+	0x6D,0x20,0xAA,0xB6,0x86,0x6C,0x84,0x6D,0xAA,0x38,0xE5,0x61,0xF0,0x08,0xA9,0x01,
+	0x90,0x04,0xA6,0x61,0xA9,0xFF,0x85,0x66,0xA0,0xFF,0xE8,0xC8,0xCA,0xD0,0x07,0xA6,
+	0x66,0x30,0x0F,0x18,0x90,0x0C,0xB1,0x6C,0xD1,0x62,0xF0,0xEF,0xA2,0xFF,0xB0,0x02,
+	0xA2,0x01,0xE8,0x8A,0x2A,0x25,0x12,0xF0,0x02,0xA9,0xFF,0x4C,0x3C,0xBC,0x20,0xFD,
+	0xAE,0xAA,0x20,0x90,0xB0,0x20,0x79,0x00,0xD0,0xF4,0x60,0xA2,0x00,0x20,0x79,0x00,
+	0x86,0x0C,0x85,0x45,0x20,0x79,0x00,0x20,0x13,0xB1,0xB0,0x03,0x4C,0x08,0xAF,0xA2,
+	0x00,0x86,0x0D,0x86,0x0E,0x20,0x73,0x00,0x90,0x05,0x20,0x13,0xB1,0x90,0x0B,0xAA,
+	0x20,0x73,0x00,0x90,0xFB,0x20,0x13,0xB1,0xB0,0xF6,0xC9,0x24,0xD0,0x06,0xA9,0xFF,
+	0x85,0x0D,0xD0,0x10,0xC9,0x25,0xD0,0x13,0xA5,0x10,0xD0,0xD0,0xA9,0x80,0x85,0x0E,
+	0x05,0x45,0x85,0x45,0x8A,0x09,0x80,0xAA,0x20,0x73,0x00,0x86,0x46,0x38,0x05,0x10,
+	0xE9,0x28,0xD0,0x03,0x4C,0xD1,0xB1,0xA0,0x00,0x84,0x10,0xA5,0x2D,0xA6,0x2E,0x86,
+	0x60,0x85,0x5F,0xE4,0x30,0xD0,0x04,0xC5,0x2F,0xF0,0x22,0xA5,0x45,0xD1,0x5F,0xD0,
+	0x08,0xA5,0x46,0xC8,0xD1,0x5F,0xF0,0x7D,0x88,0x18,0xA5,0x5F,0x69,0x07,0x90,0xE1,
+	0xE8,0xD0,0xDC,0xC9,0x41,0x90,0x05,0xE9,0x5B,0x38,0xE9,0xA5,0x60,0x68,0x48,0xC9,
+	0x2A,0xD0,0x05,0xA9,0x13,0xA0,0xBF,0x60,0xA5,0x45,0xA4,0x46,0xC9,0x54,0xD0,0x0B,
+	0xC0,0xC9,0xF0,0xEF,0xC0,0x49,0xD0,0x03,0x4C,0x08,0xAF,0xC9,0x53,0xD0,0x04,0xC0,
+	0x54,0xF0,0xF5,0xA5,0x2F,0xA4,0x30,0x85,0x5F,0x84,0x60,0xA5,0x31,0xA4,0x32,0x85,
+	0x5A,0x84,0x5B,0x18,0x69,0x07,0x90,0x01,0xC8,0x85,0x58,0x84,0x59,0x20,0xB8,0xA3,
+	0xA5,0x58,0xA4,0x59,0xC8,0x85,0x2F,0x84,0x30,0xA0,0x00,0xA5,0x45,0x91,0x5F,0xC8,
+	0xA5,0x46,0x91,0x5F,0xA9,0x00,0xC8,0x91,0x5F,0xC8,0x91,0x5F,0xC8,0x91,0x5F,0xC8,
+	0x91,0x5F,0xC8,0x91,0x5F,0xA5,0x5F,0x18,0x69,0x02,0xA4,0x60,0x90,0x01,0xC8,0x85,
+	0x47,0x84,0x48,0x60,0xA5,0x0B,0x0A,0x69,0x05,0x65,0x5F,0xA4,0x60,0x90,0x01,0xC8,
+	0x85,0x58,0x84,0x59,0x60,0x90,0x80,0x00,0x00,0x00,0x20,0xBF,0xB1,0xA5,0x64,0xA4,
+	0x65,0x60,0x20,0x73,0x00,0x20,0x9E,0xAD,0x20,0x8D,0xAD,0xA5,0x66,0x30,0x0D,0xA5,
+	0x61,0xC9,0x90,0x90,0x09,0xA9,0xA5,0xA0,0xB1,0x20,0x5B,0xBC,0xD0,0x7A,0x4C,0x9B,
+	0xBC,0xA5,0x0C,0x05,0x0E,0x48,0xA5,0x0D,0x48,0xA0,0x00,0x98,0x48,0xA5,0x46,0x48,
+	0xA5,0x45,0x48,0x20,0xB2,0xB1,0x68,0x85,0x45,0x68,0x85,0x46,0x68,0xA8,0xBA,0xBD,
+	0x02,0x01,0x48,0xBD,0x01,0x01,0x48,0xA5,0x64,0x9D,0x02,0x01,0xA5,0x65,0x9D,0x01,
+	0x01,0xC8,0x20,0x79,0x00,0xC9,0x2C,0xF0,0xD2,0x84,0x0B,0x20,0xF7,0xAE,0x68,0x85,
+	0x0D,0x68,0x85,0x0E,0x29,0x7F,0x85,0x0C,0xA6,0x2F,0xA5,0x30,0x86,0x5F,0x85,0x60,
+	0xC5,0x32,0xD0,0x04,0xE4,0x31,0xF0,0x39,0xA0,0x00,0xB1,0x5F,0xC8,0xC5,0x45,0xD0,
+	0x06,0xA5,0x46,0xD1,0x5F,0xF0,0x16,0xC8,0xB1,0x5F,0x18,0x65,0x5F,0xAA,0xC8,0xB1,
+	0x5F,0x65,0x60,0x90,0xD7,0xA2,0x12,0x2C,0xA2,0x0E,0x4C,0x37,0xA4,0xA2,0x13,0xA5,
+	0x0C,0xD0,0xF7,0x20,0x94,0xB1,0xA5,0x0B,0xA0,0x04,0xD1,0x5F,0xD0,0xE7,0x4C,0xEA,
+	0xB2,0x20,0x94,0xB1,0x20,0x08,0xA4,0xA0,0x00,0x84,0x72,0xA2,0x05,0xA5,0x45,0x91,
+	0x5F,0x10,0x01,0xCA,0xC8,0xA5,0x46,0x91,0x5F,0x10,0x02,0xCA,0xCA,0x86,0x71,0xA5,
+	0x0B,0xC8,0xC8,0xC8,0x91,0x5F,0xA2,0x0B,0xA9,0x00,0x24,0x0C,0x50,0x08,0x68,0x18,
+	0x69,0x01,0xAA,0x68,0x69,0x00,0xC8,0x91,0x5F,0xC8,0x8A,0x91,0x5F,0x20,0x4C,0xB3,
+	0x86,0x71,0x85,0x72,0xA4,0x22,0xC6,0x0B,0xD0,0xDC,0x65,0x59,0xB0,0x5D,0x85,0x59,
+	0xA8,0x8A,0x65,0x58,0x90,0x03,0xC8,0xF0,0x52,0x20,0x08,0xA4,0x85,0x31,0x84,0x32,
+	0xA9,0x00,0xE6,0x72,0xA4,0x71,0xF0,0x05,0x88,0x91,0x58,0xD0,0xFB,0xC6,0x59,0xC6,
+	0x72,0xD0,0xF5,0xE6,0x59,0x38,0xA5,0x31,0xE5,0x5F,0xA0,0x02,0x91,0x5F,0xA5,0x32,
+	0xC8,0xE5,0x60,0x91,0x5F,0xA5,0x0C,0xD0,0x62,0xC8,0xB1,0x5F,0x85,0x0B,0xA9,0x00,
+	0x85,0x71,0x85,0x72,0xC8,0x68,0xAA,0x85,0x64,0x68,0x85,0x65,0xD1,0x5F,0x90,0x0E,
+	0xD0,0x06,0xC8,0x8A,0xD1,0x5F,0x90,0x07,0x4C,0x45,0xB2,0x4C,0x35,0xA4,0xC8,0xA5,
+	0x72,0x05,0x71,0x18,0xF0,0x0A,0x20,0x4C,0xB3,0x8A,0x65,0x64,0xAA,0x98,0xA4,0x22,
+	0x65,0x65,0x86,0x71,0xC6,0x0B,0xD0,0xCA,0x85,0x72,0xA2,0x05,0xA5,0x45,0x10,0x01,
+	0xCA,0xA5,0x46,0x10,0x02,0xCA,0xCA,0x86,0x28,0xA9,0x00,0x20,0x55,0xB3,0x8A,0x65,
+	0x58,0x85,0x47,0x98,0x65,0x59,0x85,0x48,0xA8,0xA5,0x47,0x60,0x84,0x22,0xB1,0x5F,
+	0x85,0x28,0x88,0xB1,0x5F,0x85,0x29,0xA9,0x10,0x85,0x5D,0xA2,0x00,0xA0,0x00,0x8A,
+	0x0A,0xAA,0x98,0x2A,0xA8,0xB0,0xA4,0x06,0x71,0x26,0x72,0x90,0x0B,0x18,0x8A,0x65,
+	0x28,0xAA,0x98,0x65,0x29,0xA8,0xB0,0x93,0xC6,0x5D,0xD0,0xE3,0x60,0xA5,0x0D,0xF0,
+	0x03,0x20,0xA6,0xB6,0x20,0x26,0xB5,0x38,0xA5,0x33,0xE5,0x31,0xA8,0xA5,0x34,0xE5,
+	0x32,0xA2,0x00,0x86,0x0D,0x85,0x62,0x84,0x63,0xA2,0x90,0x4C,0x44,0xBC,0x38,0x20,
+	0xF0,0xFF,0xA9,0x00,0xF0,0xEB,0xA6,0x3A,0xE8,0xD0,0xA0,0xA2,0x15,0x2C,0xA2,0x1B,
+	0x4C,0x37,0xA4,0x20,0xE1,0xB3,0x20,0xA6,0xB3,0x20,0xFA,0xAE,0xA9,0x80,0x85,0x10,
+	0x20,0x8B,0xB0,0x20,0x8D,0xAD,0x20,0xF7,0xAE,0xA9,0xB2,0x20,0xFF,0xAE,0x48,0xA5,
+	0x48,0x48,0xA5,0x47,0x48,0xA5,0x7B,0x48,0xA5,0x7A,0x48,0x20,0xF8,0xA8,0x4C,0x4F,
+	0xB4,0xA9,0xA5,0x20,0xFF,0xAE,0x09,0x80,0x85,0x10,0x20,0x92,0xB0,0x85,0x4E,0x84,
+	0x4F,0x4C,0x8D,0xAD,0x20,0xE1,0xB3,0xA5,0x4F,0x48,0xA5,0x4E,0x48,0x20,0xF1,0xAE,
+	0x20,0x8D,0xAD,0x68,0x85,0x4E,0x68,0x85,0x4F,0xA0,0x02,0xB1,0x4E,0x85,0x47,0xAA,
+	0xC8,0xB1,0x4E,0xF0,0x99,0x85,0x48,0xC8,0xB1,0x47,0x48,0x88,0x10,0xFA,0xA4,0x48,
+	0x20,0xD4,0xBB,0xA5,0x7B,0x48,0xA5,0x7A,0x48,0xB1,0x4E,0x85,0x7A,0xC8,0xB1,0x4E,
+	0x85,0x7B,0xA5,0x48,0x48,0xA5,0x47,0x48,0x20,0x8A,0xAD,0x68,0x85,0x4E,0x68,0x85,
+	0x4F,0x20,0x79,0x00,0xF0,0x03,0x4C,0x08,0xAF,0x68,0x85,0x7A,0x68,0x85,0x7B,0xA0,
+	0x00,0x68,0x91,0x4E,0x68,0xC8,0x91,0x4E,0x68,0xC8,0x91,0x4E,0x68,0xC8,0x91,0x4E,
+	0x68,0xC8,0x91,0x4E,0x60,0x20,0x8D,0xAD,0xA0,0x00,0x20,0xDF,0xBD,0x68,0x68,0xA9,
+	0xFF,0xA0,0x00,0xF0,0x12,0xA6,0x64,0xA4,0x65,0x86,0x50,0x84,0x51,0x20,0xF4,0xB4,
+	0x86,0x62,0x84,0x63,0x85,0x61,0x60,0xA2,0x22,0x86,0x07,0x86,0x08,0x85,0x6F,0x84,
+	0x70,0x85,0x62,0x84,0x63,0xA0,0xFF,0xC8,0xB1,0x6F,0xF0,0x0C,0xC5,0x07,0xF0,0x04,
+	0xC5,0x08,0xD0,0xF3,0xC9,0x22,0xF0,0x01,0x18,0x84,0x61,0x98,0x65,0x6F,0x85,0x71,
+	0xA6,0x70,0x90,0x01,0xE8,0x86,0x72,0xA5,0x70,0xF0,0x04,0xC9,0x02,0xD0,0x0B,0x98,
+	0x20,0x75,0xB4,0xA6,0x6F,0xA4,0x70,0x20,0x88,0xB6,0xA6,0x16,0xE0,0x22,0xD0,0x05,
+	0xA2,0x19,0x4C,0x37,0xA4,0xA5,0x61,0x95,0x00,0xA5,0x62,0x95,0x01,0xA5,0x63,0x95,
+	0x02,0xA0,0x00,0x86,0x64,0x84,0x65,0x84,0x70,0x88,0x84,0x0D,0x86,0x17,0xE8,0xE8,
+	0xE8,0x86,0x16,0x60,0x46,0x0F,0x48,0x49,0xFF,0x38,0x65,0x33,0xA4,0x34,0xB0,0x01,
+	0x88,0xC4,0x32,0x90,0x11,0xD0,0x04,0xC5,0x31,0x90,0x0B,0x85,0x33,0x84,0x34,0x85,
+	0x35,0x84,0x36,0xAA,0x68,0x60,0xA2,0x10,0xA5,0x0F,0x30,0xB6,0x20,0x26,0xB5,0xA9,
+	0x80,0x85,0x0F,0x68,0xD0,0xD0,0xA6,0x37,0xA5,0x38,0x86,0x33,0x85,0x34,0xA0,0x00,
+	0x84,0x4F,0x84,0x4E,0xA5,0x31,0xA6,0x32,0x85,0x5F,0x86,0x60,0xA9,0x19,0xA2,0x00,
+	0x85,0x22,0x86,0x23,0xC5,0x16,0xF0,0x05,0x20,0xC7,0xB5,0xF0,0xF7,0xA9,0x07,0x85,
+	0x53,0xA5,0x2D,0xA6,0x2E,0x85,0x22,0x86,0x23,0xE4,0x30,0xD0,0x04,0xC5,0x2F,0xF0,
+	0x05,0x20,0xBD,0xB5,0xF0,0xF3,0x85,0x58,0x86,0x59,0xA9,0x03,0x85,0x53,0xA5,0x58,
+	0xA6,0x59,0xE4,0x32,0xD0,0x07,0xC5,0x31,0xD0,0x03,0x4C,0x06,0xB6,0x85,0x22,0x86,
+	0x23,0xA0,0x00,0xB1,0x22,0xAA,0xC8,0xB1,0x22,0x08,0xC8,0xB1,0x22,0x65,0x58,0x85,
+	0x58,0xC8,0xB1,0x22,0x65,0x59,0x85,0x59,0x28,0x10,0xD3,0x8A,0x30,0xD0,0xC8,0xB1,
+	0x22,0xA0,0x00,0x0A,0x69,0x05,0x65,0x22,0x85,0x22,0x90,0x02,0xE6,0x23,0xA6,0x23,
+	0xE4,0x59,0xD0,0x04,0xC5,0x58,0xF0,0xBA,0x20,0xC7,0xB5,0xF0,0xF3,0xB1,0x22,0x30,
+	0x35,0xC8,0xB1,0x22,0x10,0x30,0xC8,0xB1,0x22,0xF0,0x2B,0xC8,0xB1,0x22,0xAA,0xC8,
+	0xB1,0x22,0xC5,0x34,0x90,0x06,0xD0,0x1E,0xE4,0x33,0xB0,0x1A,0xC5,0x60,0x90,0x16,
+	0xD0,0x04,0xE4,0x5F,0x90,0x10,0x86,0x5F,0x85,0x60,0xA5,0x22,0xA6,0x23,0x85,0x4E,
+	0x86,0x4F,0xA5,0x53,0x85,0x55,0xA5,0x53,0x18,0x65,0x22,0x85,0x22,0x90,0x02,0xE6,
+	0x23,0xA6,0x23,0xA0,0x00,0x60,0xA5,0x4F,0x05,0x4E,0xF0,0xF5,0xA5,0x55,0x29,0x04,
+	0x4A,0xA8,0x85,0x55,0xB1,0x4E,0x65,0x5F,0x85,0x5A,0xA5,0x60,0x69,0x00,0x85,0x5B,
+	0xA5,0x33,0xA6,0x34,0x85,0x58,0x86,0x59,0x20,0xBF,0xA3,0xA4,0x55,0xC8,0xA5,0x58,
+	0x91,0x4E,0xAA,0xE6,0x59,0xA5,0x59,0xC8,0x91,0x4E,0x4C,0x2A,0xB5,0xA5,0x65,0x48,
+	0xA5,0x64,0x48,0x20,0x83,0xAE,0x20,0x8F,0xAD,0x68,0x85,0x6F,0x68,0x85,0x70,0xA0,
+	0x00,0xB1,0x6F,0x18,0x71,0x64,0x90,0x05,0xA2,0x17,0x4C,0x37,0xA4,0x20,0x75,0xB4,
+	0x20,0x7A,0xB6,0xA5,0x50,0xA4,0x51,0x20,0xAA,0xB6,0x20,0x8C,0xB6,0xA5,0x6F,0xA4,
+	0x70,0x20,0xAA,0xB6,0x20,0xCA,0xB4,0x4C,0xB8,0xAD,0xA0,0x00,0xB1,0x6F,0x48,0xC8,
+	0xB1,0x6F,0xAA,0xC8,0xB1,0x6F,0xA8,0x68,0x86,0x22,0x84,0x23,0xA8,0xF0,0x0A,0x48,
+	0x88,0xB1,0x22,0x91,0x35,0x98,0xD0,0xF8,0x68,0x18,0x65,0x35,0x85,0x35,0x90,0x02,
+	0xE6,0x36,0x60,0x20,0x8F,0xAD,0xA5,0x64,0xA4,0x65,0x85,0x22,0x84,0x23,0x20,0xDB,
+	0xB6,0x08,0xA0,0x00,0xB1,0x22,0x48,0xC8,0xB1,0x22,0xAA,0xC8,0xB1,0x22,0xA8,0x68,
+	0x28,0xD0,0x13,0xC4,0x34,0xD0,0x0F,0xE4,0x33,0xD0,0x0B,0x48,0x18,0x65,0x33,0x85,
+	0x33,0x90,0x02,0xE6,0x34,0x68,0x86,0x22,0x84,0x23,0x60,0xC4,0x18,0xD0,0x0C,0xC5,
+	0x17,0xD0,0x08,0x85,0x16,0xE9,0x03,0x85,0x17,0xA0,0x00,0x60,0x20,0xA1,0xB7,0x8A,
+	0x48,0xA9,0x01,0x20,0x7D,0xB4,0x68,0xA0,0x00,0x91,0x62,0x68,0x68,0x4C,0xCA,0xB4,
+	0x20,0x61,0xB7,0xD1,0x50,0x98,0x90,0x04,0xB1,0x50,0xAA,0x98,0x48,0x8A,0x48,0x20,
+	0x7D,0xB4,0xA5,0x50,0xA4,0x51,0x20,0xAA,0xB6,0x68,0xA8,0x68,0x18,0x65,0x22,0x85,
+	0x22,0x90,0x02,0xE6,0x23,0x98,0x20,0x8C,0xB6,0x4C,0xCA,0xB4,0x20,0x61,0xB7,0x18,
+	0xF1,0x50,0x49,0xFF,0x4C,0x06,0xB7,0xA9,0xFF,0x85,0x65,0x20,0x79,0x00,0xC9,0x29,
+	0xF0,0x06,0x20,0xFD,0xAE,0x20,0x9E,0xB7,0x20,0x61,0xB7,0xF0,0x4B,0xCA,0x8A,0x48,
+	0x18,0xA2,0x00,0xF1,0x50,0xB0,0xB6,0x49,0xFF,0xC5,0x65,0x90,0xB1,0xA5,0x65,0xB0,
+	0xAD,0x20,0xF7,0xAE,0x68,0xA8,0x68,0x85,0x55,0x68,0x68,0x68,0xAA,0x68,0x85,0x50,
+	0x68,0x85,0x51,0xA5,0x55,0x48,0x98,0x48,0xA0,0x00,0x8A,0x60,0x20,0x82,0xB7,0x4C,
+	0xA2,0xB3,0x20,0xA3,0xB6,0xA2,0x00,0x86,0x0D,0xA8,0x60,0x20,0x82,0xB7,0xF0,0x08,
+	0xA0,0x00,0xB1,0x22,0xA8,0x4C,0xA2,0xB3,0x4C,0x48,0xB2,0x20,0x73,0x00,0x20,0x8A,
+	0xAD,0x20,0xB8,0xB1,0xA6,0x64,0xD0,0xF0,0xA6,0x65,0x4C,0x79,0x00,0x20,0x82,0xB7,
+	0xD0,0x03,0x4C,0xF7,0xB8,0xA6,0x7A,0xA4,0x7B,0x86,0x71,0x84,0x72,0xA6,0x22,0x86,
+	0x7A,0x18,0x65,0x22,0x85,0x24,0xA6,0x23,0x86,0x7B,0x90,0x01,0xE8,0x86,0x25,0xA0,
+	0x00,0xB1,0x24,0x48,0x98,0x91,0x24,0x20,0x79,0x00,0x20,0xF3,0xBC,0x68,0xA0,0x00,
+	0x91,0x24,0xA6,0x71,0xA4,0x72,0x86,0x7A,0x84,0x7B,0x60,0x20,0x8A,0xAD,0x20,0xF7,
+	0xB7,0x20,0xFD,0xAE,0x4C,0x9E,0xB7,0xA5,0x66,0x30,0x9D,0xA5,0x61,0xC9,0x91,0xB0,
+	0x97,0x20,0x9B,0xBC,0xA5,0x64,0xA4,0x65,0x84,0x14,0x85,0x15,0x60,0xA5,0x15,0x48,
+	0xA5,0x14,0x48,0x20,0xF7,0xB7,0xA0,0x00,0xB1,0x14,0xA8,0x68,0x85,0x14,0x68,0x85,
+	0x15,0x4C,0xA2,0xB3,0x20,0xEB,0xB7,0x8A,0xA0,0x00,0x91,0x14,0x60,0x20,0xEB,0xB7,
+	0x86,0x49,0xA2,0x00,0x20,0x79,0x00,0xF0,0x03,0x20,0xF1,0xB7,0x86,0x4A,0xA0,0x00,
+	0xB1,0x14,0x45,0x4A,0x25,0x49,0xF0,0xF8,0x60,0xA9,0x11,0xA0,0xBF,0x4C,0x67,0xB8,
+	0x20,0x8C,0xBA,0xA5,0x66,0x49,0xFF,0x85,0x66,0x45,0x6E,0x85,0x6F,0xA5,0x61,0x4C,
+	0x6A,0xB8,0x20,0x99,0xB9,0x90,0x3C,0x20,0x8C,0xBA,0xD0,0x03,0x4C,0xFC,0xBB,0xA6,
+	0x70,0x86,0x56,0xA2,0x69,0xA5,0x69,0xA8,0xF0,0xCE,0x38,0xE5,0x61,0xF0,0x24,0x90,
+	0x12,0x84,0x61,0xA4,0x6E,0x84,0x66,0x49,0xFF,0x69,0x00,0xA0,0x00,0x84,0x56,0xA2,
+	0x61,0xD0,0x04,0xA0,0x00,0x84,0x70,0xC9,0xF9,0x30,0xC7,0xA8,0xA5,0x70,0x56,0x01,
+	0x20,0xB0,0xB9,0x24,0x6F,0x10,0x57,0xA0,0x61,0xE0,0x69,0xF0,0x02,0xA0,0x69,0x38,
+	0x49,0xFF,0x65,0x56,0x85,0x70,0xB9,0x04,0x00,0xF5,0x04,0x85,0x65,0xB9,0x03,0x00,
+	0xF5,0x03,0x85,0x64,0xB9,0x02,0x00,0xF5,0x02,0x85,0x63,0xB9,0x01,0x00,0xF5,0x01,
+	0x85,0x62,0xB0,0x03,0x20,0x47,0xB9,0xA0,0x00,0x98,0x18,0xA6,0x62,0xD0,0x4A,0xA6,
+	0x63,0x86,0x62,0xA6,0x64,0x86,0x63,0xA6,0x65,0x86,0x64,0xA6,0x70,0x86,0x65,0x84,
+	0x70,0x69,0x08,0xC9,0x20,0xD0,0xE4,0xA9,0x00,0x85,0x61,0x85,0x66,0x60,0x65,0x56,
+	0x85,0x70,0xA5,0x65,0x65,0x6D,0x85,0x65,0xA5,0x64,0x65,0x6C,0x85,0x64,0xA5,0x63,
+	0x65,0x6B,0x85,0x63,0xA5,0x62,0x65,0x6A,0x85,0x62,0x4C,0x36,0xB9,0x69,0x01,0x06,
+	0x70,0x26,0x65,0x26,0x64,0x26,0x63,0x26,0x62,0x10,0xF2,0x38,0xE5,0x61,0xB0,0xC7,
+	0x49,0xFF,0x69,0x01,0x85,0x61,0x90,0x0E,0xE6,0x61,0xF0,0x42,0x66,0x62,0x66,0x63,
+	0x66,0x64,0x66,0x65,0x66,0x70,0x60,0xA5,0x66,0x49,0xFF,0x85,0x66,0xA5,0x62,0x49,
+	0xFF,0x85,0x62,0xA5,0x63,0x49,0xFF,0x85,0x63,0xA5,0x64,0x49,0xFF,0x85,0x64,0xA5,
+	0x65,0x49,0xFF,0x85,0x65,0xA5,0x70,0x49,0xFF,0x85,0x70,0xE6,0x70,0xD0,0x0E,0xE6,
+	0x65,0xD0,0x0A,0xE6,0x64,0xD0,0x06,0xE6,0x63,0xD0,0x02,0xE6,0x62,0x60,0xA2,0x0F,
+	0x4C,0x37,0xA4,0xA2,0x25,0xB4,0x04,0x84,0x70,0xB4,0x03,0x94,0x04,0xB4,0x02,0x94,
+	0x03,0xB4,0x01,0x94,0x02,0xA4,0x68,0x94,0x01,0x69,0x08,0x30,0xE8,0xF0,0xE6,0xE9,
+	0x08,0xA8,0xA5,0x70,0xB0,0x14,0x16,0x01,0x90,0x02,0xF6,0x01,0x76,0x01,0x76,0x01,
+	0x76,0x02,0x76,0x03,0x76,0x04,0x6A,0xC8,0xD0,0xEC,0x18,0x60,0x81,0x00,0x00,0x00,
+	0x00,0x03,0x7F,0x5E,0x56,0xCB,0x79,0x80,0x13,0x9B,0x0B,0x64,0x80,0x76,0x38,0x93,
+	0x16,0x82,0x38,0xAA,0x3B,0x20,0x80,0x35,0x04,0xF3,0x34,0x81,0x35,0x04,0xF3,0x34,
+	0x80,0x80,0x00,0x00,0x00,0x80,0x31,0x72,0x17,0xF8,0x20,0x2B,0xBC,0xF0,0x02,0x10,
+	0x03,0x4C,0x48,0xB2,0xA5,0x61,0xE9,0x7F,0x48,0xA9,0x80,0x85,0x61,0xA9,0xD6,0xA0,
+	0xB9,0x20,0x67,0xB8,0xA9,0xDB,0xA0,0xB9,0x20,0x0F,0xBB,0xA9,0xBC,0xA0,0xB9,0x20,
+	0x50,0xB8,0xA9,0xC1,0xA0,0xB9,0x20,0x43,0xE0,0xA9,0xE0,0xA0,0xB9,0x20,0x67,0xB8,
+	0x68,0x20,0x7E,0xBD,0xA9,0xE5,0xA0,0xB9,0x20,0x8C,0xBA,0xD0,0x03,0x4C,0x8B,0xBA,
+	0x20,0xB7,0xBA,0xA9,0x00,0x85,0x26,0x85,0x27,0x85,0x28,0x85,0x29,0xA5,0x70,0x20,
+	0x59,0xBA,0xA5,0x65,0x20,0x59,0xBA,0xA5,0x64,0x20,0x59,0xBA,0xA5,0x63,0x20,0x59,
+	0xBA,0xA5,0x62,0x20,0x5E,0xBA,0x4C,0x8F,0xBB,0xD0,0x03,0x4C,0x83,0xB9,0x4A,0x09,
+	0x80,0xA8,0x90,0x19,0x18,0xA5,0x29,0x65,0x6D,0x85,0x29,0xA5,0x28,0x65,0x6C,0x85,
+	0x28,0xA5,0x27,0x65,0x6B,0x85,0x27,0xA5,0x26,0x65,0x6A,0x85,0x26,0x66,0x26,0x66,
+	0x27,0x66,0x28,0x66,0x29,0x66,0x70,0x98,0x4A,0xD0,0xD6,0x60,0x85,0x22,0x84,0x23,
+	0xA0,0x04,0xB1,0x22,0x85,0x6D,0x88,0xB1,0x22,0x85,0x6C,0x88,0xB1,0x22,0x85,0x6B,
+	0x88,0xB1,0x22,0x85,0x6E,0x45,0x66,0x85,0x6F,0xA5,0x6E,0x09,0x80,0x85,0x6A,0x88,
+	0xB1,0x22,0x85,0x69,0xA5,0x61,0x60,0xA5,0x69,0xF0,0x1F,0x18,0x65,0x61,0x90,0x04,
+	0x30,0x1D,0x18,0x2C,0x10,0x14,0x69,0x80,0x85,0x61,0xD0,0x03,0x4C,0xFB,0xB8,0xA5,
+	0x6F,0x85,0x66,0x60,0xA5,0x66,0x49,0xFF,0x30,0x05,0x68,0x68,0x4C,0xF7,0xB8,0x4C,
+	0x7E,0xB9,0x20,0x0C,0xBC,0xAA,0xF0,0x10,0x18,0x69,0x02,0xB0,0xF2,0xA2,0x00,0x86,
+	0x6F,0x20,0x77,0xB8,0xE6,0x61,0xF0,0xE7,0x60,0x84,0x20,0x00,0x00,0x00,0x20,0x0C,
+	0xBC,0xA9,0xF9,0xA0,0xBA,0xA2,0x00,0x86,0x6F,0x20,0xA2,0xBB,0x4C,0x12,0xBB,0x20,
+	0x8C,0xBA,0xF0,0x76,0x20,0x1B,0xBC,0xA9,0x00,0x38,0xE5,0x61,0x85,0x61,0x20,0xB7,
+	0xBA,0xE6,0x61,0xF0,0xBA,0xA2,0xFC,0xA9,0x01,0xA4,0x6A,0xC4,0x62,0xD0,0x10,0xA4,
+	0x6B,0xC4,0x63,0xD0,0x0A,0xA4,0x6C,0xC4,0x64,0xD0,0x04,0xA4,0x6D,0xC4,0x65,0x08,
+	0x2A,0x90,0x09,0xE8,0x95,0x29,0xF0,0x32,0x10,0x34,0xA9,0x01,0x28,0xB0,0x0E,0x06,
+	0x6D,0x26,0x6C,0x26,0x6B,0x26,0x6A,0xB0,0xE6,0x30,0xCE,0x10,0xE2,0xA8,0xA5,0x6D,
+	0xE5,0x65,0x85,0x6D,0xA5,0x6C,0xE5,0x64,0x85,0x6C,0xA5,0x6B,0xE5,0x63,0x85,0x6B,
+	0xA5,0x6A,0xE5,0x62,0x85,0x6A,0x98,0x4C,0x4F,0xBB,0xA9,0x40,0xD0,0xCE,0x0A,0x0A,
+	0x0A,0x0A,0x0A,0x0A,0x85,0x70,0x28,0x4C,0x8F,0xBB,0xA2,0x14,0x4C,0x37,0xA4,0xA5,
+	0x26,0x85,0x62,0xA5,0x27,0x85,0x63,0xA5,0x28,0x85,0x64,0xA5,0x29,0x85,0x65,0x4C,
+	0xD7,0xB8,0x85,0x22,0x84,0x23,0xA0,0x04,0xB1,0x22,0x85,0x65,0x88,0xB1,0x22,0x85,
+	0x64,0x88,0xB1,0x22,0x85,0x63,0x88,0xB1,0x22,0x85,0x66,0x09,0x80,0x85,0x62,0x88,
+	0xB1,0x22,0x85,0x61,0x84,0x70,0x60,0xA2,0x5C,0x2C,0xA2,0x57,0xA0,0x00,0xF0,0x04,
+	0xA6,0x49,0xA4,0x4A,0x20,0x1B,0xBC,0x86,0x22,0x84,0x23,0xA0,0x04,0xA5,0x65,0x91,
+	0x22,0x88,0xA5,0x64,0x91,0x22,0x88,0xA5,0x63,0x91,0x22,0x88,0xA5,0x66,0x09,0x7F,
+	0x25,0x62,0x91,0x22,0x88,0xA5,0x61,0x91,0x22,0x84,0x70,0x60,0xA5,0x6E,0x85,0x66,
+	0xA2,0x05,0xB5,0x68,0x95,0x60,0xCA,0xD0,0xF9,0x86,0x70,0x60,0x20,0x1B,0xBC,0xA2,
+	0x06,0xB5,0x60,0x95,0x68,0xCA,0xD0,0xF9,0x86,0x70,0x60,0xA5,0x61,0xF0,0xFB,0x06,
+	0x70,0x90,0xF7,0x20,0x6F,0xB9,0xD0,0xF2,0x4C,0x38,0xB9,0xA5,0x61,0xF0,0x09,0xA5,
+	0x66,0x2A,0xA9,0xFF,0xB0,0x02,0xA9,0x01,0x60,0x20,0x2B,0xBC,0x85,0x62,0xA9,0x00,
+	0x85,0x63,0xA2,0x88,0xA5,0x62,0x49,0xFF,0x2A,0xA9,0x00,0x85,0x65,0x85,0x64,0x86,
+	0x61,0x85,0x70,0x85,0x66,0x4C,0xD2,0xB8,0x46,0x66,0x60,0x85,0x24,0x84,0x25,0xA0,
+	0x00,0xB1,0x24,0xC8,0xAA,0xF0,0xC4,0xB1,0x24,0x45,0x66,0x30,0xC2,0xE4,0x61,0xD0,
+	0x21,0xB1,0x24,0x09,0x80,0xC5,0x62,0xD0,0x19,0xC8,0xB1,0x24,0xC5,0x63,0xD0,0x12,
+	0xC8,0xB1,0x24,0xC5,0x64,0xD0,0x0B,0xC8,0xA9,0x7F,0xC5,0x70,0xB1,0x24,0xE5,0x65,
+	0xF0,0x28,0xA5,0x66,0x90,0x02,0x49,0xFF,0x4C,0x31,0xBC,0xA5,0x61,0xF0,0x4A,0x38,
+	0xE9,0xA0,0x24,0x66,0x10,0x09,0xAA,0xA9,0xFF,0x85,0x68,0x20,0x4D,0xB9,0x8A,0xA2,
+	0x61,0xC9,0xF9,0x10,0x06,0x20,0x99,0xB9,0x84,0x68,0x60,0xA8,0xA5,0x66,0x29,0x80,
+	0x46,0x62,0x05,0x62,0x85,0x62,0x20,0xB0,0xB9,0x84,0x68,0x60,0xA5,0x61,0xC9,0xA0,
+	0xB0,0x20,0x20,0x9B,0xBC,0x84,0x70,0xA5,0x66,0x84,0x66,0x49,0x80,0x2A,0xA9,0xA0,
+	0x85,0x61,0xA5,0x65,0x85,0x07,0x4C,0xD2,0xB8,0x85,0x62,0x85,0x63,0x85,0x64,0x85,
+	0x65,0xA8,0x60,0xA0,0x00,0xA2,0x0A,0x94,0x5D,0xCA,0x10,0xFB,0x90,0x0F,0xC9,0x2D,
+	0xD0,0x04,0x86,0x67,0xF0,0x04,0xC9,0x2B,0xD0,0x05,0x20,0x73,0x00,0x90,0x5B,0xC9,
+	0x2E,0xF0,0x2E,0xC9,0x45,0xD0,0x30,0x20,0x73,0x00,0x90,0x17,0xC9,0xAB,0xF0,0x0E,
+	0xC9,0x2D,0xF0,0x0A,0xC9,0xAA,0xF0,0x08,0xC9,0x2B,0xF0,0x04,0xD0,0x07,0x66,0x60,
+	0x20,0x73,0x00,0x90,0x5C,0x24,0x60,0x10,0x0E,0xA9,0x00,0x38,0xE5,0x5E,0x4C,0x49,
+	0xBD,0x66,0x5F,0x24,0x5F,0x50,0xC3,0xA5,0x5E,0x38,0xE5,0x5D,0x85,0x5E,0xF0,0x12,
+	0x10,0x09,0x20,0xFE,0xBA,0xE6,0x5E,0xD0,0xF9,0xF0,0x07,0x20,0xE2,0xBA,0xC6,0x5E,
+	0xD0,0xF9,0xA5,0x67,0x30,0x01,0x60,0x4C,0xB4,0xBF,0x48,0x24,0x5F,0x10,0x02,0xE6,
+	0x5D,0x20,0xE2,0xBA,0x68,0x38,0xE9,0x30,0x20,0x7E,0xBD,0x4C,0x0A,0xBD,0x48,0x20,
+	0x0C,0xBC,0x68,0x20,0x3C,0xBC,0xA5,0x6E,0x45,0x66,0x85,0x6F,0xA6,0x61,0x4C,0x6A,
+	0xB8,0xA5,0x5E,0xC9,0x0A,0x90,0x09,0xA9,0x64,0x24,0x60,0x30,0x11,0x4C,0x7E,0xB9,
+	0x0A,0x0A,0x18,0x65,0x5E,0x0A,0x18,0xA0,0x00,0x71,0x7A,0x38,0xE9,0x30,0x85,0x5E,
+	0x4C,0x30,0xBD,0x9B,0x3E,0xBC,0x1F,0xFD,0x9E,0x6E,0x6B,0x27,0xFD,0x9E,0x6E,0x6B,
+	0x28,0x00,0xA9,0x71,0xA0,0xA3,0x20,0xDA,0xBD,0xA5,0x3A,0xA6,0x39,0x85,0x62,0x86,
+	0x63,0xA2,0x90,0x38,0x20,0x49,0xBC,0x20,0xDF,0xBD,0x4C,0x1E,0xAB,0xA0,0x01,0xA9,
+	0x20,0x24,0x66,0x10,0x02,0xA9,0x2D,0x99,0xFF,0x00,0x85,0x66,0x84,0x71,0xC8,0xA9,
+	0x30,0xA6,0x61,0xD0,0x03,0x4C,0x04,0xBF,0xA9,0x00,0xE0,0x80,0xF0,0x02,0xB0,0x09,
+	0xA9,0xBD,0xA0,0xBD,0x20,0x28,0xBA,0xA9,0xF7,0x85,0x5D,0xA9,0xB8,0xA0,0xBD,0x20,
+	0x5B,0xBC,0xF0,0x1E,0x10,0x12,0xA9,0xB3,0xA0,0xBD,0x20,0x5B,0xBC,0xF0,0x02,0x10,
+	0x0E,0x20,0xE2,0xBA,0xC6,0x5D,0xD0,0xEE,0x20,0xFE,0xBA,0xE6,0x5D,0xD0,0xDC,0x20,
+	0x49,0xB8,0x20,0x9B,0xBC,0xA2,0x01,0xA5,0x5D,0x18,0x69,0x0A,0x30,0x09,0xC9,0x0B,
+	0xB0,0x06,0x69,0xFF,0xAA,0xA9,0x02,0x38,0xE9,0x02,0x85,0x5E,0x86,0x5D,0x8A,0xF0,
+	0x02,0x10,0x13,0xA4,0x71,0xA9,0x2E,0xC8,0x99,0xFF,0x00,0x8A,0xF0,0x06,0xA9,0x30,
+	0xC8,0x99,0xFF,0x00,0x84,0x71,0xA0,0x00,0xA2,0x80,0xA5,0x65,0x18,0x79,0x19,0xBF,
+	0x85,0x65,0xA5,0x64,0x79,0x18,0xBF,0x85,0x64,0xA5,0x63,0x79,0x17,0xBF,0x85,0x63,
+	0xA5,0x62,0x79,0x16,0xBF,0x85,0x62,0xE8,0xB0,0x04,0x10,0xDE,0x30,0x02,0x30,0xDA,
+	0x8A,0x90,0x04,0x49,0xFF,0x69,0x0A,0x69,0x2F,0xC8,0xC8,0xC8,0xC8,0x84,0x47,0xA4,
+	0x71,0xC8,0xAA,0x29,0x7F,0x99,0xFF,0x00,0xC6,0x5D,0xD0,0x06,0xA9,0x2E,0xC8,0x99,
+	0xFF,0x00,0x84,0x71,0xA4,0x47,0x8A,0x49,0xFF,0x29,0x80,0xAA,0xC0,0x24,0xF0,0x04,
+	0xC0,0x3C,0xD0,0xA6,0xA4,0x71,0xB9,0xFF,0x00,0x88,0xC9,0x30,0xF0,0xF8,0xC9,0x2E,
+	0xF0,0x01,0xC8,0xA9,0x2B,0xA6,0x5E,0xF0,0x2E,0x10,0x08,0xA9,0x00,0x38,0xE5,0x5E,
+	0xAA,0xA9,0x2D,0x99,0x01,0x01,0xA9,0x45,0x99,0x00,0x01,0x8A,0xA2,0x2F,0x38,0xE8,
+	0xE9,0x0A,0xB0,0xFB,0x69,0x3A,0x99,0x03,0x01,0x8A,0x99,0x02,0x01,0xA9,0x00,0x99,
+	0x04,0x01,0xF0,0x08,0x99,0xFF,0x00,0xA9,0x00,0x99,0x00,0x01,0xA9,0x00,0xA0,0x01,
+	0x60,0x80,0x00,0x00,0x00,0x00,0xFA,0x0A,0x1F,0x00,0x00,0x98,0x96,0x80,0xFF,0xF0,
+	0xBD,0xC0,0x00,0x01,0x86,0xA0,0xFF,0xFF,0xD8,0xF0,0x00,0x00,0x03,0xE8,0xFF,0xFF,
+	0xFF,0x9C,0x00,0x00,0x00,0x0A,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0x0A,0x80,0x00,0x03,
+	0x4B,0xC0,0xFF,0xFF,0x73,0x60,0x00,0x00,0x0E,0x10,0xFF,0xFF,0xFD,0xA8,0x00,0x00,
+	0x00,0x3C,0xEC,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,
+	0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,
+	0xAA,0x20,0x0C,0xBC,0xA9,0x11,0xA0,0xBF,0x20,0xA2,0xBB,0xF0,0x70,0xA5,0x69,0xD0,
+	0x03,0x4C,0xF9,0xB8,0xA2,0x4E,0xA0,0x00,0x20,0xD4,0xBB,0xA5,0x6E,0x10,0x0F,0x20,
+	0xCC,0xBC,0xA9,0x4E,0xA0,0x00,0x20,0x5B,0xBC,0xD0,0x03,0x98,0xA4,0x07,0x20,0xFE,
+	0xBB,0x98,0x48,0x20,0xEA,0xB9,0xA9,0x4E,0xA0,0x00,0x20,0x28,0xBA,0x20,0xED,0xBF,
+	0x68,0x4A,0x90,0x0A,0xA5,0x61,0xF0,0x06,0xA5,0x66,0x49,0xFF,0x85,0x66,0x60,0x81,
+	0x38,0xAA,0x3B,0x29,0x07,0x71,0x34,0x58,0x3E,0x56,0x74,0x16,0x7E,0xB3,0x1B,0x77,
+	0x2F,0xEE,0xE3,0x85,0x7A,0x1D,0x84,0x1C,0x2A,0x7C,0x63,0x59,0x58,0x0A,0x7E,0x75,
+	0xFD,0xE7,0xC6,0x80,0x31,0x72,0x18,0x10,0x81,0x00,0x00,0x00,0x00,0xA9,0xBF,0xA0,
+	0xBF,0x20,0x28,0xBA,0xA5,0x70,0x69,0x50,0x90,0x03,0x20,0x23,0xBC,0x4C,0x00,0xE0,
+};
+
+const uint8_t KernalROM6510[8192] = {
+	0x85,0x56,0x20,0x0F,0xBC,0xA5,0x61,0xC9,0x88,0x90,0x03,0x20,0xD4,0xBA,0x20,0xCC,
+	0xBC,0xA5,0x07,0x18,0x69,0x81,0xF0,0xF3,0x38,0xE9,0x01,0x48,0xA2,0x05,0xB5,0x69,
+	0xB4,0x61,0x95,0x61,0x94,0x69,0xCA,0x10,0xF5,0xA5,0x56,0x85,0x70,0x20,0x53,0xB8,
+	0x20,0xB4,0xBF,0xA9,0xC4,0xA0,0xBF,0x20,0x59,0xE0,0xA9,0x00,0x85,0x6F,0x68,0x20,
+	0xB9,0xBA,0x60,0x85,0x71,0x84,0x72,0x20,0xCA,0xBB,0xA9,0x57,0x20,0x28,0xBA,0x20,
+	0x5D,0xE0,0xA9,0x57,0xA0,0x00,0x4C,0x28,0xBA,0x85,0x71,0x84,0x72,0x20,0xC7,0xBB,
+	0xB1,0x71,0x85,0x67,0xA4,0x71,0xC8,0x98,0xD0,0x02,0xE6,0x72,0x85,0x71,0xA4,0x72,
+	0x20,0x28,0xBA,0xA5,0x71,0xA4,0x72,0x18,0x69,0x05,0x90,0x01,0xC8,0x85,0x71,0x84,
+	0x72,0x20,0x67,0xB8,0xA9,0x5C,0xA0,0x00,0xC6,0x67,0xD0,0xE4,0x60,0x98,0x35,0x44,
+	0x7A,0x00,0x68,0x28,0xB1,0x46,0x00,0x20,0x2B,0xBC,0x30,0x37,0xD0,0x20,0x20,0xF3,
+	0xFF,0x86,0x22,0x84,0x23,0xA0,0x04,0xB1,0x22,0x85,0x62,0xC8,0xB1,0x22,0x85,0x64,
+	0xA0,0x08,0xB1,0x22,0x85,0x63,0xC8,0xB1,0x22,0x85,0x65,0x4C,0xE3,0xE0,0xA9,0x8B,
+	0xA0,0x00,0x20,0xA2,0xBB,0xA9,0x8D,0xA0,0xE0,0x20,0x28,0xBA,0xA9,0x92,0xA0,0xE0,
+	0x20,0x67,0xB8,0xA6,0x65,0xA5,0x62,0x85,0x65,0x86,0x62,0xA6,0x63,0xA5,0x64,0x85,
+	0x63,0x86,0x64,0xA9,0x00,0x85,0x66,0xA5,0x61,0x85,0x70,0xA9,0x80,0x85,0x61,0x20,
+	0xD7,0xB8,0xA2,0x8B,0xA0,0x00,0x4C,0xD4,0xBB,0xC9,0xF0,0xD0,0x07,0x84,0x38,0x86,
+	0x37,0x4C,0x63,0xA6,0xAA,0xD0,0x02,0xA2,0x1E,0x4C,0x37,0xA4,0x20,0xD2,0xFF,0xB0,
+	0xE8,0x60,0x20,0xCF,0xFF,0xB0,0xE2,0x60,0x20,0xAD,0xE4,0xB0,0xDC,0x60,0x20,0xC6,
+	0xFF,0xB0,0xD6,0x60,0x20,0xE4,0xFF,0xB0,0xD0,0x60,0x20,0x8A,0xAD,0x20,0xF7,0xB7,
+	0xA9,0xE1,0x48,0xA9,0x46,0x48,0xAD,0x0F,0x03,0x48,0xAD,0x0C,0x03,0xAE,0x0D,0x03,
+	0xAC,0x0E,0x03,0x28,0x6C,0x14,0x00,0x08,0x8D,0x0C,0x03,0x8E,0x0D,0x03,0x8C,0x0E,
+	0x03,0x68,0x8D,0x0F,0x03,0x60,0x20,0xD4,0xE1,0xA6,0x2D,0xA4,0x2E,0xA9,0x2B,0x20,
+	0xD8,0xFF,0xB0,0x95,0x60,0xA9,0x01,0x2C,0xA9,0x00,0x85,0x0A,0x20,0xD4,0xE1,0xA5,
+	0x0A,0xA6,0x2B,0xA4,0x2C,0x20,0xD5,0xFF,0xB0,0x57,0xA5,0x0A,0xF0,0x17,0xA2,0x1C,
+	0x20,0xB7,0xFF,0x29,0x10,0xD0,0x17,0xA5,0x7A,0xC9,0x02,0xF0,0x07,0xA9,0x64,0xA0,
+	0xA3,0x4C,0x1E,0xAB,0x60,0x20,0xB7,0xFF,0x29,0xBF,0xF0,0x05,0xA2,0x1D,0x4C,0x37,
+	0xA4,0xA5,0x7B,0xC9,0x02,0xD0,0x0E,0x86,0x2D,0x84,0x2E,0xA9,0x76,0xA0,0xA3,0x20,
+	0x1E,0xAB,0x4C,0x2A,0xA5,0x20,0x8E,0xA6,0x20,0x33,0xA5,0x4C,0x77,0xA6,0x20,0x19,
+	0xE2,0x20,0xC0,0xFF,0xB0,0x0B,0x60,0x20,0x19,0xE2,0xA5,0x49,0x20,0xC3,0xFF,0x90,
+	0xC3,0x4C,0xF9,0xE0,0xA9,0x00,0x20,0xBD,0xFF,0xA2,0x01,0xA0,0x00,0x20,0xBA,0xFF,
+	0x20,0x06,0xE2,0x20,0x57,0xE2,0x20,0x06,0xE2,0x20,0x00,0xE2,0xA0,0x00,0x86,0x49,
+	0x20,0xBA,0xFF,0x20,0x06,0xE2,0x20,0x00,0xE2,0x8A,0xA8,0xA6,0x49,0x4C,0xBA,0xFF,
+	0x20,0x0E,0xE2,0x4C,0x9E,0xB7,0x20,0x79,0x00,0xD0,0x02,0x68,0x68,0x60,0x20,0xFD,
+	0xAE,0x20,0x79,0x00,0xD0,0xF7,0x4C,0x08,0xAF,0xA9,0x00,0x20,0xBD,0xFF,0x20,0x11,
+	0xE2,0x20,0x9E,0xB7,0x86,0x49,0x8A,0xA2,0x01,0xA0,0x00,0x20,0xBA,0xFF,0x20,0x06,
+	0xE2,0x20,0x00,0xE2,0x86,0x4A,0xA0,0x00,0xA5,0x49,0xE0,0x03,0x90,0x01,0x88,0x20,
+	0xBA,0xFF,0x20,0x06,0xE2,0x20,0x00,0xE2,0x8A,0xA8,0xA6,0x4A,0xA5,0x49,0x20,0xBA,
+	0xFF,0x20,0x06,0xE2,0x20,0x0E,0xE2,0x20,0x9E,0xAD,0x20,0xA3,0xB6,0xA6,0x22,0xA4,
+	0x23,0x4C,0xBD,0xFF,0xA9,0xE0,0xA0,0xE2,0x20,0x67,0xB8,0x20,0x0C,0xBC,0xA9,0xE5,
+	0xA0,0xE2,0xA6,0x6E,0x20,0x07,0xBB,0x20,0x0C,0xBC,0x20,0xCC,0xBC,0xA9,0x00,0x85,
+	0x6F,0x20,0x53,0xB8,0xA9,0xEA,0xA0,0xE2,0x20,0x50,0xB8,0xA5,0x66,0x48,0x10,0x0D,
+	0x20,0x49,0xB8,0xA5,0x66,0x30,0x09,0xA5,0x12,0x49,0xFF,0x85,0x12,0x20,0xB4,0xBF,
+	0xA9,0xEA,0xA0,0xE2,0x20,0x67,0xB8,0x68,0x10,0x03,0x20,0xB4,0xBF,0xA9,0xEF,0xA0,
+	0xE2,0x4C,0x43,0xE0,0x20,0xCA,0xBB,0xA9,0x00,0x85,0x12,0x20,0x6B,0xE2,0xA2,0x4E,
+	0xA0,0x00,0x20,0xF6,0xE0,0xA9,0x57,0xA0,0x00,0x20,0xA2,0xBB,0xA9,0x00,0x85,0x66,
+	0xA5,0x12,0x20,0xDC,0xE2,0xA9,0x4E,0xA0,0x00,0x4C,0x0F,0xBB,0x48,0x4C,0x9D,0xE2,
+	0x81,0x49,0x0F,0xDA,0xA2,0x83,0x49,0x0F,0xDA,0xA2,0x7F,0x00,0x00,0x00,0x00,0x05,
+	0x84,0xE6,0x1A,0x2D,0x1B,0x86,0x28,0x07,0xFB,0xF8,0x87,0x99,0x68,0x89,0x01,0x87,
+	0x23,0x35,0xDF,0xE1,0x86,0xA5,0x5D,0xE7,0x28,0x83,0x49,0x0F,0xDA,0xA2,0xA5,0x66,
+	0x48,0x10,0x03,0x20,0xB4,0xBF,0xA5,0x61,0x48,0xC9,0x81,0x90,0x07,0xA9,0xBC,0xA0,
+	0xB9,0x20,0x0F,0xBB,0xA9,0x3E,0xA0,0xE3,0x20,0x43,0xE0,0x68,0xC9,0x81,0x90,0x07,
+	0xA9,0xE0,0xA0,0xE2,0x20,0x50,0xB8,0x68,0x10,0x03,0x4C,0xB4,0xBF,0x60,0x0B,0x76,
+	0xB3,0x83,0xBD,0xD3,0x79,0x1E,0xF4,0xA6,0xF5,0x7B,0x83,0xFC,0xB0,0x10,0x7C,0x0C,
+	0x1F,0x67,0xCA,0x7C,0xDE,0x53,0xCB,0xC1,0x7D,0x14,0x64,0x70,0x4C,0x7D,0xB7,0xEA,
+	0x51,0x7A,0x7D,0x63,0x30,0x88,0x7E,0x7E,0x92,0x44,0x99,0x3A,0x7E,0x4C,0xCC,0x91,
+	0xC7,0x7F,0xAA,0xAA,0xAA,0x13,0x81,0x00,0x00,0x00,0x00,0x20,0xCC,0xFF,0xA9,0x00,
+	0x85,0x13,0x20,0x7A,0xA6,0x58,0xA2,0x80,0x6C,0x00,0x03,0x8A,0x30,0x03,0x4C,0x3A,
+	0xA4,0x4C,0x74,0xA4,0x20,0x53,0xE4,0x20,0xBF,0xE3,0x20,0x22,0xE4,0xA2,0xFB,0x9A,
+	0xD0,0xE4,0xE6,0x7A,0xD0,0x02,0xE6,0x7B,0xAD,0x60,0xEA,0xC9,0x3A,0xB0,0x0A,0xC9,
+	0x20,0xF0,0xEF,0x38,0xE9,0x30,0x38,0xE9,0xD0,0x60,0x80,0x4F,0xC7,0x52,0x58,0xA9,
+	0x4C,0x85,0x54,0x8D,0x10,0x03,0xA9,0x48,0xA0,0xB2,0x8D,0x11,0x03,0x8C,0x12,0x03,
+	0xA9,0x91,0xA0,0xB3,0x85,0x05,0x84,0x06,0xA9,0xAA,0xA0,0xB1,0x85,0x03,0x84,0x04,
+	0xA2,0x1C,0xBD,0xA2,0xE3,0x95,0x73,0xCA,0x10,0xF8,0xA9,0x03,0x85,0x53,0xA9,0x00,
+	0x85,0x68,0x85,0x13,0x85,0x18,0xA2,0x01,0x8E,0xFD,0x01,0x8E,0xFC,0x01,0xA2,0x19,
+	0x86,0x16,0x38,0x20,0x9C,0xFF,0x86,0x2B,0x84,0x2C,0x38,0x20,0x99,0xFF,0x86,0x37,
+	0x84,0x38,0x86,0x33,0x84,0x34,0xA0,0x00,0x98,0x91,0x2B,0xE6,0x2B,0xD0,0x02,0xE6,
+	0x2C,0x60,0xA5,0x2B,0xA4,0x2C,0x20,0x08,0xA4,0xA9,0x73,0xA0,0xE4,0x20,0x1E,0xAB,
+	0xA5,0x37,0x38,0xE5,0x2B,0xAA,0xA5,0x38,0xE5,0x2C,0x20,0xCD,0xBD,0xA9,0x60,0xA0,
+	0xE4,0x20,0x1E,0xAB,0x4C,0x44,0xA6,0x8B,0xE3,0x83,0xA4,0x7C,0xA5,0x1A,0xA7,0xE4,
+	0xA7,0x86,0xAE,0xA2,0x0B,0xBD,0x47,0xE4,0x9D,0x00,0x03,0xCA,0x10,0xF7,0x60,0x00,
+	0x20,0x42,0x41,0x53,0x49,0x43,0x20,0x42,0x59,0x54,0x45,0x53,0x20,0x46,0x52,0x45,
+	0x45,0x0D,0x00,0x93,0x0D,0x20,0x20,0x20,0x20,0x2A,0x2A,0x2A,0x2A,0x20,0x43,0x4F,
+	0x4D,0x4D,0x4F,0x44,0x4F,0x52,0x45,0x20,0x36,0x34,0x20,0x42,0x41,0x53,0x49,0x43,
+	0x20,0x56,0x32,0x20,0x2A,0x2A,0x2A,0x2A,0x0D,0x0D,0x20,0x36,0x34,0x4B,0x20,0x52,
+	0x41,0x4D,0x20,0x53,0x59,0x53,0x54,0x45,0x4D,0x20,0x20,0x00,0x5C,0x48,0x20,0xC9,
+	0xFF,0xAA,0x68,0x90,0x01,0x8A,0x60,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,
+	0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,
+	0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAA,0xAD,0x86,0x02,0x91,0xF3,0x60,
+	0x69,0x02,0xA4,0x91,0xC8,0xD0,0x04,0xC5,0xA1,0xD0,0xF7,0x60,0x19,0x26,0x44,0x19,
+	0x1A,0x11,0xE8,0x0D,0x70,0x0C,0x06,0x06,0xD1,0x02,0x37,0x01,0xAE,0x00,0x69,0x00,
+	0xA2,0x00,0xA0,0xDC,0x60,0xA2,0x28,0xA0,0x19,0x60,0xB0,0x07,0x86,0xD6,0x84,0xD3,
+	0x20,0x6C,0xE5,0xA6,0xD6,0xA4,0xD3,0x60,0x20,0xA0,0xE5,0xA9,0x00,0x8D,0x91,0x02,
+	0x85,0xCF,0xA9,0x48,0x8D,0x8F,0x02,0xA9,0xEB,0x8D,0x90,0x02,0xA9,0x0A,0x8D,0x89,
+	0x02,0x8D,0x8C,0x02,0xA9,0x0E,0x8D,0x86,0x02,0xA9,0x04,0x8D,0x8B,0x02,0xA9,0x0C,
+	0x85,0xCD,0x85,0xCC,0xAD,0x88,0x02,0x09,0x80,0xA8,0xA9,0x00,0xAA,0x94,0xD9,0x18,
+	0x69,0x28,0x90,0x01,0xC8,0xE8,0xE0,0x1A,0xD0,0xF3,0xA9,0xFF,0x95,0xD9,0xA2,0x18,
+	0x20,0xFF,0xE9,0xCA,0x10,0xFA,0xA0,0x00,0x84,0xD3,0x84,0xD6,0xA6,0xD6,0xA5,0xD3,
+	0xB4,0xD9,0x30,0x08,0x18,0x69,0x28,0x85,0xD3,0xCA,0x10,0xF4,0xB5,0xD9,0x29,0x03,
+	0x0D,0x88,0x02,0x85,0xD2,0xBD,0xF0,0xEC,0x85,0xD1,0xA9,0x27,0xE8,0xB4,0xD9,0x30,
+	0x06,0x18,0x69,0x28,0xE8,0x10,0xF6,0x85,0xD5,0x60,0x20,0xA0,0xE5,0x4C,0x66,0xE5,
+	0xA9,0x03,0x85,0x9A,0xA9,0x00,0x85,0x99,0xA2,0x2F,0xBD,0xB8,0xEC,0x9D,0xFF,0xCF,
+	0xCA,0xD0,0xF7,0x60,0xAC,0x77,0x02,0xA2,0x00,0xBD,0x78,0x02,0x9D,0x77,0x02,0xE8,
+	0xE4,0xC6,0xD0,0xF5,0xC6,0xC6,0x98,0x58,0x18,0x60,0x20,0x16,0xE7,0xA5,0xC6,0x85,
+	0xCC,0x8D,0x92,0x02,0xF0,0xF7,0x78,0xA5,0xCF,0xF0,0x0C,0xA5,0xCE,0xAE,0x87,0x02,
+	0xA0,0x00,0x84,0xCF,0x20,0x13,0xEA,0x20,0xB4,0xE5,0xC9,0x83,0xD0,0x10,0xA2,0x09,
+	0x78,0x86,0xC6,0xBD,0xE6,0xEC,0x9D,0x76,0x02,0xCA,0xD0,0xF7,0xF0,0xCF,0xC9,0x0D,
+	0xD0,0xC8,0xA4,0xD5,0x84,0xD0,0xB1,0xD1,0xC9,0x20,0xD0,0x03,0x88,0xD0,0xF7,0xC8,
+	0x84,0xC8,0xA0,0x00,0x8C,0x92,0x02,0x84,0xD3,0x84,0xD4,0xA5,0xC9,0x30,0x1B,0xA6,
+	0xD6,0x20,0xED,0xE6,0xE4,0xC9,0xD0,0x12,0xA5,0xCA,0x85,0xD3,0xC5,0xC8,0x90,0x0A,
+	0xB0,0x2B,0x98,0x48,0x8A,0x48,0xA5,0xD0,0xF0,0x93,0xA4,0xD3,0xB1,0xD1,0x85,0xD7,
+	0x29,0x3F,0x06,0xD7,0x24,0xD7,0x10,0x02,0x09,0x80,0x90,0x04,0xA6,0xD4,0xD0,0x04,
+	0x70,0x02,0x09,0x40,0xE6,0xD3,0x20,0x84,0xE6,0xC4,0xC8,0xD0,0x17,0xA9,0x00,0x85,
+	0xD0,0xA9,0x0D,0xA6,0x99,0xE0,0x03,0xF0,0x06,0xA6,0x9A,0xE0,0x03,0xF0,0x03,0x20,
+	0x16,0xE7,0xA9,0x0D,0x85,0xD7,0x68,0xAA,0x68,0xA8,0xA5,0xD7,0xC9,0xDE,0xD0,0x02,
+	0xA9,0xFF,0x18,0x60,0xC9,0x22,0xD0,0x08,0xA5,0xD4,0x49,0x01,0x85,0xD4,0xA9,0x22,
+	0x60,0x09,0x40,0xA6,0xC7,0xF0,0x02,0x09,0x80,0xA6,0xD8,0xF0,0x02,0xC6,0xD8,0xAE,
+	0x86,0x02,0x20,0x13,0xEA,0x20,0xB6,0xE6,0x68,0xA8,0xA5,0xD8,0xF0,0x02,0x46,0xD4,
+	0x68,0xAA,0x68,0x18,0x58,0x60,0x20,0xB3,0xE8,0xE6,0xD3,0xA5,0xD5,0xC5,0xD3,0xB0,
+	0x3F,0xC9,0x4F,0xF0,0x32,0xAD,0x92,0x02,0xF0,0x03,0x4C,0x67,0xE9,0xA6,0xD6,0xE0,
+	0x19,0x90,0x07,0x20,0xEA,0xE8,0xC6,0xD6,0xA6,0xD6,0x16,0xD9,0x56,0xD9,0xE8,0xB5,
+	0xD9,0x09,0x80,0x95,0xD9,0xCA,0xA5,0xD5,0x18,0x69,0x28,0x85,0xD5,0xB5,0xD9,0x30,
+	0x03,0xCA,0xD0,0xF9,0x4C,0xF0,0xE9,0xC6,0xD6,0x20,0x7C,0xE8,0xA9,0x00,0x85,0xD3,
+	0x60,0xA6,0xD6,0xD0,0x06,0x86,0xD3,0x68,0x68,0xD0,0x9D,0xCA,0x86,0xD6,0x20,0x6C,
+	0xE5,0xA4,0xD5,0x84,0xD3,0x60,0x48,0x85,0xD7,0x8A,0x48,0x98,0x48,0xA9,0x00,0x85,
+	0xD0,0xA4,0xD3,0xA5,0xD7,0x10,0x03,0x4C,0xD4,0xE7,0xC9,0x0D,0xD0,0x03,0x4C,0x91,
+	0xE8,0xC9,0x20,0x90,0x10,0xC9,0x60,0x90,0x04,0x29,0xDF,0xD0,0x02,0x29,0x3F,0x20,
+	0x84,0xE6,0x4C,0x93,0xE6,0xA6,0xD8,0xF0,0x03,0x4C,0x97,0xE6,0xC9,0x14,0xD0,0x2E,
+	0x98,0xD0,0x06,0x20,0x01,0xE7,0x4C,0x73,0xE7,0x20,0xA1,0xE8,0x88,0x84,0xD3,0x20,
+	0x24,0xEA,0xC8,0xB1,0xD1,0x88,0x91,0xD1,0xC8,0xB1,0xF3,0x88,0x91,0xF3,0xC8,0xC4,
+	0xD5,0xD0,0xEF,0xA9,0x20,0x91,0xD1,0xAD,0x86,0x02,0x91,0xF3,0x10,0x4D,0xA6,0xD4,
+	0xF0,0x03,0x4C,0x97,0xE6,0xC9,0x12,0xD0,0x02,0x85,0xC7,0xC9,0x13,0xD0,0x03,0x20,
+	0x66,0xE5,0xC9,0x1D,0xD0,0x17,0xC8,0x20,0xB3,0xE8,0x84,0xD3,0x88,0xC4,0xD5,0x90,
+	0x09,0xC6,0xD6,0x20,0x7C,0xE8,0xA0,0x00,0x84,0xD3,0x4C,0xA8,0xE6,0xC9,0x11,0xD0,
+	0x1D,0x18,0x98,0x69,0x28,0xA8,0xE6,0xD6,0xC5,0xD5,0x90,0xEC,0xF0,0xEA,0xC6,0xD6,
+	0xE9,0x28,0x90,0x04,0x85,0xD3,0xD0,0xF8,0x20,0x7C,0xE8,0x4C,0xA8,0xE6,0x20,0xCB,
+	0xE8,0x4C,0x44,0xEC,0x29,0x7F,0xC9,0x7F,0xD0,0x02,0xA9,0x5E,0xC9,0x20,0x90,0x03,
+	0x4C,0x91,0xE6,0xC9,0x0D,0xD0,0x03,0x4C,0x91,0xE8,0xA6,0xD4,0xD0,0x3F,0xC9,0x14,
+	0xD0,0x37,0xA4,0xD5,0xB1,0xD1,0xC9,0x20,0xD0,0x04,0xC4,0xD3,0xD0,0x07,0xC0,0x4F,
+	0xF0,0x24,0x20,0x65,0xE9,0xA4,0xD5,0x20,0x24,0xEA,0x88,0xB1,0xD1,0xC8,0x91,0xD1,
+	0x88,0xB1,0xF3,0xC8,0x91,0xF3,0x88,0xC4,0xD3,0xD0,0xEF,0xA9,0x20,0x91,0xD1,0xAD,
+	0x86,0x02,0x91,0xF3,0xE6,0xD8,0x4C,0xA8,0xE6,0xA6,0xD8,0xF0,0x05,0x09,0x40,0x4C,
+	0x97,0xE6,0xC9,0x11,0xD0,0x16,0xA6,0xD6,0xF0,0x37,0xC6,0xD6,0xA5,0xD3,0x38,0xE9,
+	0x28,0x90,0x04,0x85,0xD3,0x10,0x2A,0x20,0x6C,0xE5,0xD0,0x25,0xC9,0x12,0xD0,0x04,
+	0xA9,0x00,0x85,0xC7,0xC9,0x1D,0xD0,0x12,0x98,0xF0,0x09,0x20,0xA1,0xE8,0x88,0x84,
+	0xD3,0x4C,0xA8,0xE6,0x20,0x01,0xE7,0x4C,0xA8,0xE6,0xC9,0x13,0xD0,0x06,0x20,0x44,
+	0xE5,0x4C,0xA8,0xE6,0x09,0x80,0x20,0xCB,0xE8,0x4C,0x4F,0xEC,0x46,0xC9,0xA6,0xD6,
+	0xE8,0xE0,0x19,0xD0,0x03,0x20,0xEA,0xE8,0xB5,0xD9,0x10,0xF4,0x86,0xD6,0x4C,0x6C,
+	0xE5,0xA2,0x00,0x86,0xD8,0x86,0xC7,0x86,0xD4,0x86,0xD3,0x20,0x7C,0xE8,0x4C,0xA8,
+	0xE6,0xA2,0x02,0xA9,0x00,0xC5,0xD3,0xF0,0x07,0x18,0x69,0x28,0xCA,0xD0,0xF6,0x60,
+	0xC6,0xD6,0x60,0xA2,0x02,0xA9,0x27,0xC5,0xD3,0xF0,0x07,0x18,0x69,0x28,0xCA,0xD0,
+	0xF6,0x60,0xA6,0xD6,0xE0,0x19,0xF0,0x02,0xE6,0xD6,0x60,0xA2,0x0F,0xDD,0xDA,0xE8,
+	0xF0,0x04,0xCA,0x10,0xF8,0x60,0x8E,0x86,0x02,0x60,0x90,0x05,0x1C,0x9F,0x9C,0x1E,
+	0x1F,0x9E,0x81,0x95,0x96,0x97,0x98,0x99,0x9A,0x9B,0xA5,0xAC,0x48,0xA5,0xAD,0x48,
+	0xA5,0xAE,0x48,0xA5,0xAF,0x48,0xA2,0xFF,0xC6,0xD6,0xC6,0xC9,0xCE,0xA5,0x02,0xE8,
+	0x20,0xF0,0xE9,0xE0,0x18,0xB0,0x0C,0xBD,0xF1,0xEC,0x85,0xAC,0xB5,0xDA,0x20,0xC8,
+	0xE9,0x30,0xEC,0x20,0xFF,0xE9,0xA2,0x00,0xB5,0xD9,0x29,0x7F,0xB4,0xDA,0x10,0x02,
+	0x09,0x80,0x95,0xD9,0xE8,0xE0,0x18,0xD0,0xEF,0xA5,0xF1,0x09,0x80,0x85,0xF1,0xA5,
+	0xD9,0x10,0xC3,0xE6,0xD6,0xEE,0xA5,0x02,0xA9,0x7F,0x8D,0x00,0xDC,0xAD,0x01,0xDC,
+	0xC9,0xFB,0x08,0xA9,0x7F,0x8D,0x00,0xDC,0x28,0xD0,0x0B,0xA0,0x00,0xEA,0xCA,0xD0,
+	0xFC,0x88,0xD0,0xF9,0x84,0xC6,0xA6,0xD6,0x68,0x85,0xAF,0x68,0x85,0xAE,0x68,0x85,
+	0xAD,0x68,0x85,0xAC,0x60,0xA6,0xD6,0xE8,0xB5,0xD9,0x10,0xFB,0x8E,0xA5,0x02,0xE0,
+	0x18,0xF0,0x0E,0x90,0x0C,0x20,0xEA,0xE8,0xAE,0xA5,0x02,0xCA,0xC6,0xD6,0x4C,0xDA,
+	0xE6,0xA5,0xAC,0x48,0xA5,0xAD,0x48,0xA5,0xAE,0x48,0xA5,0xAF,0x48,0xA2,0x19,0xCA,
+	0x20,0xF0,0xE9,0xEC,0xA5,0x02,0x90,0x0E,0xF0,0x0C,0xBD,0xEF,0xEC,0x85,0xAC,0xB5,
+	0xD8,0x20,0xC8,0xE9,0x30,0xE9,0x20,0xFF,0xE9,0xA2,0x17,0xEC,0xA5,0x02,0x90,0x0F,
+	0xB5,0xDA,0x29,0x7F,0xB4,0xD9,0x10,0x02,0x09,0x80,0x95,0xDA,0xCA,0xD0,0xEC,0xAE,
+	0xA5,0x02,0x20,0xDA,0xE6,0x4C,0x58,0xE9,0x29,0x03,0x0D,0x88,0x02,0x85,0xAD,0x20,
+	0xE0,0xE9,0xA0,0x27,0xB1,0xAC,0x91,0xD1,0xB1,0xAE,0x91,0xF3,0x88,0x10,0xF5,0x60,
+	0x20,0x24,0xEA,0xA5,0xAC,0x85,0xAE,0xA5,0xAD,0x29,0x03,0x09,0xD8,0x85,0xAF,0x60,
+	0xBD,0xF0,0xEC,0x85,0xD1,0xB5,0xD9,0x29,0x03,0x0D,0x88,0x02,0x85,0xD2,0x60,0xA0,
+	0x27,0x20,0xF0,0xE9,0x20,0x24,0xEA,0xA9,0x20,0x91,0xD1,0x20,0xDA,0xE4,0xEA,0x88,
+	0x10,0xF5,0x60,0xA8,0xA9,0x02,0x85,0xCD,0x20,0x24,0xEA,0x98,0xA4,0xD3,0x91,0xD1,
+	0x8A,0x91,0xF3,0x60,0xA5,0xD1,0x85,0xF3,0xA5,0xD2,0x29,0x03,0x09,0xD8,0x85,0xF4,
+	0x60,0x20,0xEA,0xFF,0xA5,0xCC,0xD0,0x29,0xC6,0xCD,0xD0,0x25,0xA9,0x14,0x85,0xCD,
+	0xA4,0xD3,0x46,0xCF,0xAE,0x87,0x02,0xB1,0xD1,0xB0,0x11,0xE6,0xCF,0x85,0xCE,0x20,
+	0x24,0xEA,0xB1,0xF3,0x8D,0x87,0x02,0xAE,0x86,0x02,0xA5,0xCE,0x49,0x80,0x20,0x1C,
+	0xEA,0xA5,0x01,0x29,0x10,0xF0,0x0A,0xA0,0x00,0x84,0xC0,0xA5,0x01,0x09,0x20,0xD0,
+	0x08,0xA5,0xC0,0xD0,0x06,0xA5,0x01,0x29,0x1F,0x85,0x01,0x20,0x87,0xEA,0xAD,0x0D,
+	0xDC,0x68,0xA8,0x68,0xAA,0x68,0x40,0xA9,0x00,0x8D,0x8D,0x02,0xA0,0x40,0x84,0xCB,
+	0x8D,0x00,0xDC,0xAE,0x01,0xDC,0xE0,0xFF,0xF0,0x61,0xA8,0xA9,0x81,0x85,0xF5,0xA9,
+	0xEB,0x85,0xF6,0xA9,0xFE,0x8D,0x00,0xDC,0xA2,0x08,0x48,0xAD,0x01,0xDC,0xCD,0x01,
+	0xDC,0xD0,0xF8,0x4A,0xB0,0x16,0x48,0xB1,0xF5,0xC9,0x05,0xB0,0x0C,0xC9,0x03,0xF0,
+	0x08,0x0D,0x8D,0x02,0x8D,0x8D,0x02,0x10,0x02,0x84,0xCB,0x68,0xC8,0xC0,0x41,0xB0,
+	0x0B,0xCA,0xD0,0xDF,0x38,0x68,0x2A,0x8D,0x00,0xDC,0xD0,0xCC,0x68,0x6C,0x8F,0x02,
+	0xA4,0xCB,0xB1,0xF5,0xAA,0xC4,0xC5,0xF0,0x07,0xA0,0x10,0x8C,0x8C,0x02,0xD0,0x36,
+	0x29,0x7F,0x2C,0x8A,0x02,0x30,0x16,0x70,0x49,0xC9,0x7F,0xF0,0x29,0xC9,0x14,0xF0,
+	0x0C,0xC9,0x20,0xF0,0x08,0xC9,0x1D,0xF0,0x04,0xC9,0x11,0xD0,0x35,0xAC,0x8C,0x02,
+	0xF0,0x05,0xCE,0x8C,0x02,0xD0,0x2B,0xCE,0x8B,0x02,0xD0,0x26,0xA0,0x04,0x8C,0x8B,
+	0x02,0xA4,0xC6,0x88,0x10,0x1C,0xA4,0xCB,0x84,0xC5,0xAC,0x8D,0x02,0x8C,0x8E,0x02,
+	0xE0,0xFF,0xF0,0x0E,0x8A,0xA6,0xC6,0xEC,0x89,0x02,0xB0,0x06,0x9D,0x77,0x02,0xE8,
+	0x86,0xC6,0xA9,0x7F,0x8D,0x00,0xDC,0x60,0xAD,0x8D,0x02,0xC9,0x03,0xD0,0x15,0xCD,
+	0x8E,0x02,0xF0,0xEE,0xAD,0x91,0x02,0x30,0x1D,0xAD,0x18,0xD0,0x49,0x02,0x8D,0x18,
+	0xD0,0x4C,0x76,0xEB,0x0A,0xC9,0x08,0x90,0x02,0xA9,0x06,0xAA,0xBD,0x79,0xEB,0x85,
+	0xF5,0xBD,0x7A,0xEB,0x85,0xF6,0x4C,0xE0,0xEA,0x81,0xEB,0xC2,0xEB,0x03,0xEC,0x78,
+	0xEC,0x14,0x0D,0x1D,0x88,0x85,0x86,0x87,0x11,0x33,0x57,0x41,0x34,0x5A,0x53,0x45,
+	0x01,0x35,0x52,0x44,0x36,0x43,0x46,0x54,0x58,0x37,0x59,0x47,0x38,0x42,0x48,0x55,
+	0x56,0x39,0x49,0x4A,0x30,0x4D,0x4B,0x4F,0x4E,0x2B,0x50,0x4C,0x2D,0x2E,0x3A,0x40,
+	0x2C,0x5C,0x2A,0x3B,0x13,0x01,0x3D,0x5E,0x2F,0x31,0x5F,0x04,0x32,0x20,0x02,0x51,
+	0x03,0xFF,0x94,0x8D,0x9D,0x8C,0x89,0x8A,0x8B,0x91,0x23,0xD7,0xC1,0x24,0xDA,0xD3,
+	0xC5,0x01,0x25,0xD2,0xC4,0x26,0xC3,0xC6,0xD4,0xD8,0x27,0xD9,0xC7,0x28,0xC2,0xC8,
+	0xD5,0xD6,0x29,0xC9,0xCA,0x30,0xCD,0xCB,0xCF,0xCE,0xDB,0xD0,0xCC,0xDD,0x3E,0x5B,
+	0xBA,0x3C,0xA9,0xC0,0x5D,0x93,0x01,0x3D,0xDE,0x3F,0x21,0x5F,0x04,0x22,0xA0,0x02,
+	0xD1,0x83,0xFF,0x94,0x8D,0x9D,0x8C,0x89,0x8A,0x8B,0x91,0x96,0xB3,0xB0,0x97,0xAD,
+	0xAE,0xB1,0x01,0x98,0xB2,0xAC,0x99,0xBC,0xBB,0xA3,0xBD,0x9A,0xB7,0xA5,0x9B,0xBF,
+	0xB4,0xB8,0xBE,0x29,0xA2,0xB5,0x30,0xA7,0xA1,0xB9,0xAA,0xA6,0xAF,0xB6,0xDC,0x3E,
+	0x5B,0xA4,0x3C,0xA8,0xDF,0x5D,0x93,0x01,0x3D,0xDE,0x3F,0x81,0x5F,0x04,0x95,0xA0,
+	0x02,0xAB,0x83,0xFF,0xC9,0x0E,0xD0,0x07,0xAD,0x18,0xD0,0x09,0x02,0xD0,0x09,0xC9,
+	0x8E,0xD0,0x0B,0xAD,0x18,0xD0,0x29,0xFD,0x8D,0x18,0xD0,0x4C,0xA8,0xE6,0xC9,0x08,
+	0xD0,0x07,0xA9,0x80,0x0D,0x91,0x02,0x30,0x09,0xC9,0x09,0xD0,0xEE,0xA9,0x7F,0x2D,
+	0x91,0x02,0x8D,0x91,0x02,0x4C,0xA8,0xE6,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0x1C,0x17,0x01,0x9F,0x1A,0x13,0x05,0xFF,0x9C,0x12,0x04,0x1E,0x03,0x06,0x14,0x18,
+	0x1F,0x19,0x07,0x9E,0x02,0x08,0x15,0x16,0x12,0x09,0x0A,0x92,0x0D,0x0B,0x0F,0x0E,
+	0xFF,0x10,0x0C,0xFF,0xFF,0x1B,0x00,0xFF,0x1C,0xFF,0x1D,0xFF,0xFF,0x1F,0x1E,0xFF,
+	0x90,0x06,0xFF,0x05,0xFF,0xFF,0x11,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9B,0x37,0x00,0x00,0x00,0x08,
+	0x00,0x14,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x06,0x01,0x02,0x03,0x04,0x00,
+	0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x4C,0x4F,0x41,0x44,0x0D,0x52,0x55,0x4E,0x0D,
+	0x00,0x28,0x50,0x78,0xA0,0xC8,0xF0,0x18,0x40,0x68,0x90,0xB8,0xE0,0x08,0x30,0x58,
+	0x80,0xA8,0xD0,0xF8,0x20,0x48,0x70,0x98,0xC0,0x09,0x40,0x2C,0x09,0x20,0x20,0xA4,
+	0xF0,0x48,0x24,0x94,0x10,0x0A,0x38,0x66,0xA3,0x20,0x40,0xED,0x46,0x94,0x46,0xA3,
+	0x68,0x85,0x95,0x78,0x20,0x97,0xEE,0xC9,0x3F,0xD0,0x03,0x20,0x85,0xEE,0xAD,0x00,
+	0xDD,0x09,0x08,0x8D,0x00,0xDD,0x78,0x20,0x8E,0xEE,0x20,0x97,0xEE,0x20,0xB3,0xEE,
+	0x78,0x20,0x97,0xEE,0x20,0xA9,0xEE,0xB0,0x64,0x20,0x85,0xEE,0x24,0xA3,0x10,0x0A,
+	0x20,0xA9,0xEE,0x90,0xFB,0x20,0xA9,0xEE,0xB0,0xFB,0x20,0xA9,0xEE,0x90,0xFB,0x20,
+	0x8E,0xEE,0xA9,0x08,0x85,0xA5,0xAD,0x00,0xDD,0xCD,0x00,0xDD,0xD0,0xF8,0x0A,0x90,
+	0x3F,0x66,0x95,0xB0,0x05,0x20,0xA0,0xEE,0xD0,0x03,0x20,0x97,0xEE,0x20,0x85,0xEE,
+	0xEA,0xEA,0xEA,0xEA,0xAD,0x00,0xDD,0x29,0xDF,0x09,0x10,0x8D,0x00,0xDD,0xC6,0xA5,
+	0xD0,0xD4,0xA9,0x04,0x8D,0x07,0xDC,0xA9,0x19,0x8D,0x0F,0xDC,0xAD,0x0D,0xDC,0xAD,
+	0x0D,0xDC,0x29,0x02,0xD0,0x0A,0x20,0xA9,0xEE,0xB0,0xF4,0x58,0x60,0xA9,0x80,0x2C,
+	0xA9,0x03,0x20,0x1C,0xFE,0x58,0x18,0x90,0x4A,0x85,0x95,0x20,0x36,0xED,0xAD,0x00,
+	0xDD,0x29,0xF7,0x8D,0x00,0xDD,0x60,0x85,0x95,0x20,0x36,0xED,0x78,0x20,0xA0,0xEE,
+	0x20,0xBE,0xED,0x20,0x85,0xEE,0x20,0xA9,0xEE,0x30,0xFB,0x58,0x60,0x24,0x94,0x30,
+	0x05,0x38,0x66,0x94,0xD0,0x05,0x48,0x20,0x40,0xED,0x68,0x85,0x95,0x18,0x60,0x78,
+	0x20,0x8E,0xEE,0xAD,0x00,0xDD,0x09,0x08,0x8D,0x00,0xDD,0xA9,0x5F,0x2C,0xA9,0x3F,
+	0x20,0x11,0xED,0x20,0xBE,0xED,0x8A,0xA2,0x0A,0xCA,0xD0,0xFD,0xAA,0x20,0x85,0xEE,
+	0x4C,0x97,0xEE,0x78,0xA9,0x00,0x85,0xA5,0x20,0x85,0xEE,0x20,0xA9,0xEE,0x10,0xFB,
+	0xA9,0x01,0x8D,0x07,0xDC,0xA9,0x19,0x8D,0x0F,0xDC,0x20,0x97,0xEE,0xAD,0x0D,0xDC,
+	0xAD,0x0D,0xDC,0x29,0x02,0xD0,0x07,0x20,0xA9,0xEE,0x30,0xF4,0x10,0x18,0xA5,0xA5,
+	0xF0,0x05,0xA9,0x02,0x4C,0xB2,0xED,0x20,0xA0,0xEE,0x20,0x85,0xEE,0xA9,0x40,0x20,
+	0x1C,0xFE,0xE6,0xA5,0xD0,0xCA,0xA9,0x08,0x85,0xA5,0xAD,0x00,0xDD,0xCD,0x00,0xDD,
+	0xD0,0xF8,0x0A,0x10,0xF5,0x66,0xA4,0xAD,0x00,0xDD,0xCD,0x00,0xDD,0xD0,0xF8,0x0A,
+	0x30,0xF5,0xC6,0xA5,0xD0,0xE4,0x20,0xA0,0xEE,0x24,0x90,0x50,0x03,0x20,0x06,0xEE,
+	0xA5,0xA4,0x58,0x18,0x60,0xAD,0x00,0xDD,0x29,0xEF,0x8D,0x00,0xDD,0x60,0xAD,0x00,
+	0xDD,0x09,0x10,0x8D,0x00,0xDD,0x60,0xAD,0x00,0xDD,0x29,0xDF,0x8D,0x00,0xDD,0x60,
+	0xAD,0x00,0xDD,0x09,0x20,0x8D,0x00,0xDD,0x60,0xAD,0x00,0xDD,0xCD,0x00,0xDD,0xD0,
+	0xF8,0x0A,0x60,0x8A,0xA2,0xB8,0xCA,0xD0,0xFD,0xAA,0x60,0xA5,0xB4,0xF0,0x47,0x30,
+	0x3F,0x46,0xB6,0xA2,0x00,0x90,0x01,0xCA,0x8A,0x45,0xBD,0x85,0xBD,0xC6,0xB4,0xF0,
+	0x06,0x8A,0x29,0x04,0x85,0xB5,0x60,0xA9,0x20,0x2C,0x94,0x02,0xF0,0x14,0x30,0x1C,
+	0x70,0x14,0xA5,0xBD,0xD0,0x01,0xCA,0xC6,0xB4,0xAD,0x93,0x02,0x10,0xE3,0xC6,0xB4,
+	0xD0,0xDF,0xE6,0xB4,0xD0,0xF0,0xA5,0xBD,0xF0,0xED,0xD0,0xEA,0x70,0xE9,0x50,0xE6,
+	0xE6,0xB4,0xA2,0xFF,0xD0,0xCB,0xAD,0x94,0x02,0x4A,0x90,0x07,0x2C,0x01,0xDD,0x10,
+	0x1D,0x50,0x1E,0xA9,0x00,0x85,0xBD,0x85,0xB5,0xAE,0x98,0x02,0x86,0xB4,0xAC,0x9D,
+	0x02,0xCC,0x9E,0x02,0xF0,0x13,0xB1,0xF9,0x85,0xB6,0xEE,0x9D,0x02,0x60,0xA9,0x40,
+	0x2C,0xA9,0x10,0x0D,0x97,0x02,0x8D,0x97,0x02,0xA9,0x01,0x8D,0x0D,0xDD,0x4D,0xA1,
+	0x02,0x09,0x80,0x8D,0xA1,0x02,0x8D,0x0D,0xDD,0x60,0xA2,0x09,0xA9,0x20,0x2C,0x93,
+	0x02,0xF0,0x01,0xCA,0x50,0x02,0xCA,0xCA,0x60,0xA6,0xA9,0xD0,0x33,0xC6,0xA8,0xF0,
+	0x36,0x30,0x0D,0xA5,0xA7,0x45,0xAB,0x85,0xAB,0x46,0xA7,0x66,0xAA,0x60,0xC6,0xA8,
+	0xA5,0xA7,0xF0,0x67,0xAD,0x93,0x02,0x0A,0xA9,0x01,0x65,0xA8,0xD0,0xEF,0xA9,0x90,
+	0x8D,0x0D,0xDD,0x0D,0xA1,0x02,0x8D,0xA1,0x02,0x85,0xA9,0xA9,0x02,0x4C,0x3B,0xEF,
+	0xA5,0xA7,0xD0,0xEA,0x85,0xA9,0x60,0xAC,0x9B,0x02,0xC8,0xCC,0x9C,0x02,0xF0,0x2A,
+	0x8C,0x9B,0x02,0x88,0xA5,0xAA,0xAE,0x98,0x02,0xE0,0x09,0xF0,0x04,0x4A,0xE8,0xD0,
+	0xF8,0x91,0xF7,0xA9,0x20,0x2C,0x94,0x02,0xF0,0xB4,0x30,0xB1,0xA5,0xA7,0x45,0xAB,
+	0xF0,0x03,0x70,0xA9,0x2C,0x50,0xA6,0xA9,0x01,0x2C,0xA9,0x04,0x2C,0xA9,0x80,0x2C,
+	0xA9,0x02,0x0D,0x97,0x02,0x8D,0x97,0x02,0x4C,0x7E,0xEF,0xA5,0xAA,0xD0,0xF1,0xF0,
+	0xEC,0x85,0x9A,0xAD,0x94,0x02,0x4A,0x90,0x29,0xA9,0x02,0x2C,0x01,0xDD,0x10,0x1D,
+	0xD0,0x20,0xAD,0xA1,0x02,0x29,0x02,0xD0,0xF9,0x2C,0x01,0xDD,0x70,0xFB,0xAD,0x01,
+	0xDD,0x09,0x02,0x8D,0x01,0xDD,0x2C,0x01,0xDD,0x70,0x07,0x30,0xF9,0xA9,0x40,0x8D,
+	0x97,0x02,0x18,0x60,0x20,0x28,0xF0,0xAC,0x9E,0x02,0xC8,0xCC,0x9D,0x02,0xF0,0xF4,
+	0x8C,0x9E,0x02,0x88,0xA5,0x9E,0x91,0xF9,0xAD,0xA1,0x02,0x4A,0xB0,0x1E,0xA9,0x10,
+	0x8D,0x0E,0xDD,0xAD,0x99,0x02,0x8D,0x04,0xDD,0xAD,0x9A,0x02,0x8D,0x05,0xDD,0xA9,
+	0x81,0x20,0x3B,0xEF,0x20,0x06,0xEF,0xA9,0x11,0x8D,0x0E,0xDD,0x60,0x85,0x99,0xAD,
+	0x94,0x02,0x4A,0x90,0x28,0x29,0x08,0xF0,0x24,0xA9,0x02,0x2C,0x01,0xDD,0x10,0xAD,
+	0xF0,0x22,0xAD,0xA1,0x02,0x4A,0xB0,0xFA,0xAD,0x01,0xDD,0x29,0xFD,0x8D,0x01,0xDD,
+	0xAD,0x01,0xDD,0x29,0x04,0xF0,0xF9,0xA9,0x90,0x18,0x4C,0x3B,0xEF,0xAD,0xA1,0x02,
+	0x29,0x12,0xF0,0xF3,0x18,0x60,0xAD,0x97,0x02,0xAC,0x9C,0x02,0xCC,0x9B,0x02,0xF0,
+	0x0B,0x29,0xF7,0x8D,0x97,0x02,0xB1,0xF7,0xEE,0x9C,0x02,0x60,0x09,0x08,0x8D,0x97,
+	0x02,0xA9,0x00,0x60,0x48,0xAD,0xA1,0x02,0xF0,0x11,0xAD,0xA1,0x02,0x29,0x03,0xD0,
+	0xF9,0xA9,0x10,0x8D,0x0D,0xDD,0xA9,0x00,0x8D,0xA1,0x02,0x68,0x60,0x0D,0x49,0x2F,
+	0x4F,0x20,0x45,0x52,0x52,0x4F,0x52,0x20,0xA3,0x0D,0x53,0x45,0x41,0x52,0x43,0x48,
+	0x49,0x4E,0x47,0xA0,0x46,0x4F,0x52,0xA0,0x0D,0x50,0x52,0x45,0x53,0x53,0x20,0x50,
+	0x4C,0x41,0x59,0x20,0x4F,0x4E,0x20,0x54,0x41,0x50,0xC5,0x50,0x52,0x45,0x53,0x53,
+	0x20,0x52,0x45,0x43,0x4F,0x52,0x44,0x20,0x26,0x20,0x50,0x4C,0x41,0x59,0x20,0x4F,
+	0x4E,0x20,0x54,0x41,0x50,0xC5,0x0D,0x4C,0x4F,0x41,0x44,0x49,0x4E,0xC7,0x0D,0x53,
+	0x41,0x56,0x49,0x4E,0x47,0xA0,0x0D,0x56,0x45,0x52,0x49,0x46,0x59,0x49,0x4E,0xC7,
+	0x0D,0x46,0x4F,0x55,0x4E,0x44,0xA0,0x0D,0x4F,0x4B,0x8D,0x24,0x9D,0x10,0x0D,0xB9,
+	0xBD,0xF0,0x08,0x29,0x7F,0x20,0xD2,0xFF,0xC8,0x28,0x10,0xF3,0x18,0x60,0xA5,0x99,
+	0xD0,0x08,0xA5,0xC6,0xF0,0x0F,0x78,0x4C,0xB4,0xE5,0xC9,0x02,0xD0,0x18,0x84,0x97,
+	0x20,0x86,0xF0,0xA4,0x97,0x18,0x60,0xA5,0x99,0xD0,0x0B,0xA5,0xD3,0x85,0xCA,0xA5,
+	0xD6,0x85,0xC9,0x4C,0x32,0xE6,0xC9,0x03,0xD0,0x09,0x85,0xD0,0xA5,0xD5,0x85,0xC8,
+	0x4C,0x32,0xE6,0xB0,0x38,0xC9,0x02,0xF0,0x3F,0x86,0x97,0x20,0x99,0xF1,0xB0,0x16,
+	0x48,0x20,0x99,0xF1,0xB0,0x0D,0xD0,0x05,0xA9,0x40,0x20,0x1C,0xFE,0xC6,0xA6,0xA6,
+	0x97,0x68,0x60,0xAA,0x68,0x8A,0xA6,0x97,0x60,0x20,0x0D,0xF8,0xD0,0x0B,0x20,0x41,
+	0xF8,0xB0,0x11,0xA9,0x00,0x85,0xA6,0xF0,0xF0,0xB1,0xB2,0x18,0x60,0xA5,0x90,0xF0,
+	0x04,0xA9,0x0D,0x18,0x60,0x4C,0x13,0xEE,0x20,0x4E,0xF1,0xB0,0xF7,0xC9,0x00,0xD0,
+	0xF2,0xAD,0x97,0x02,0x29,0x60,0xD0,0xE9,0xF0,0xEE,0x48,0xA5,0x9A,0xC9,0x03,0xD0,
+	0x04,0x68,0x4C,0x16,0xE7,0x90,0x04,0x68,0x4C,0xDD,0xED,0x4A,0x68,0x85,0x9E,0x8A,
+	0x48,0x98,0x48,0x90,0x23,0x20,0x0D,0xF8,0xD0,0x0E,0x20,0x64,0xF8,0xB0,0x0E,0xA9,
+	0x02,0xA0,0x00,0x91,0xB2,0xC8,0x84,0xA6,0xA5,0x9E,0x91,0xB2,0x18,0x68,0xA8,0x68,
+	0xAA,0xA5,0x9E,0x90,0x02,0xA9,0x00,0x60,0x20,0x17,0xF0,0x4C,0xFC,0xF1,0x20,0x0F,
+	0xF3,0xF0,0x03,0x4C,0x01,0xF7,0x20,0x1F,0xF3,0xA5,0xBA,0xF0,0x16,0xC9,0x03,0xF0,
+	0x12,0xB0,0x14,0xC9,0x02,0xD0,0x03,0x4C,0x4D,0xF0,0xA6,0xB9,0xE0,0x60,0xF0,0x03,
+	0x4C,0x0A,0xF7,0x85,0x99,0x18,0x60,0xAA,0x20,0x09,0xED,0xA5,0xB9,0x10,0x06,0x20,
+	0xCC,0xED,0x4C,0x48,0xF2,0x20,0xC7,0xED,0x8A,0x24,0x90,0x10,0xE6,0x4C,0x07,0xF7,
+	0x20,0x0F,0xF3,0xF0,0x03,0x4C,0x01,0xF7,0x20,0x1F,0xF3,0xA5,0xBA,0xD0,0x03,0x4C,
+	0x0D,0xF7,0xC9,0x03,0xF0,0x0F,0xB0,0x11,0xC9,0x02,0xD0,0x03,0x4C,0xE1,0xEF,0xA6,
+	0xB9,0xE0,0x60,0xF0,0xEA,0x85,0x9A,0x18,0x60,0xAA,0x20,0x0C,0xED,0xA5,0xB9,0x10,
+	0x05,0x20,0xBE,0xED,0xD0,0x03,0x20,0xB9,0xED,0x8A,0x24,0x90,0x10,0xE7,0x4C,0x07,
+	0xF7,0x20,0x14,0xF3,0xF0,0x02,0x18,0x60,0x20,0x1F,0xF3,0x8A,0x48,0xA5,0xBA,0xF0,
+	0x50,0xC9,0x03,0xF0,0x4C,0xB0,0x47,0xC9,0x02,0xD0,0x1D,0x68,0x20,0xF2,0xF2,0x20,
+	0x83,0xF4,0x20,0x27,0xFE,0xA5,0xF8,0xF0,0x01,0xC8,0xA5,0xFA,0xF0,0x01,0xC8,0xA9,
+	0x00,0x85,0xF8,0x85,0xFA,0x4C,0x7D,0xF4,0xA5,0xB9,0x29,0x0F,0xF0,0x23,0x20,0xD0,
+	0xF7,0xA9,0x00,0x38,0x20,0xDD,0xF1,0x20,0x64,0xF8,0x90,0x04,0x68,0xA9,0x00,0x60,
+	0xA5,0xB9,0xC9,0x62,0xD0,0x0B,0xA9,0x05,0x20,0x6A,0xF7,0x4C,0xF1,0xF2,0x20,0x42,
+	0xF6,0x68,0xAA,0xC6,0x98,0xE4,0x98,0xF0,0x14,0xA4,0x98,0xB9,0x59,0x02,0x9D,0x59,
+	0x02,0xB9,0x63,0x02,0x9D,0x63,0x02,0xB9,0x6D,0x02,0x9D,0x6D,0x02,0x18,0x60,0xA9,
+	0x00,0x85,0x90,0x8A,0xA6,0x98,0xCA,0x30,0x15,0xDD,0x59,0x02,0xD0,0xF8,0x60,0xBD,
+	0x59,0x02,0x85,0xB8,0xBD,0x63,0x02,0x85,0xBA,0xBD,0x6D,0x02,0x85,0xB9,0x60,0xA9,
+	0x00,0x85,0x98,0xA2,0x03,0xE4,0x9A,0xB0,0x03,0x20,0xFE,0xED,0xE4,0x99,0xB0,0x03,
+	0x20,0xEF,0xED,0x86,0x9A,0xA9,0x00,0x85,0x99,0x60,0xA6,0xB8,0xD0,0x03,0x4C,0x0A,
+	0xF7,0x20,0x0F,0xF3,0xD0,0x03,0x4C,0xFE,0xF6,0xA6,0x98,0xE0,0x0A,0x90,0x03,0x4C,
+	0xFB,0xF6,0xE6,0x98,0xA5,0xB8,0x9D,0x59,0x02,0xA5,0xB9,0x09,0x60,0x85,0xB9,0x9D,
+	0x6D,0x02,0xA5,0xBA,0x9D,0x63,0x02,0xF0,0x5A,0xC9,0x03,0xF0,0x56,0x90,0x05,0x20,
+	0xD5,0xF3,0x90,0x4F,0xC9,0x02,0xD0,0x03,0x4C,0x09,0xF4,0x20,0xD0,0xF7,0xB0,0x03,
+	0x4C,0x13,0xF7,0xA5,0xB9,0x29,0x0F,0xD0,0x1F,0x20,0x17,0xF8,0xB0,0x36,0x20,0xAF,
+	0xF5,0xA5,0xB7,0xF0,0x0A,0x20,0xEA,0xF7,0x90,0x18,0xF0,0x28,0x4C,0x04,0xF7,0x20,
+	0x2C,0xF7,0xF0,0x20,0x90,0x0C,0xB0,0xF4,0x20,0x38,0xF8,0xB0,0x17,0xA9,0x04,0x20,
+	0x6A,0xF7,0xA9,0xBF,0xA4,0xB9,0xC0,0x60,0xF0,0x07,0xA0,0x00,0xA9,0x02,0x91,0xB2,
+	0x98,0x85,0xA6,0x18,0x60,0xA5,0xB9,0x30,0xFA,0xA4,0xB7,0xF0,0xF6,0xA9,0x00,0x85,
+	0x90,0xA5,0xBA,0x20,0x0C,0xED,0xA5,0xB9,0x09,0xF0,0x20,0xB9,0xED,0xA5,0x90,0x10,
+	0x05,0x68,0x68,0x4C,0x07,0xF7,0xA5,0xB7,0xF0,0x0C,0xA0,0x00,0xB1,0xBB,0x20,0xDD,
+	0xED,0xC8,0xC4,0xB7,0xD0,0xF6,0x4C,0x54,0xF6,0x20,0x83,0xF4,0x8C,0x97,0x02,0xC4,
+	0xB7,0xF0,0x0A,0xB1,0xBB,0x99,0x93,0x02,0xC8,0xC0,0x04,0xD0,0xF2,0x20,0x4A,0xEF,
+	0x8E,0x98,0x02,0xAD,0x93,0x02,0x29,0x0F,0xF0,0x1C,0x0A,0xAA,0xAD,0xA6,0x02,0xD0,
+	0x09,0xBC,0xC1,0xFE,0xBD,0xC0,0xFE,0x4C,0x40,0xF4,0xBC,0xEB,0xE4,0xBD,0xEA,0xE4,
+	0x8C,0x96,0x02,0x8D,0x95,0x02,0xAD,0x95,0x02,0x0A,0x20,0x2E,0xFF,0xAD,0x94,0x02,
+	0x4A,0x90,0x09,0xAD,0x01,0xDD,0x0A,0xB0,0x03,0x20,0x0D,0xF0,0xAD,0x9B,0x02,0x8D,
+	0x9C,0x02,0xAD,0x9E,0x02,0x8D,0x9D,0x02,0x20,0x27,0xFE,0xA5,0xF8,0xD0,0x05,0x88,
+	0x84,0xF8,0x86,0xF7,0xA5,0xFA,0xD0,0x05,0x88,0x84,0xFA,0x86,0xF9,0x38,0xA9,0xF0,
+	0x4C,0x2D,0xFE,0xA9,0x7F,0x8D,0x0D,0xDD,0xA9,0x06,0x8D,0x03,0xDD,0x8D,0x01,0xDD,
+	0xA9,0x04,0x0D,0x00,0xDD,0x8D,0x00,0xDD,0xA0,0x00,0x8C,0xA1,0x02,0x60,0x86,0xC3,
+	0x84,0xC4,0x6C,0x30,0x03,0x85,0x93,0xA9,0x00,0x85,0x90,0xA5,0xBA,0xD0,0x03,0x4C,
+	0x13,0xF7,0xC9,0x03,0xF0,0xF9,0x90,0x7B,0xA4,0xB7,0xD0,0x03,0x4C,0x10,0xF7,0xA6,
+	0xB9,0x20,0xAF,0xF5,0xA9,0x60,0x85,0xB9,0x20,0xD5,0xF3,0xA5,0xBA,0x20,0x09,0xED,
+	0xA5,0xB9,0x20,0xC7,0xED,0x20,0x13,0xEE,0x85,0xAE,0xA5,0x90,0x4A,0x4A,0xB0,0x50,
+	0x20,0x13,0xEE,0x85,0xAF,0x8A,0xD0,0x08,0xA5,0xC3,0x85,0xAE,0xA5,0xC4,0x85,0xAF,
+	0x20,0xD2,0xF5,0xA9,0xFD,0x25,0x90,0x85,0x90,0x20,0xE1,0xFF,0xD0,0x03,0x4C,0x33,
+	0xF6,0x20,0x13,0xEE,0xAA,0xA5,0x90,0x4A,0x4A,0xB0,0xE8,0x8A,0xA4,0x93,0xF0,0x0C,
+	0xA0,0x00,0xD1,0xAE,0xF0,0x08,0xA9,0x10,0x20,0x1C,0xFE,0x2C,0x91,0xAE,0xE6,0xAE,
+	0xD0,0x02,0xE6,0xAF,0x24,0x90,0x50,0xCB,0x20,0xEF,0xED,0x20,0x42,0xF6,0x90,0x79,
+	0x4C,0x04,0xF7,0x4A,0xB0,0x03,0x4C,0x13,0xF7,0x20,0xD0,0xF7,0xB0,0x03,0x4C,0x13,
+	0xF7,0x20,0x17,0xF8,0xB0,0x68,0x20,0xAF,0xF5,0xA5,0xB7,0xF0,0x09,0x20,0xEA,0xF7,
+	0x90,0x0B,0xF0,0x5A,0xB0,0xDA,0x20,0x2C,0xF7,0xF0,0x53,0xB0,0xD3,0xA5,0x90,0x29,
+	0x10,0x38,0xD0,0x4A,0xE0,0x01,0xF0,0x11,0xE0,0x03,0xD0,0xDD,0xA0,0x01,0xB1,0xB2,
+	0x85,0xC3,0xC8,0xB1,0xB2,0x85,0xC4,0xB0,0x04,0xA5,0xB9,0xD0,0xEF,0xA0,0x03,0xB1,
+	0xB2,0xA0,0x01,0xF1,0xB2,0xAA,0xA0,0x04,0xB1,0xB2,0xA0,0x02,0xF1,0xB2,0xA8,0x18,
+	0x8A,0x65,0xC3,0x85,0xAE,0x98,0x65,0xC4,0x85,0xAF,0xA5,0xC3,0x85,0xC1,0xA5,0xC4,
+	0x85,0xC2,0x20,0xD2,0xF5,0x20,0x4A,0xF8,0x24,0x18,0xA6,0xAE,0xA4,0xAF,0x60,0xA5,
+	0x9D,0x10,0x1E,0xA0,0x0C,0x20,0x2F,0xF1,0xA5,0xB7,0xF0,0x15,0xA0,0x17,0x20,0x2F,
+	0xF1,0xA4,0xB7,0xF0,0x0C,0xA0,0x00,0xB1,0xBB,0x20,0xD2,0xFF,0xC8,0xC4,0xB7,0xD0,
+	0xF6,0x60,0xA0,0x49,0xA5,0x93,0xF0,0x02,0xA0,0x59,0x4C,0x2B,0xF1,0x86,0xAE,0x84,
+	0xAF,0xAA,0xB5,0x00,0x85,0xC1,0xB5,0x01,0x85,0xC2,0x6C,0x32,0x03,0xA5,0xBA,0xD0,
+	0x03,0x4C,0x13,0xF7,0xC9,0x03,0xF0,0xF9,0x90,0x5F,0xA9,0x61,0x85,0xB9,0xA4,0xB7,
+	0xD0,0x03,0x4C,0x10,0xF7,0x20,0xD5,0xF3,0x20,0x8F,0xF6,0xA5,0xBA,0x20,0x0C,0xED,
+	0xA5,0xB9,0x20,0xB9,0xED,0xA0,0x00,0x20,0x8E,0xFB,0xA5,0xAC,0x20,0xDD,0xED,0xA5,
+	0xAD,0x20,0xDD,0xED,0x20,0xD1,0xFC,0xB0,0x16,0xB1,0xAC,0x20,0xDD,0xED,0x20,0xE1,
+	0xFF,0xD0,0x07,0x20,0x42,0xF6,0xA9,0x00,0x38,0x60,0x20,0xDB,0xFC,0xD0,0xE5,0x20,
+	0xFE,0xED,0x24,0xB9,0x30,0x11,0xA5,0xBA,0x20,0x0C,0xED,0xA5,0xB9,0x29,0xEF,0x09,
+	0xE0,0x20,0xB9,0xED,0x20,0xFE,0xED,0x18,0x60,0x4A,0xB0,0x03,0x4C,0x13,0xF7,0x20,
+	0xD0,0xF7,0x90,0x8D,0x20,0x38,0xF8,0xB0,0x25,0x20,0x8F,0xF6,0xA2,0x03,0xA5,0xB9,
+	0x29,0x01,0xD0,0x02,0xA2,0x01,0x8A,0x20,0x6A,0xF7,0xB0,0x12,0x20,0x67,0xF8,0xB0,
+	0x0D,0xA5,0xB9,0x29,0x02,0xF0,0x06,0xA9,0x05,0x20,0x6A,0xF7,0x24,0x18,0x60,0xA5,
+	0x9D,0x10,0xFB,0xA0,0x51,0x20,0x2F,0xF1,0x4C,0xC1,0xF5,0xA2,0x00,0xE6,0xA2,0xD0,
+	0x06,0xE6,0xA1,0xD0,0x02,0xE6,0xA0,0x38,0xA5,0xA2,0xE9,0x01,0xA5,0xA1,0xE9,0x1A,
+	0xA5,0xA0,0xE9,0x4F,0x90,0x06,0x86,0xA0,0x86,0xA1,0x86,0xA2,0xAD,0x01,0xDC,0xCD,
+	0x01,0xDC,0xD0,0xF8,0xAA,0x30,0x13,0xA2,0xBD,0x8E,0x00,0xDC,0xAE,0x01,0xDC,0xEC,
+	0x01,0xDC,0xD0,0xF8,0x8D,0x00,0xDC,0xE8,0xD0,0x02,0x85,0x91,0x60,0x78,0xA5,0xA2,
+	0xA6,0xA1,0xA4,0xA0,0x78,0x85,0xA2,0x86,0xA1,0x84,0xA0,0x58,0x60,0xA5,0x91,0xC9,
+	0x7F,0xD0,0x07,0x08,0x20,0xCC,0xFF,0x85,0xC6,0x28,0x60,0xA9,0x01,0x2C,0xA9,0x02,
+	0x2C,0xA9,0x03,0x2C,0xA9,0x04,0x2C,0xA9,0x05,0x2C,0xA9,0x06,0x2C,0xA9,0x07,0x2C,
+	0xA9,0x08,0x2C,0xA9,0x09,0x48,0x20,0xCC,0xFF,0xA0,0x00,0x24,0x9D,0x50,0x0A,0x20,
+	0x2F,0xF1,0x68,0x48,0x09,0x30,0x20,0xD2,0xFF,0x68,0x38,0x60,0xA5,0x93,0x48,0x20,
+	0x41,0xF8,0x68,0x85,0x93,0xB0,0x32,0xA0,0x00,0xB1,0xB2,0xC9,0x05,0xF0,0x2A,0xC9,
+	0x01,0xF0,0x08,0xC9,0x03,0xF0,0x04,0xC9,0x04,0xD0,0xE1,0xAA,0x24,0x9D,0x10,0x17,
+	0xA0,0x63,0x20,0x2F,0xF1,0xA0,0x05,0xB1,0xB2,0x20,0xD2,0xFF,0xC8,0xC0,0x15,0xD0,
+	0xF6,0xA5,0xA1,0x20,0xE0,0xE4,0xEA,0x18,0x88,0x60,0x85,0x9E,0x20,0xD0,0xF7,0x90,
+	0x5E,0xA5,0xC2,0x48,0xA5,0xC1,0x48,0xA5,0xAF,0x48,0xA5,0xAE,0x48,0xA0,0xBF,0xA9,
+	0x20,0x91,0xB2,0x88,0xD0,0xFB,0xA5,0x9E,0x91,0xB2,0xC8,0xA5,0xC1,0x91,0xB2,0xC8,
+	0xA5,0xC2,0x91,0xB2,0xC8,0xA5,0xAE,0x91,0xB2,0xC8,0xA5,0xAF,0x91,0xB2,0xC8,0x84,
+	0x9F,0xA0,0x00,0x84,0x9E,0xA4,0x9E,0xC4,0xB7,0xF0,0x0C,0xB1,0xBB,0xA4,0x9F,0x91,
+	0xB2,0xE6,0x9E,0xE6,0x9F,0xD0,0xEE,0x20,0xD7,0xF7,0xA9,0x69,0x85,0xAB,0x20,0x6B,
+	0xF8,0xA8,0x68,0x85,0xAE,0x68,0x85,0xAF,0x68,0x85,0xC1,0x68,0x85,0xC2,0x98,0x60,
+	0xA6,0xB2,0xA4,0xB3,0xC0,0x02,0x60,0x20,0xD0,0xF7,0x8A,0x85,0xC1,0x18,0x69,0xC0,
+	0x85,0xAE,0x98,0x85,0xC2,0x69,0x00,0x85,0xAF,0x60,0x20,0x2C,0xF7,0xB0,0x1D,0xA0,
+	0x05,0x84,0x9F,0xA0,0x00,0x84,0x9E,0xC4,0xB7,0xF0,0x10,0xB1,0xBB,0xA4,0x9F,0xD1,
+	0xB2,0xD0,0xE7,0xE6,0x9E,0xE6,0x9F,0xA4,0x9E,0xD0,0xEC,0x18,0x60,0x20,0xD0,0xF7,
+	0xE6,0xA6,0xA4,0xA6,0xC0,0xC0,0x60,0x20,0x2E,0xF8,0xF0,0x1A,0xA0,0x1B,0x20,0x2F,
+	0xF1,0x20,0xD0,0xF8,0x20,0x2E,0xF8,0xD0,0xF8,0xA0,0x6A,0x4C,0x2F,0xF1,0xA9,0x10,
+	0x24,0x01,0xD0,0x02,0x24,0x01,0x18,0x60,0x20,0x2E,0xF8,0xF0,0xF9,0xA0,0x2E,0xD0,
+	0xDD,0xA9,0x00,0x85,0x90,0x85,0x93,0x20,0xD7,0xF7,0x20,0x17,0xF8,0xB0,0x1F,0x78,
+	0xA9,0x00,0x85,0xAA,0x85,0xB4,0x85,0xB0,0x85,0x9E,0x85,0x9F,0x85,0x9C,0xA9,0x90,
+	0xA2,0x0E,0xD0,0x11,0x20,0xD7,0xF7,0xA9,0x14,0x85,0xAB,0x20,0x38,0xF8,0xB0,0x6C,
+	0x78,0xA9,0x82,0xA2,0x08,0xA0,0x7F,0x8C,0x0D,0xDC,0x8D,0x0D,0xDC,0xAD,0x0E,0xDC,
+	0x09,0x19,0x8D,0x0F,0xDC,0x29,0x91,0x8D,0xA2,0x02,0x20,0xA4,0xF0,0xAD,0x11,0xD0,
+	0x29,0xEF,0x8D,0x11,0xD0,0xAD,0x14,0x03,0x8D,0x9F,0x02,0xAD,0x15,0x03,0x8D,0xA0,
+	0x02,0x20,0xBD,0xFC,0xA9,0x02,0x85,0xBE,0x20,0x97,0xFB,0xA5,0x01,0x29,0x1F,0x85,
+	0x01,0x85,0xC0,0xA2,0xFF,0xA0,0xFF,0x88,0xD0,0xFD,0xCA,0xD0,0xF8,0x58,0xAD,0xA0,
+	0x02,0xCD,0x15,0x03,0x18,0xF0,0x15,0x20,0xD0,0xF8,0x20,0xBC,0xF6,0x4C,0xBE,0xF8,
+	0x20,0xE1,0xFF,0x18,0xD0,0x0B,0x20,0x93,0xFC,0x38,0x68,0x68,0xA9,0x00,0x8D,0xA0,
+	0x02,0x60,0x86,0xB1,0xA5,0xB0,0x0A,0x0A,0x18,0x65,0xB0,0x18,0x65,0xB1,0x85,0xB1,
+	0xA9,0x00,0x24,0xB0,0x30,0x01,0x2A,0x06,0xB1,0x2A,0x06,0xB1,0x2A,0xAA,0xAD,0x06,
+	0xDC,0xC9,0x16,0x90,0xF9,0x65,0xB1,0x8D,0x04,0xDC,0x8A,0x6D,0x07,0xDC,0x8D,0x05,
+	0xDC,0xAD,0xA2,0x02,0x8D,0x0E,0xDC,0x8D,0xA4,0x02,0xAD,0x0D,0xDC,0x29,0x10,0xF0,
+	0x09,0xA9,0xF9,0x48,0xA9,0x2A,0x48,0x4C,0x43,0xFF,0x58,0x60,0xAE,0x07,0xDC,0xA0,
+	0xFF,0x98,0xED,0x06,0xDC,0xEC,0x07,0xDC,0xD0,0xF2,0x86,0xB1,0xAA,0x8C,0x06,0xDC,
+	0x8C,0x07,0xDC,0xA9,0x19,0x8D,0x0F,0xDC,0xAD,0x0D,0xDC,0x8D,0xA3,0x02,0x98,0xE5,
+	0xB1,0x86,0xB1,0x4A,0x66,0xB1,0x4A,0x66,0xB1,0xA5,0xB0,0x18,0x69,0x3C,0xC5,0xB1,
+	0xB0,0x4A,0xA6,0x9C,0xF0,0x03,0x4C,0x60,0xFA,0xA6,0xA3,0x30,0x1B,0xA2,0x00,0x69,
+	0x30,0x65,0xB0,0xC5,0xB1,0xB0,0x1C,0xE8,0x69,0x26,0x65,0xB0,0xC5,0xB1,0xB0,0x17,
+	0x69,0x2C,0x65,0xB0,0xC5,0xB1,0x90,0x03,0x4C,0x10,0xFA,0xA5,0xB4,0xF0,0x1D,0x85,
+	0xA8,0xD0,0x19,0xE6,0xA9,0xB0,0x02,0xC6,0xA9,0x38,0xE9,0x13,0xE5,0xB1,0x65,0x92,
+	0x85,0x92,0xA5,0xA4,0x49,0x01,0x85,0xA4,0xF0,0x2B,0x86,0xD7,0xA5,0xB4,0xF0,0x22,
+	0xAD,0xA3,0x02,0x29,0x01,0xD0,0x05,0xAD,0xA4,0x02,0xD0,0x16,0xA9,0x00,0x85,0xA4,
+	0x8D,0xA4,0x02,0xA5,0xA3,0x10,0x30,0x30,0xBF,0xA2,0xA6,0x20,0xE2,0xF8,0xA5,0x9B,
+	0xD0,0xB9,0x4C,0xBC,0xFE,0xA5,0x92,0xF0,0x07,0x30,0x03,0xC6,0xB0,0x2C,0xE6,0xB0,
+	0xA9,0x00,0x85,0x92,0xE4,0xD7,0xD0,0x0F,0x8A,0xD0,0xA0,0xA5,0xA9,0x30,0xBD,0xC9,
+	0x10,0x90,0xB9,0x85,0x96,0xB0,0xB5,0x8A,0x45,0x9B,0x85,0x9B,0xA5,0xB4,0xF0,0xD2,
+	0xC6,0xA3,0x30,0xC5,0x46,0xD7,0x66,0xBF,0xA2,0xDA,0x20,0xE2,0xF8,0x4C,0xBC,0xFE,
+	0xA5,0x96,0xF0,0x04,0xA5,0xB4,0xF0,0x07,0xA5,0xA3,0x30,0x03,0x4C,0x97,0xF9,0x46,
+	0xB1,0xA9,0x93,0x38,0xE5,0xB1,0x65,0xB0,0x0A,0xAA,0x20,0xE2,0xF8,0xE6,0x9C,0xA5,
+	0xB4,0xD0,0x11,0xA5,0x96,0xF0,0x26,0x85,0xA8,0xA9,0x00,0x85,0x96,0xA9,0x81,0x8D,
+	0x0D,0xDC,0x85,0xB4,0xA5,0x96,0x85,0xB5,0xF0,0x09,0xA9,0x00,0x85,0xB4,0xA9,0x01,
+	0x8D,0x0D,0xDC,0xA5,0xBF,0x85,0xBD,0xA5,0xA8,0x05,0xA9,0x85,0xB6,0x4C,0xBC,0xFE,
+	0x20,0x97,0xFB,0x85,0x9C,0xA2,0xDA,0x20,0xE2,0xF8,0xA5,0xBE,0xF0,0x02,0x85,0xA7,
+	0xA9,0x0F,0x24,0xAA,0x10,0x17,0xA5,0xB5,0xD0,0x0C,0xA6,0xBE,0xCA,0xD0,0x0B,0xA9,
+	0x08,0x20,0x1C,0xFE,0xD0,0x04,0xA9,0x00,0x85,0xAA,0x4C,0xBC,0xFE,0x70,0x31,0xD0,
+	0x18,0xA5,0xB5,0xD0,0xF5,0xA5,0xB6,0xD0,0xF1,0xA5,0xA7,0x4A,0xA5,0xBD,0x30,0x03,
+	0x90,0x18,0x18,0xB0,0x15,0x29,0x0F,0x85,0xAA,0xC6,0xAA,0xD0,0xDD,0xA9,0x40,0x85,
+	0xAA,0x20,0x8E,0xFB,0xA9,0x00,0x85,0xAB,0xF0,0xD0,0xA9,0x80,0x85,0xAA,0xD0,0xCA,
+	0xA5,0xB5,0xF0,0x0A,0xA9,0x04,0x20,0x1C,0xFE,0xA9,0x00,0x4C,0x4A,0xFB,0x20,0xD1,
+	0xFC,0x90,0x03,0x4C,0x48,0xFB,0xA6,0xA7,0xCA,0xF0,0x2D,0xA5,0x93,0xF0,0x0C,0xA0,
+	0x00,0xA5,0xBD,0xD1,0xAC,0xF0,0x04,0xA9,0x01,0x85,0xB6,0xA5,0xB6,0xF0,0x4B,0xA2,
+	0x3D,0xE4,0x9E,0x90,0x3E,0xA6,0x9E,0xA5,0xAD,0x9D,0x01,0x01,0xA5,0xAC,0x9D,0x00,
+	0x01,0xE8,0xE8,0x86,0x9E,0x4C,0x3A,0xFB,0xA6,0x9F,0xE4,0x9E,0xF0,0x35,0xA5,0xAC,
+	0xDD,0x00,0x01,0xD0,0x2E,0xA5,0xAD,0xDD,0x01,0x01,0xD0,0x27,0xE6,0x9F,0xE6,0x9F,
+	0xA5,0x93,0xF0,0x0B,0xA5,0xBD,0xA0,0x00,0xD1,0xAC,0xF0,0x17,0xC8,0x84,0xB6,0xA5,
+	0xB6,0xF0,0x07,0xA9,0x10,0x20,0x1C,0xFE,0xD0,0x09,0xA5,0x93,0xD0,0x05,0xA8,0xA5,
+	0xBD,0x91,0xAC,0x20,0xDB,0xFC,0xD0,0x43,0xA9,0x80,0x85,0xAA,0x78,0xA2,0x01,0x8E,
+	0x0D,0xDC,0xAE,0x0D,0xDC,0xA6,0xBE,0xCA,0x30,0x02,0x86,0xBE,0xC6,0xA7,0xF0,0x08,
+	0xA5,0x9E,0xD0,0x27,0x85,0xBE,0xF0,0x23,0x20,0x93,0xFC,0x20,0x8E,0xFB,0xA0,0x00,
+	0x84,0xAB,0xB1,0xAC,0x45,0xAB,0x85,0xAB,0x20,0xDB,0xFC,0x20,0xD1,0xFC,0x90,0xF2,
+	0xA5,0xAB,0x45,0xBD,0xF0,0x05,0xA9,0x20,0x20,0x1C,0xFE,0x4C,0xBC,0xFE,0xA5,0xC2,
+	0x85,0xAD,0xA5,0xC1,0x85,0xAC,0x60,0xA9,0x08,0x85,0xA3,0xA9,0x00,0x85,0xA4,0x85,
+	0xA8,0x85,0x9B,0x85,0xA9,0x60,0xA5,0xBD,0x4A,0xA9,0x60,0x90,0x02,0xA9,0xB0,0xA2,
+	0x00,0x8D,0x06,0xDC,0x8E,0x07,0xDC,0xAD,0x0D,0xDC,0xA9,0x19,0x8D,0x0F,0xDC,0xA5,
+	0x01,0x49,0x08,0x85,0x01,0x29,0x08,0x60,0x38,0x66,0xB6,0x30,0x3C,0xA5,0xA8,0xD0,
+	0x12,0xA9,0x10,0xA2,0x01,0x20,0xB1,0xFB,0xD0,0x2F,0xE6,0xA8,0xA5,0xB6,0x10,0x29,
+	0x4C,0x57,0xFC,0xA5,0xA9,0xD0,0x09,0x20,0xAD,0xFB,0xD0,0x1D,0xE6,0xA9,0xD0,0x19,
+	0x20,0xA6,0xFB,0xD0,0x14,0xA5,0xA4,0x49,0x01,0x85,0xA4,0xF0,0x0F,0xA5,0xBD,0x49,
+	0x01,0x85,0xBD,0x29,0x01,0x45,0x9B,0x85,0x9B,0x4C,0xBC,0xFE,0x46,0xBD,0xC6,0xA3,
+	0xA5,0xA3,0xF0,0x3A,0x10,0xF3,0x20,0x97,0xFB,0x58,0xA5,0xA5,0xF0,0x12,0xA2,0x00,
+	0x86,0xD7,0xC6,0xA5,0xA6,0xBE,0xE0,0x02,0xD0,0x02,0x09,0x80,0x85,0xBD,0xD0,0xD9,
+	0x20,0xD1,0xFC,0x90,0x0A,0xD0,0x91,0xE6,0xAD,0xA5,0xD7,0x85,0xBD,0xB0,0xCA,0xA0,
+	0x00,0xB1,0xAC,0x85,0xBD,0x45,0xD7,0x85,0xD7,0x20,0xDB,0xFC,0xD0,0xBB,0xA5,0x9B,
+	0x49,0x01,0x85,0xBD,0x4C,0xBC,0xFE,0xC6,0xBE,0xD0,0x03,0x20,0xCA,0xFC,0xA9,0x50,
+	0x85,0xA7,0xA2,0x08,0x78,0x20,0xBD,0xFC,0xD0,0xEA,0xA9,0x78,0x20,0xAF,0xFB,0xD0,
+	0xE3,0xC6,0xA7,0xD0,0xDF,0x20,0x97,0xFB,0xC6,0xAB,0x10,0xD8,0xA2,0x0A,0x20,0xBD,
+	0xFC,0x58,0xE6,0xAB,0xA5,0xBE,0xF0,0x30,0x20,0x8E,0xFB,0xA2,0x09,0x86,0xA5,0x86,
+	0xB6,0xD0,0x83,0x08,0x78,0xAD,0x11,0xD0,0x09,0x10,0x8D,0x11,0xD0,0x20,0xCA,0xFC,
+	0xA9,0x7F,0x8D,0x0D,0xDC,0x20,0xDD,0xFD,0xAD,0xA0,0x02,0xF0,0x09,0x8D,0x15,0x03,
+	0xAD,0x9F,0x02,0x8D,0x14,0x03,0x28,0x60,0x20,0x93,0xFC,0xF0,0x97,0xBD,0x93,0xFD,
+	0x8D,0x14,0x03,0xBD,0x94,0xFD,0x8D,0x15,0x03,0x60,0xA5,0x01,0x09,0x20,0x85,0x01,
+	0x60,0x38,0xA5,0xAC,0xE5,0xAE,0xA5,0xAD,0xE5,0xAF,0x60,0xE6,0xAC,0xD0,0x02,0xE6,
+	0xAD,0x60,0xA2,0xFF,0x78,0x9A,0xD8,0x20,0x02,0xFD,0xD0,0x03,0x6C,0x00,0x80,0x8E,
+	0x16,0xD0,0x20,0xA3,0xFD,0x20,0x50,0xFD,0x20,0x15,0xFD,0x20,0x5B,0xFF,0x58,0x6C,
+	0x00,0xA0,0xA2,0x05,0xBD,0x0F,0xFD,0xDD,0x03,0x80,0xD0,0x03,0xCA,0xD0,0xF5,0x60,
+	0xC3,0xC2,0xCD,0x38,0x30,0xA2,0x30,0xA0,0xFD,0x18,0x86,0xC3,0x84,0xC4,0xA0,0x1F,
+	0xB9,0x14,0x03,0xB0,0x02,0xB1,0xC3,0x91,0xC3,0x99,0x14,0x03,0x88,0x10,0xF1,0x60,
+	0x31,0xEA,0x66,0xFE,0x47,0xFE,0x4A,0xF3,0x91,0xF2,0x0E,0xF2,0x50,0xF2,0x33,0xF3,
+	0x57,0xF1,0xCA,0xF1,0xED,0xF6,0x3E,0xF1,0x2F,0xF3,0x66,0xFE,0xA5,0xF4,0xED,0xF5,
+	0xA9,0x00,0xA8,0x99,0x02,0x00,0x99,0x00,0x02,0x99,0x00,0x03,0xC8,0xD0,0xF4,0xA2,
+	0x3C,0xA0,0x03,0x86,0xB2,0x84,0xB3,0xA8,0xA9,0x03,0x85,0xC2,0xE6,0xC2,0xB1,0xC1,
+	0xAA,0xA9,0x55,0x91,0xC1,0xD1,0xC1,0xD0,0x0F,0x2A,0x91,0xC1,0xD1,0xC1,0xD0,0x08,
+	0x8A,0x91,0xC1,0xC8,0xD0,0xE8,0xF0,0xE4,0x98,0xAA,0xA4,0xC2,0x18,0x20,0x2D,0xFE,
+	0xA9,0x08,0x8D,0x82,0x02,0xA9,0x04,0x8D,0x88,0x02,0x60,0x6A,0xFC,0xCD,0xFB,0x31,
+	0xEA,0x2C,0xF9,0xA9,0x7F,0x8D,0x0D,0xDC,0x8D,0x0D,0xDD,0x8D,0x00,0xDC,0xA9,0x08,
+	0x8D,0x0E,0xDC,0x8D,0x0E,0xDD,0x8D,0x0F,0xDC,0x8D,0x0F,0xDD,0xA2,0x00,0x8E,0x03,
+	0xDC,0x8E,0x03,0xDD,0x8E,0x18,0xD4,0xCA,0x8E,0x02,0xDC,0xA9,0x07,0x8D,0x00,0xDD,
+	0xA9,0x3F,0x8D,0x02,0xDD,0xA9,0xE7,0x85,0x01,0xA9,0x2F,0x85,0x00,0xAD,0xA6,0x02,
+	0xF0,0x0A,0xA9,0x25,0x8D,0x04,0xDC,0xA9,0x40,0x4C,0xF3,0xFD,0xA9,0x95,0x8D,0x04,
+	0xDC,0xA9,0x42,0x8D,0x05,0xDC,0x4C,0x6E,0xFF,0x85,0xB7,0x86,0xBB,0x84,0xBC,0x60,
+	0x85,0xB8,0x86,0xBA,0x84,0xB9,0x60,0xA5,0xBA,0xC9,0x02,0xD0,0x0D,0xAD,0x97,0x02,
+	0x48,0xA9,0x00,0x8D,0x97,0x02,0x68,0x60,0x85,0x9D,0xA5,0x90,0x05,0x90,0x85,0x90,
+	0x60,0x8D,0x85,0x02,0x60,0x90,0x06,0xAE,0x83,0x02,0xAC,0x84,0x02,0x8E,0x83,0x02,
+	0x8C,0x84,0x02,0x60,0x90,0x06,0xAE,0x81,0x02,0xAC,0x82,0x02,0x8E,0x81,0x02,0x8C,
+	0x82,0x02,0x60,0x78,0x6C,0x18,0x03,0x48,0x8A,0x48,0x98,0x48,0xA9,0x7F,0x8D,0x0D,
+	0xDD,0xAC,0x0D,0xDD,0x30,0x1C,0x20,0x02,0xFD,0xD0,0x03,0x6C,0x02,0x80,0x20,0xBC,
+	0xF6,0x20,0xE1,0xFF,0xD0,0x0C,0x20,0x15,0xFD,0x20,0xA3,0xFD,0x20,0x18,0xE5,0x6C,
+	0x02,0xA0,0x98,0x2D,0xA1,0x02,0xAA,0x29,0x01,0xF0,0x28,0xAD,0x00,0xDD,0x29,0xFB,
+	0x05,0xB5,0x8D,0x00,0xDD,0xAD,0xA1,0x02,0x8D,0x0D,0xDD,0x8A,0x29,0x12,0xF0,0x0D,
+	0x29,0x02,0xF0,0x06,0x20,0xD6,0xFE,0x4C,0x9D,0xFE,0x20,0x07,0xFF,0x20,0xBB,0xEE,
+	0x4C,0xB6,0xFE,0x8A,0x29,0x02,0xF0,0x06,0x20,0xD6,0xFE,0x4C,0xB6,0xFE,0x8A,0x29,
+	0x10,0xF0,0x03,0x20,0x07,0xFF,0xAD,0xA1,0x02,0x8D,0x0D,0xDD,0x68,0xA8,0x68,0xAA,
+	0x68,0x40,0xC1,0x27,0x3E,0x1A,0xC5,0x11,0x74,0x0E,0xED,0x0C,0x45,0x06,0xF0,0x02,
+	0x46,0x01,0xB8,0x00,0x71,0x00,0xAD,0x01,0xDD,0x29,0x01,0x85,0xA7,0xAD,0x06,0xDD,
+	0xE9,0x1C,0x6D,0x99,0x02,0x8D,0x06,0xDD,0xAD,0x07,0xDD,0x6D,0x9A,0x02,0x8D,0x07,
+	0xDD,0xA9,0x11,0x8D,0x0F,0xDD,0xAD,0xA1,0x02,0x8D,0x0D,0xDD,0xA9,0xFF,0x8D,0x06,
+	0xDD,0x8D,0x07,0xDD,0x4C,0x59,0xEF,0xAD,0x95,0x02,0x8D,0x06,0xDD,0xAD,0x96,0x02,
+	0x8D,0x07,0xDD,0xA9,0x11,0x8D,0x0F,0xDD,0xA9,0x12,0x4D,0xA1,0x02,0x8D,0xA1,0x02,
+	0xA9,0xFF,0x8D,0x06,0xDD,0x8D,0x07,0xDD,0xAE,0x98,0x02,0x86,0xA8,0x60,0xAA,0xAD,
+	0x96,0x02,0x2A,0xA8,0x8A,0x69,0xC8,0x8D,0x99,0x02,0x98,0x69,0x00,0x8D,0x9A,0x02,
+	0x60,0xEA,0xEA,0x08,0x68,0x29,0xEF,0x48,0x48,0x8A,0x48,0x98,0x48,0xBA,0xBD,0x04,
+	0x01,0x29,0x10,0xF0,0x03,0x6C,0x16,0x03,0x6C,0x14,0x03,0x20,0x18,0xE5,0xAD,0x12,
+	0xD0,0xD0,0xFB,0xAD,0x19,0xD0,0x29,0x01,0x8D,0xA6,0x02,0x4C,0xDD,0xFD,0xA9,0x81,
+	0x8D,0x0D,0xDC,0xAD,0x0E,0xDC,0x29,0x80,0x09,0x11,0x8D,0x0E,0xDC,0x4C,0x8E,0xEE,
+	0x00,0x4C,0x5B,0xFF,0x4C,0xA3,0xFD,0x4C,0x50,0xFD,0x4C,0x15,0xFD,0x4C,0x1A,0xFD,
+	0x4C,0x18,0xFE,0x4C,0xB9,0xED,0x4C,0xC7,0xED,0x4C,0x25,0xFE,0x4C,0x34,0xFE,0x4C,
+	0x87,0xEA,0x4C,0x21,0xFE,0x4C,0x13,0xEE,0x4C,0xDD,0xED,0x4C,0xEF,0xED,0x4C,0xFE,
+	0xED,0x4C,0x0C,0xED,0x4C,0x09,0xED,0x4C,0x07,0xFE,0x4C,0x00,0xFE,0x4C,0xF9,0xFD,
+	0x6C,0x1A,0x03,0x6C,0x1C,0x03,0x6C,0x1E,0x03,0x6C,0x20,0x03,0x6C,0x22,0x03,0x6C,
+	0x24,0x03,0x6C,0x26,0x03,0x4C,0x9E,0xF4,0x4C,0xDD,0xF5,0x4C,0xE4,0xF6,0x4C,0xDD,
+	0xF6,0x6C,0x28,0x03,0x6C,0x2A,0x03,0x6C,0x2C,0x03,0x4C,0x9B,0xF6,0x4C,0x05,0xE5,
+	0x4C,0x0A,0xE5,0x4C,0x00,0xE5,0x52,0x52,0x42,0x59,0x43,0xFE,0xE2,0xFC,0x48,0xFF,
+};
+
+const uint8_t CharROM6510[4096] = {
+	0x3C,0x66,0x6E,0x6E,0x60,0x62,0x3C,0x00,0x18,0x3C,0x66,0x7E,0x66,0x66,0x66,0x00,
+	0x7C,0x66,0x66,0x7C,0x66,0x66,0x7C,0x00,0x3C,0x66,0x60,0x60,0x60,0x66,0x3C,0x00,
+	0x78,0x6C,0x66,0x66,0x66,0x6C,0x78,0x00,0x7E,0x60,0x60,0x78,0x60,0x60,0x7E,0x00,
+	0x7E,0x60,0x60,0x78,0x60,0x60,0x60,0x00,0x3C,0x66,0x60,0x6E,0x66,0x66,0x3C,0x00,
+	0x66,0x66,0x66,0x7E,0x66,0x66,0x66,0x00,0x3C,0x18,0x18,0x18,0x18,0x18,0x3C,0x00,
+	0x1E,0x0C,0x0C,0x0C,0x0C,0x6C,0x38,0x00,0x66,0x6C,0x78,0x70,0x78,0x6C,0x66,0x00,
+	0x60,0x60,0x60,0x60,0x60,0x60,0x7E,0x00,0x63,0x77,0x7F,0x6B,0x63,0x63,0x63,0x00,
+	0x66,0x76,0x7E,0x7E,0x6E,0x66,0x66,0x00,0x3C,0x66,0x66,0x66,0x66,0x66,0x3C,0x00,
+	0x7C,0x66,0x66,0x7C,0x60,0x60,0x60,0x00,0x3C,0x66,0x66,0x66,0x66,0x3C,0x0E,0x00,
+	0x7C,0x66,0x66,0x7C,0x78,0x6C,0x66,0x00,0x3C,0x66,0x60,0x3C,0x06,0x66,0x3C,0x00,
+	0x7E,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x66,0x66,0x66,0x66,0x66,0x66,0x3C,0x00,
+	0x66,0x66,0x66,0x66,0x66,0x3C,0x18,0x00,0x63,0x63,0x63,0x6B,0x7F,0x77,0x63,0x00,
+	0x66,0x66,0x3C,0x18,0x3C,0x66,0x66,0x00,0x66,0x66,0x66,0x3C,0x18,0x18,0x18,0x00,
+	0x7E,0x06,0x0C,0x18,0x30,0x60,0x7E,0x00,0x3C,0x30,0x30,0x30,0x30,0x30,0x3C,0x00,
+	0x0C,0x12,0x30,0x7C,0x30,0x62,0xFC,0x00,0x3C,0x0C,0x0C,0x0C,0x0C,0x0C,0x3C,0x00,
+	0x00,0x18,0x3C,0x7E,0x18,0x18,0x18,0x18,0x00,0x10,0x30,0x7F,0x7F,0x30,0x10,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x00,0x00,0x18,0x00,
+	0x66,0x66,0x66,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0xFF,0x66,0xFF,0x66,0x66,0x00,
+	0x18,0x3E,0x60,0x3C,0x06,0x7C,0x18,0x00,0x62,0x66,0x0C,0x18,0x30,0x66,0x46,0x00,
+	0x3C,0x66,0x3C,0x38,0x67,0x66,0x3F,0x00,0x06,0x0C,0x18,0x00,0x00,0x00,0x00,0x00,
+	0x0C,0x18,0x30,0x30,0x30,0x18,0x0C,0x00,0x30,0x18,0x0C,0x0C,0x0C,0x18,0x30,0x00,
+	0x00,0x66,0x3C,0xFF,0x3C,0x66,0x00,0x00,0x00,0x18,0x18,0x7E,0x18,0x18,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x30,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x00,0x00,0x03,0x06,0x0C,0x18,0x30,0x60,0x00,
+	0x3C,0x66,0x6E,0x76,0x66,0x66,0x3C,0x00,0x18,0x18,0x38,0x18,0x18,0x18,0x7E,0x00,
+	0x3C,0x66,0x06,0x0C,0x30,0x60,0x7E,0x00,0x3C,0x66,0x06,0x1C,0x06,0x66,0x3C,0x00,
+	0x06,0x0E,0x1E,0x66,0x7F,0x06,0x06,0x00,0x7E,0x60,0x7C,0x06,0x06,0x66,0x3C,0x00,
+	0x3C,0x66,0x60,0x7C,0x66,0x66,0x3C,0x00,0x7E,0x66,0x0C,0x18,0x18,0x18,0x18,0x00,
+	0x3C,0x66,0x66,0x3C,0x66,0x66,0x3C,0x00,0x3C,0x66,0x66,0x3E,0x06,0x66,0x3C,0x00,
+	0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x18,0x30,
+	0x0E,0x18,0x30,0x60,0x30,0x18,0x0E,0x00,0x00,0x00,0x7E,0x00,0x7E,0x00,0x00,0x00,
+	0x70,0x18,0x0C,0x06,0x0C,0x18,0x70,0x00,0x3C,0x66,0x06,0x0C,0x18,0x00,0x18,0x00,
+	0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x08,0x1C,0x3E,0x7F,0x7F,0x1C,0x3E,0x00,
+	0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,
+	0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x00,0x00,0x00,0xE0,0xF0,0x38,0x18,0x18,
+	0x18,0x18,0x1C,0x0F,0x07,0x00,0x00,0x00,0x18,0x18,0x38,0xF0,0xE0,0x00,0x00,0x00,
+	0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xFF,0xC0,0xE0,0x70,0x38,0x1C,0x0E,0x07,0x03,
+	0x03,0x07,0x0E,0x1C,0x38,0x70,0xE0,0xC0,0xFF,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+	0xFF,0xFF,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x3C,0x7E,0x7E,0x7E,0x7E,0x3C,0x00,
+	0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0x36,0x7F,0x7F,0x7F,0x3E,0x1C,0x08,0x00,
+	0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x07,0x0F,0x1C,0x18,0x18,
+	0xC3,0xE7,0x7E,0x3C,0x3C,0x7E,0xE7,0xC3,0x00,0x3C,0x7E,0x66,0x66,0x7E,0x3C,0x00,
+	0x18,0x18,0x66,0x66,0x18,0x18,0x3C,0x00,0x06,0x06,0x06,0x06,0x06,0x06,0x06,0x06,
+	0x08,0x1C,0x3E,0x7F,0x3E,0x1C,0x08,0x00,0x18,0x18,0x18,0xFF,0xFF,0x18,0x18,0x18,
+	0xC0,0xC0,0x30,0x30,0xC0,0xC0,0x30,0x30,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+	0x00,0x00,0x03,0x3E,0x76,0x36,0x36,0x00,0xFF,0x7F,0x3F,0x1F,0x0F,0x07,0x03,0x01,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,
+	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+	0xCC,0xCC,0x33,0x33,0xCC,0xCC,0x33,0x33,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x00,0x00,0x00,0x00,0xCC,0xCC,0x33,0x33,0xFF,0xFE,0xFC,0xF8,0xF0,0xE0,0xC0,0x80,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x18,0x18,0x18,0x1F,0x1F,0x18,0x18,0x18,
+	0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x18,0x18,0x18,0x1F,0x1F,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xF8,0xF8,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+	0x00,0x00,0x00,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xFF,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0x18,0x18,0x18,
+	0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,
+	0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
+	0x03,0x03,0x03,0x03,0x03,0x03,0xFF,0xFF,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,
+	0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0xF8,0xF8,0x00,0x00,0x00,
+	0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,
+	0xC3,0x99,0x91,0x91,0x9F,0x99,0xC3,0xFF,0xE7,0xC3,0x99,0x81,0x99,0x99,0x99,0xFF,
+	0x83,0x99,0x99,0x83,0x99,0x99,0x83,0xFF,0xC3,0x99,0x9F,0x9F,0x9F,0x99,0xC3,0xFF,
+	0x87,0x93,0x99,0x99,0x99,0x93,0x87,0xFF,0x81,0x9F,0x9F,0x87,0x9F,0x9F,0x81,0xFF,
+	0x81,0x9F,0x9F,0x87,0x9F,0x9F,0x9F,0xFF,0xC3,0x99,0x9F,0x91,0x99,0x99,0xC3,0xFF,
+	0x99,0x99,0x99,0x81,0x99,0x99,0x99,0xFF,0xC3,0xE7,0xE7,0xE7,0xE7,0xE7,0xC3,0xFF,
+	0xE1,0xF3,0xF3,0xF3,0xF3,0x93,0xC7,0xFF,0x99,0x93,0x87,0x8F,0x87,0x93,0x99,0xFF,
+	0x9F,0x9F,0x9F,0x9F,0x9F,0x9F,0x81,0xFF,0x9C,0x88,0x80,0x94,0x9C,0x9C,0x9C,0xFF,
+	0x99,0x89,0x81,0x81,0x91,0x99,0x99,0xFF,0xC3,0x99,0x99,0x99,0x99,0x99,0xC3,0xFF,
+	0x83,0x99,0x99,0x83,0x9F,0x9F,0x9F,0xFF,0xC3,0x99,0x99,0x99,0x99,0xC3,0xF1,0xFF,
+	0x83,0x99,0x99,0x83,0x87,0x93,0x99,0xFF,0xC3,0x99,0x9F,0xC3,0xF9,0x99,0xC3,0xFF,
+	0x81,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xFF,0x99,0x99,0x99,0x99,0x99,0x99,0xC3,0xFF,
+	0x99,0x99,0x99,0x99,0x99,0xC3,0xE7,0xFF,0x9C,0x9C,0x9C,0x94,0x80,0x88,0x9C,0xFF,
+	0x99,0x99,0xC3,0xE7,0xC3,0x99,0x99,0xFF,0x99,0x99,0x99,0xC3,0xE7,0xE7,0xE7,0xFF,
+	0x81,0xF9,0xF3,0xE7,0xCF,0x9F,0x81,0xFF,0xC3,0xCF,0xCF,0xCF,0xCF,0xCF,0xC3,0xFF,
+	0xF3,0xED,0xCF,0x83,0xCF,0x9D,0x03,0xFF,0xC3,0xF3,0xF3,0xF3,0xF3,0xF3,0xC3,0xFF,
+	0xFF,0xE7,0xC3,0x81,0xE7,0xE7,0xE7,0xE7,0xFF,0xEF,0xCF,0x80,0x80,0xCF,0xEF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xE7,0xE7,0xFF,0xFF,0xE7,0xFF,
+	0x99,0x99,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0x99,0x00,0x99,0x00,0x99,0x99,0xFF,
+	0xE7,0xC1,0x9F,0xC3,0xF9,0x83,0xE7,0xFF,0x9D,0x99,0xF3,0xE7,0xCF,0x99,0xB9,0xFF,
+	0xC3,0x99,0xC3,0xC7,0x98,0x99,0xC0,0xFF,0xF9,0xF3,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xF3,0xE7,0xCF,0xCF,0xCF,0xE7,0xF3,0xFF,0xCF,0xE7,0xF3,0xF3,0xF3,0xE7,0xCF,0xFF,
+	0xFF,0x99,0xC3,0x00,0xC3,0x99,0xFF,0xFF,0xFF,0xE7,0xE7,0x81,0xE7,0xE7,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xCF,0xFF,0xFF,0xFF,0x81,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xFF,0xFF,0xFC,0xF9,0xF3,0xE7,0xCF,0x9F,0xFF,
+	0xC3,0x99,0x91,0x89,0x99,0x99,0xC3,0xFF,0xE7,0xE7,0xC7,0xE7,0xE7,0xE7,0x81,0xFF,
+	0xC3,0x99,0xF9,0xF3,0xCF,0x9F,0x81,0xFF,0xC3,0x99,0xF9,0xE3,0xF9,0x99,0xC3,0xFF,
+	0xF9,0xF1,0xE1,0x99,0x80,0xF9,0xF9,0xFF,0x81,0x9F,0x83,0xF9,0xF9,0x99,0xC3,0xFF,
+	0xC3,0x99,0x9F,0x83,0x99,0x99,0xC3,0xFF,0x81,0x99,0xF3,0xE7,0xE7,0xE7,0xE7,0xFF,
+	0xC3,0x99,0x99,0xC3,0x99,0x99,0xC3,0xFF,0xC3,0x99,0x99,0xC1,0xF9,0x99,0xC3,0xFF,
+	0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xE7,0xCF,
+	0xF1,0xE7,0xCF,0x9F,0xCF,0xE7,0xF1,0xFF,0xFF,0xFF,0x81,0xFF,0x81,0xFF,0xFF,0xFF,
+	0x8F,0xE7,0xF3,0xF9,0xF3,0xE7,0x8F,0xFF,0xC3,0x99,0xF9,0xF3,0xE7,0xFF,0xE7,0xFF,
+	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xF7,0xE3,0xC1,0x80,0x80,0xE3,0xC1,0xFF,
+	0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xCF,0xCF,0xCF,0xCF,0xCF,0xCF,0xCF,0xCF,
+	0xF3,0xF3,0xF3,0xF3,0xF3,0xF3,0xF3,0xF3,0xFF,0xFF,0xFF,0x1F,0x0F,0xC7,0xE7,0xE7,
+	0xE7,0xE7,0xE3,0xF0,0xF8,0xFF,0xFF,0xFF,0xE7,0xE7,0xC7,0x0F,0x1F,0xFF,0xFF,0xFF,
+	0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x00,0x00,0x3F,0x1F,0x8F,0xC7,0xE3,0xF1,0xF8,0xFC,
+	0xFC,0xF8,0xF1,0xE3,0xC7,0x8F,0x1F,0x3F,0x00,0x00,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,
+	0x00,0x00,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFF,0xC3,0x81,0x81,0x81,0x81,0xC3,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xC9,0x80,0x80,0x80,0xC1,0xE3,0xF7,0xFF,
+	0x9F,0x9F,0x9F,0x9F,0x9F,0x9F,0x9F,0x9F,0xFF,0xFF,0xFF,0xF8,0xF0,0xE3,0xE7,0xE7,
+	0x3C,0x18,0x81,0xC3,0xC3,0x81,0x18,0x3C,0xFF,0xC3,0x81,0x99,0x99,0x81,0xC3,0xFF,
+	0xE7,0xE7,0x99,0x99,0xE7,0xE7,0xC3,0xFF,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,0xF9,
+	0xF7,0xE3,0xC1,0x80,0xC1,0xE3,0xF7,0xFF,0xE7,0xE7,0xE7,0x00,0x00,0xE7,0xE7,0xE7,
+	0x3F,0x3F,0xCF,0xCF,0x3F,0x3F,0xCF,0xCF,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,
+	0xFF,0xFF,0xFC,0xC1,0x89,0xC9,0xC9,0xFF,0x00,0x80,0xC0,0xE0,0xF0,0xF8,0xFC,0xFE,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,
+	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,
+	0x33,0x33,0xCC,0xCC,0x33,0x33,0xCC,0xCC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
+	0xFF,0xFF,0xFF,0xFF,0x33,0x33,0xCC,0xCC,0x00,0x01,0x03,0x07,0x0F,0x1F,0x3F,0x7F,
+	0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xE7,0xE7,0xE7,0xE0,0xE0,0xE7,0xE7,0xE7,
+	0xFF,0xFF,0xFF,0xFF,0xF0,0xF0,0xF0,0xF0,0xE7,0xE7,0xE7,0xE0,0xE0,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0x07,0x07,0xE7,0xE7,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
+	0xFF,0xFF,0xFF,0xE0,0xE0,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0x00,0x00,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0x00,0x00,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0x07,0x07,0xE7,0xE7,0xE7,
+	0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,
+	0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
+	0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,
+	0xF0,0xF0,0xF0,0xF0,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xE7,0x07,0x07,0xFF,0xFF,0xFF,
+	0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,
+	0x3C,0x66,0x6E,0x6E,0x60,0x62,0x3C,0x00,0x00,0x00,0x3C,0x06,0x3E,0x66,0x3E,0x00,
+	0x00,0x60,0x60,0x7C,0x66,0x66,0x7C,0x00,0x00,0x00,0x3C,0x60,0x60,0x60,0x3C,0x00,
+	0x00,0x06,0x06,0x3E,0x66,0x66,0x3E,0x00,0x00,0x00,0x3C,0x66,0x7E,0x60,0x3C,0x00,
+	0x00,0x0E,0x18,0x3E,0x18,0x18,0x18,0x00,0x00,0x00,0x3E,0x66,0x66,0x3E,0x06,0x7C,
+	0x00,0x60,0x60,0x7C,0x66,0x66,0x66,0x00,0x00,0x18,0x00,0x38,0x18,0x18,0x3C,0x00,
+	0x00,0x06,0x00,0x06,0x06,0x06,0x06,0x3C,0x00,0x60,0x60,0x6C,0x78,0x6C,0x66,0x00,
+	0x00,0x38,0x18,0x18,0x18,0x18,0x3C,0x00,0x00,0x00,0x66,0x7F,0x7F,0x6B,0x63,0x00,
+	0x00,0x00,0x7C,0x66,0x66,0x66,0x66,0x00,0x00,0x00,0x3C,0x66,0x66,0x66,0x3C,0x00,
+	0x00,0x00,0x7C,0x66,0x66,0x7C,0x60,0x60,0x00,0x00,0x3E,0x66,0x66,0x3E,0x06,0x06,
+	0x00,0x00,0x7C,0x66,0x60,0x60,0x60,0x00,0x00,0x00,0x3E,0x60,0x3C,0x06,0x7C,0x00,
+	0x00,0x18,0x7E,0x18,0x18,0x18,0x0E,0x00,0x00,0x00,0x66,0x66,0x66,0x66,0x3E,0x00,
+	0x00,0x00,0x66,0x66,0x66,0x3C,0x18,0x00,0x00,0x00,0x63,0x6B,0x7F,0x3E,0x36,0x00,
+	0x00,0x00,0x66,0x3C,0x18,0x3C,0x66,0x00,0x00,0x00,0x66,0x66,0x66,0x3E,0x0C,0x78,
+	0x00,0x00,0x7E,0x0C,0x18,0x30,0x7E,0x00,0x3C,0x30,0x30,0x30,0x30,0x30,0x3C,0x00,
+	0x0C,0x12,0x30,0x7C,0x30,0x62,0xFC,0x00,0x3C,0x0C,0x0C,0x0C,0x0C,0x0C,0x3C,0x00,
+	0x00,0x18,0x3C,0x7E,0x18,0x18,0x18,0x18,0x00,0x10,0x30,0x7F,0x7F,0x30,0x10,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0x18,0x00,0x00,0x18,0x00,
+	0x66,0x66,0x66,0x00,0x00,0x00,0x00,0x00,0x66,0x66,0xFF,0x66,0xFF,0x66,0x66,0x00,
+	0x18,0x3E,0x60,0x3C,0x06,0x7C,0x18,0x00,0x62,0x66,0x0C,0x18,0x30,0x66,0x46,0x00,
+	0x3C,0x66,0x3C,0x38,0x67,0x66,0x3F,0x00,0x06,0x0C,0x18,0x00,0x00,0x00,0x00,0x00,
+	0x0C,0x18,0x30,0x30,0x30,0x18,0x0C,0x00,0x30,0x18,0x0C,0x0C,0x0C,0x18,0x30,0x00,
+	0x00,0x66,0x3C,0xFF,0x3C,0x66,0x00,0x00,0x00,0x18,0x18,0x7E,0x18,0x18,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x30,0x00,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x18,0x18,0x00,0x00,0x03,0x06,0x0C,0x18,0x30,0x60,0x00,
+	0x3C,0x66,0x6E,0x76,0x66,0x66,0x3C,0x00,0x18,0x18,0x38,0x18,0x18,0x18,0x7E,0x00,
+	0x3C,0x66,0x06,0x0C,0x30,0x60,0x7E,0x00,0x3C,0x66,0x06,0x1C,0x06,0x66,0x3C,0x00,
+	0x06,0x0E,0x1E,0x66,0x7F,0x06,0x06,0x00,0x7E,0x60,0x7C,0x06,0x06,0x66,0x3C,0x00,
+	0x3C,0x66,0x60,0x7C,0x66,0x66,0x3C,0x00,0x7E,0x66,0x0C,0x18,0x18,0x18,0x18,0x00,
+	0x3C,0x66,0x66,0x3C,0x66,0x66,0x3C,0x00,0x3C,0x66,0x66,0x3E,0x06,0x66,0x3C,0x00,
+	0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x18,0x30,
+	0x0E,0x18,0x30,0x60,0x30,0x18,0x0E,0x00,0x00,0x00,0x7E,0x00,0x7E,0x00,0x00,0x00,
+	0x70,0x18,0x0C,0x06,0x0C,0x18,0x70,0x00,0x3C,0x66,0x06,0x0C,0x18,0x00,0x18,0x00,
+	0x00,0x00,0x00,0xFF,0xFF,0x00,0x00,0x00,0x18,0x3C,0x66,0x7E,0x66,0x66,0x66,0x00,
+	0x7C,0x66,0x66,0x7C,0x66,0x66,0x7C,0x00,0x3C,0x66,0x60,0x60,0x60,0x66,0x3C,0x00,
+	0x78,0x6C,0x66,0x66,0x66,0x6C,0x78,0x00,0x7E,0x60,0x60,0x78,0x60,0x60,0x7E,0x00,
+	0x7E,0x60,0x60,0x78,0x60,0x60,0x60,0x00,0x3C,0x66,0x60,0x6E,0x66,0x66,0x3C,0x00,
+	0x66,0x66,0x66,0x7E,0x66,0x66,0x66,0x00,0x3C,0x18,0x18,0x18,0x18,0x18,0x3C,0x00,
+	0x1E,0x0C,0x0C,0x0C,0x0C,0x6C,0x38,0x00,0x66,0x6C,0x78,0x70,0x78,0x6C,0x66,0x00,
+	0x60,0x60,0x60,0x60,0x60,0x60,0x7E,0x00,0x63,0x77,0x7F,0x6B,0x63,0x63,0x63,0x00,
+	0x66,0x76,0x7E,0x7E,0x6E,0x66,0x66,0x00,0x3C,0x66,0x66,0x66,0x66,0x66,0x3C,0x00,
+	0x7C,0x66,0x66,0x7C,0x60,0x60,0x60,0x00,0x3C,0x66,0x66,0x66,0x66,0x3C,0x0E,0x00,
+	0x7C,0x66,0x66,0x7C,0x78,0x6C,0x66,0x00,0x3C,0x66,0x60,0x3C,0x06,0x66,0x3C,0x00,
+	0x7E,0x18,0x18,0x18,0x18,0x18,0x18,0x00,0x66,0x66,0x66,0x66,0x66,0x66,0x3C,0x00,
+	0x66,0x66,0x66,0x66,0x66,0x3C,0x18,0x00,0x63,0x63,0x63,0x6B,0x7F,0x77,0x63,0x00,
+	0x66,0x66,0x3C,0x18,0x3C,0x66,0x66,0x00,0x66,0x66,0x66,0x3C,0x18,0x18,0x18,0x00,
+	0x7E,0x06,0x0C,0x18,0x30,0x60,0x7E,0x00,0x18,0x18,0x18,0xFF,0xFF,0x18,0x18,0x18,
+	0xC0,0xC0,0x30,0x30,0xC0,0xC0,0x30,0x30,0x18,0x18,0x18,0x18,0x18,0x18,0x18,0x18,
+	0x33,0x33,0xCC,0xCC,0x33,0x33,0xCC,0xCC,0x33,0x99,0xCC,0x66,0x33,0x99,0xCC,0x66,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,
+	0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+	0xCC,0xCC,0x33,0x33,0xCC,0xCC,0x33,0x33,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+	0x00,0x00,0x00,0x00,0xCC,0xCC,0x33,0x33,0xCC,0x99,0x33,0x66,0xCC,0x99,0x33,0x66,
+	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x18,0x18,0x18,0x1F,0x1F,0x18,0x18,0x18,
+	0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x18,0x18,0x18,0x1F,0x1F,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xF8,0xF8,0x18,0x18,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
+	0x00,0x00,0x00,0x1F,0x1F,0x18,0x18,0x18,0x18,0x18,0x18,0xFF,0xFF,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xFF,0xFF,0x18,0x18,0x18,0x18,0x18,0x18,0xF8,0xF8,0x18,0x18,0x18,
+	0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,0xE0,
+	0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,
+	0x01,0x03,0x06,0x6C,0x78,0x70,0x60,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,
+	0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x18,0x18,0x18,0xF8,0xF8,0x00,0x00,0x00,
+	0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,
+	0xC3,0x99,0x91,0x91,0x9F,0x99,0xC3,0xFF,0xFF,0xFF,0xC3,0xF9,0xC1,0x99,0xC1,0xFF,
+	0xFF,0x9F,0x9F,0x83,0x99,0x99,0x83,0xFF,0xFF,0xFF,0xC3,0x9F,0x9F,0x9F,0xC3,0xFF,
+	0xFF,0xF9,0xF9,0xC1,0x99,0x99,0xC1,0xFF,0xFF,0xFF,0xC3,0x99,0x81,0x9F,0xC3,0xFF,
+	0xFF,0xF1,0xE7,0xC1,0xE7,0xE7,0xE7,0xFF,0xFF,0xFF,0xC1,0x99,0x99,0xC1,0xF9,0x83,
+	0xFF,0x9F,0x9F,0x83,0x99,0x99,0x99,0xFF,0xFF,0xE7,0xFF,0xC7,0xE7,0xE7,0xC3,0xFF,
+	0xFF,0xF9,0xFF,0xF9,0xF9,0xF9,0xF9,0xC3,0xFF,0x9F,0x9F,0x93,0x87,0x93,0x99,0xFF,
+	0xFF,0xC7,0xE7,0xE7,0xE7,0xE7,0xC3,0xFF,0xFF,0xFF,0x99,0x80,0x80,0x94,0x9C,0xFF,
+	0xFF,0xFF,0x83,0x99,0x99,0x99,0x99,0xFF,0xFF,0xFF,0xC3,0x99,0x99,0x99,0xC3,0xFF,
+	0xFF,0xFF,0x83,0x99,0x99,0x83,0x9F,0x9F,0xFF,0xFF,0xC1,0x99,0x99,0xC1,0xF9,0xF9,
+	0xFF,0xFF,0x83,0x99,0x9F,0x9F,0x9F,0xFF,0xFF,0xFF,0xC1,0x9F,0xC3,0xF9,0x83,0xFF,
+	0xFF,0xE7,0x81,0xE7,0xE7,0xE7,0xF1,0xFF,0xFF,0xFF,0x99,0x99,0x99,0x99,0xC1,0xFF,
+	0xFF,0xFF,0x99,0x99,0x99,0xC3,0xE7,0xFF,0xFF,0xFF,0x9C,0x94,0x80,0xC1,0xC9,0xFF,
+	0xFF,0xFF,0x99,0xC3,0xE7,0xC3,0x99,0xFF,0xFF,0xFF,0x99,0x99,0x99,0xC1,0xF3,0x87,
+	0xFF,0xFF,0x81,0xF3,0xE7,0xCF,0x81,0xFF,0xC3,0xCF,0xCF,0xCF,0xCF,0xCF,0xC3,0xFF,
+	0xF3,0xED,0xCF,0x83,0xCF,0x9D,0x03,0xFF,0xC3,0xF3,0xF3,0xF3,0xF3,0xF3,0xC3,0xFF,
+	0xFF,0xE7,0xC3,0x81,0xE7,0xE7,0xE7,0xE7,0xFF,0xEF,0xCF,0x80,0x80,0xCF,0xEF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xE7,0xE7,0xFF,0xFF,0xE7,0xFF,
+	0x99,0x99,0x99,0xFF,0xFF,0xFF,0xFF,0xFF,0x99,0x99,0x00,0x99,0x00,0x99,0x99,0xFF,
+	0xE7,0xC1,0x9F,0xC3,0xF9,0x83,0xE7,0xFF,0x9D,0x99,0xF3,0xE7,0xCF,0x99,0xB9,0xFF,
+	0xC3,0x99,0xC3,0xC7,0x98,0x99,0xC0,0xFF,0xF9,0xF3,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xF3,0xE7,0xCF,0xCF,0xCF,0xE7,0xF3,0xFF,0xCF,0xE7,0xF3,0xF3,0xF3,0xE7,0xCF,0xFF,
+	0xFF,0x99,0xC3,0x00,0xC3,0x99,0xFF,0xFF,0xFF,0xE7,0xE7,0x81,0xE7,0xE7,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xCF,0xFF,0xFF,0xFF,0x81,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xFF,0xFF,0xFC,0xF9,0xF3,0xE7,0xCF,0x9F,0xFF,
+	0xC3,0x99,0x91,0x89,0x99,0x99,0xC3,0xFF,0xE7,0xE7,0xC7,0xE7,0xE7,0xE7,0x81,0xFF,
+	0xC3,0x99,0xF9,0xF3,0xCF,0x9F,0x81,0xFF,0xC3,0x99,0xF9,0xE3,0xF9,0x99,0xC3,0xFF,
+	0xF9,0xF1,0xE1,0x99,0x80,0xF9,0xF9,0xFF,0x81,0x9F,0x83,0xF9,0xF9,0x99,0xC3,0xFF,
+	0xC3,0x99,0x9F,0x83,0x99,0x99,0xC3,0xFF,0x81,0x99,0xF3,0xE7,0xE7,0xE7,0xE7,0xFF,
+	0xC3,0x99,0x99,0xC3,0x99,0x99,0xC3,0xFF,0xC3,0x99,0x99,0xC1,0xF9,0x99,0xC3,0xFF,
+	0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xE7,0xCF,
+	0xF1,0xE7,0xCF,0x9F,0xCF,0xE7,0xF1,0xFF,0xFF,0xFF,0x81,0xFF,0x81,0xFF,0xFF,0xFF,
+	0x8F,0xE7,0xF3,0xF9,0xF3,0xE7,0x8F,0xFF,0xC3,0x99,0xF9,0xF3,0xE7,0xFF,0xE7,0xFF,
+	0xFF,0xFF,0xFF,0x00,0x00,0xFF,0xFF,0xFF,0xE7,0xC3,0x99,0x81,0x99,0x99,0x99,0xFF,
+	0x83,0x99,0x99,0x83,0x99,0x99,0x83,0xFF,0xC3,0x99,0x9F,0x9F,0x9F,0x99,0xC3,0xFF,
+	0x87,0x93,0x99,0x99,0x99,0x93,0x87,0xFF,0x81,0x9F,0x9F,0x87,0x9F,0x9F,0x81,0xFF,
+	0x81,0x9F,0x9F,0x87,0x9F,0x9F,0x9F,0xFF,0xC3,0x99,0x9F,0x91,0x99,0x99,0xC3,0xFF,
+	0x99,0x99,0x99,0x81,0x99,0x99,0x99,0xFF,0xC3,0xE7,0xE7,0xE7,0xE7,0xE7,0xC3,0xFF,
+	0xE1,0xF3,0xF3,0xF3,0xF3,0x93,0xC7,0xFF,0x99,0x93,0x87,0x8F,0x87,0x93,0x99,0xFF,
+	0x9F,0x9F,0x9F,0x9F,0x9F,0x9F,0x81,0xFF,0x9C,0x88,0x80,0x94,0x9C,0x9C,0x9C,0xFF,
+	0x99,0x89,0x81,0x81,0x91,0x99,0x99,0xFF,0xC3,0x99,0x99,0x99,0x99,0x99,0xC3,0xFF,
+	0x83,0x99,0x99,0x83,0x9F,0x9F,0x9F,0xFF,0xC3,0x99,0x99,0x99,0x99,0xC3,0xF1,0xFF,
+	0x83,0x99,0x99,0x83,0x87,0x93,0x99,0xFF,0xC3,0x99,0x9F,0xC3,0xF9,0x99,0xC3,0xFF,
+	0x81,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xFF,0x99,0x99,0x99,0x99,0x99,0x99,0xC3,0xFF,
+	0x99,0x99,0x99,0x99,0x99,0xC3,0xE7,0xFF,0x9C,0x9C,0x9C,0x94,0x80,0x88,0x9C,0xFF,
+	0x99,0x99,0xC3,0xE7,0xC3,0x99,0x99,0xFF,0x99,0x99,0x99,0xC3,0xE7,0xE7,0xE7,0xFF,
+	0x81,0xF9,0xF3,0xE7,0xCF,0x9F,0x81,0xFF,0xE7,0xE7,0xE7,0x00,0x00,0xE7,0xE7,0xE7,
+	0x3F,0x3F,0xCF,0xCF,0x3F,0x3F,0xCF,0xCF,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,
+	0xCC,0xCC,0x33,0x33,0xCC,0xCC,0x33,0x33,0xCC,0x66,0x33,0x99,0xCC,0x66,0x33,0x99,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,
+	0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,
+	0x33,0x33,0xCC,0xCC,0x33,0x33,0xCC,0xCC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,
+	0xFF,0xFF,0xFF,0xFF,0x33,0x33,0xCC,0xCC,0x33,0x66,0xCC,0x99,0x33,0x66,0xCC,0x99,
+	0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xFC,0xE7,0xE7,0xE7,0xE0,0xE0,0xE7,0xE7,0xE7,
+	0xFF,0xFF,0xFF,0xFF,0xF0,0xF0,0xF0,0xF0,0xE7,0xE7,0xE7,0xE0,0xE0,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0x07,0x07,0xE7,0xE7,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,
+	0xFF,0xFF,0xFF,0xE0,0xE0,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0x00,0x00,0xFF,0xFF,0xFF,
+	0xFF,0xFF,0xFF,0x00,0x00,0xE7,0xE7,0xE7,0xE7,0xE7,0xE7,0x07,0x07,0xE7,0xE7,0xE7,
+	0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,0x1F,
+	0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+	0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,
+	0xFE,0xFC,0xF9,0x93,0x87,0x8F,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,
+	0xF0,0xF0,0xF0,0xF0,0xFF,0xFF,0xFF,0xFF,0xE7,0xE7,0xE7,0x07,0x07,0xFF,0xFF,0xFF,
+	0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,
+};
@@ -0,0 +1,513 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "runner.h"
+#include "platform.h"
+
+/*****************************************************************************
+ *** MANIFEST: Read the list of test programs                              ***
+ ***                                                                       ***
+ *** returns the number of tests in *tests (free it with                   ***
+ *** FreeTestManifest6510), -1 on an error                                 ***
+ *****************************************************************************/
+static int ManifestError(const char* filename, int number, const char* message, FILE* f, TestCase6510* list, int count, C64Archive* archive, int used)
+{
+	printf("error: %s line %d: %s\n", filename, number, message);
+	FreeTestManifest6510(list, count);
+	if (!used)
+		C64_CloseArchive(archive);
+	fclose(f);
+	return -1;
+}
+
+int LoadTestManifest6510(const char* filename, TestCase6510** tests)
+{
+	FILE* f = fopen(filename, "r");
+	TestCase6510* list = NULL;
+	C64Archive* archive = NULL;
+	int used = 0;      // a test refers to archive
+	int count = 0;
+	int capacity = 0;
+	int number = 0;
+	char line[512];
+
+	if (f == NULL)
+	{
+		printf("error: Couldn't open %s\n", filename);
+		return -1;
+	}
+	while (fgets(line, sizeof(line), f) != NULL)
+	{
+		TestCase6510 test;
+		char load[8];
+		unsigned entry, result, expected;
+		unsigned long long max = TEST_MAX_INSTRUCTIONS;
+		unsigned long long max_cycles = 0;
+		char* p = line;
+		char* end;
+		int fields;
+
+		number++;
+		while (*p == ' ' || *p == '\t')
+			p++;
+		if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0')
+			continue;
+		memset(&test, 0, sizeof(test));
+		fields = sscanf(p, "%31s %255s %7s %x %x %x %llu %llu", test.name, test.file, load, &entry, &result, &expected, &max, &max_cycles);
+
+		// archive <file> or archive -
+		if (fields == 2 && strcmp(test.name, "archive") == 0)
+		{
+			if (!used)
+				C64_CloseArchive(archive);
+			archive = NULL;
+			used = 0;
+			if (strcmp(test.file, "-") != 0 && (archive = C64_OpenArchive(test.file)) == NULL)
+				return ManifestError(filename, number, "archive not found", f, list, count, NULL, 1);
+			continue;
+		}
+
+		if (strcmp(load, "prg") == 0)
+			test.load = C64_PRG_HEADER;
+		else
+			test.load = (int32_t)strtoul(load, &end, 16);
+		if (fields < 6 || (test.load != C64_PRG_HEADER && (*end != '\0' || test.load > 0xFFFF)) ||
+			entry > 0xFFFF || result > 0xFFFF || expected > 0xFF)
+			return ManifestError(filename, number, "expected name file load|prg entry result expected [max instructions [max cycles]]",
+				f, list, count, archive, used);
+		test.entry = (uint16_t)entry;
+		test.result = (uint16_t)result;
+		test.expected = (uint8_t)expected;
+		test.max_instructions = max;
+		test.max_cycles = max_cycles;
+		if (archive != NULL)
+		{
+			test.archive = archive;
+			test.member = C64_FindInArchive(archive, test.file);
+			if (test.member < 0)
+				return ManifestError(filename, number, "not in the archive", f, list, count, archive, used);
+		}
+
+		if (count == capacity)
+		{
+			TestCase6510* grown;
+
+			capacity = capacity ? capacity * 2 : 16;
+			grown = (TestCase6510*)realloc(list, capacity * sizeof(TestCase6510));
+			if (grown == NULL)
+				return ManifestError(filename, number, "out of memory", f, list, count, archive, used);
+			list = grown;
+		}
+		list[count++] = test;
+		used |= archive != NULL;
+	}
+	if (!used)
+		C64_CloseArchive(archive);
+	fclose(f);
+	*tests = list;
+	return count;
+}
+
+/*
+  Frees the tests and closes their archives. The tests of an archive are
+  next to each other.
+*/
+void FreeTestManifest6510(TestCase6510* tests, int count)
+{
+	for (int i = 0; i < count; i++)
+		if (tests[i].archive != NULL && (i == 0 || tests[i].archive != tests[i - 1].archive))
+			C64_CloseArchive(tests[i].archive);
+	free(tests);
+}
+
+/*
+  Resets the machine and loads the program of a test, ready to run from
+  its entry. A test ends on a BRK, so the machine halts there. Returns 1
+  when the program can not be loaded.
+*/
+int LoadTest6510(State6510* state, const TestCase6510* test)
+{
+	int error;
+
+	Reset6510(state);
+	state->halt_on_brk = 1;
+	if (test->archive != NULL)
+		error = C64_LoadFromArchive(state, test->archive, test->member, test->load, NULL, NULL);
+	else if (test->load == C64_PRG_HEADER)
+		error = C64_LoadPRG(state, test->file, NULL, NULL);
+	else
+		error = C64_LoadFile(state, test->file, (uint16_t)test->load);
+	state->PC = test->entry;
+	return error;
+}
+
+/*****************************************************************************
+ *** RUN TEST: Load one test program into the machine and run it           ***
+ ***                                                                       ***
+ *** The machine runs in frames like the main loop. Near a limit the       ***
+ *** budget shrinks: an instruction takes at least two cycles, so a budget ***
+ *** of n cycles never runs more than n instructions. The cycle limit can  ***
+ *** be passed by the last instruction.                                    ***
+ *****************************************************************************/
+void RunTest6510(State6510* state, const TestCase6510* test, TestResult6510* result)
+{
+	double start;
+
+	memset(result, 0, sizeof(*result));
+	if (LoadTest6510(state, test))
+	{
+		result->status = TEST_ERROR;
+		return;
+	}
+
+	start = TimerSeconds();
+	while (!state->halted)
+	{
+		uint64_t budget = C64_CYCLES_PER_FRAME;
+
+		if (test->max_instructions != 0)
+		{
+			if (state->instructions >= test->max_instructions)
+				break;
+			if (test->max_instructions - state->instructions < budget)
+				budget = test->max_instructions - state->instructions;
+		}
+		if (test->max_cycles != 0)
+		{
+			if (state->cycles >= test->max_cycles)
+				break;
+			if (test->max_cycles - state->cycles < budget)
+				budget = test->max_cycles - state->cycles;
+		}
+		Run6510(state, (int)budget);
+	}
+	result->seconds = TimerSeconds() - start;
+
+	result->instructions = state->instructions;
+	result->cycles = state->cycles;
+	result->value = Peek(state, test->result);
+	if (!state->halted)
+		result->status = TEST_TIMEOUT;
+	else
+		result->status = result->value == test->expected ? TEST_PASS : TEST_FAIL;
+}
+
+/*****************************************************************************
+ *** TEST: conformance and speed of the core in one pass                   ***
+ ***      6502 test [manifest]                                             ***
+ ***                                                                       ***
+ *** Runs every test of the manifest (TEST_MANIFEST by default) and prints ***
+ *** pass/fail with its runtime and speed in MIPS. Returns 1 when a test   ***
+ *** did not pass.                                                         ***
+ *****************************************************************************/
+int TestMain(const C64ROMSet* rom, int argc, char** argv)
+{
+	static const char* status_text[] = { "pass", "FAIL", "TIMEOUT", "ERROR" };
+	const char* manifest = (argc >= 1) ? argv[0] : TEST_MANIFEST;
+	TestCase6510* tests = NULL;
+	State6510* state;
+	int count = LoadTestManifest6510(manifest, &tests);
+	int passed = 0;
+
+	if (count < 0)
+		return 1;
+	state = C64_AllocateMemory(rom);
+	if (state == NULL)
+	{
+		FreeTestManifest6510(tests, count);
+		return 1;
+	}
+
+	printf("test                 result   instructions  cycles        seconds  MIPS\n");
+	for (int i = 0; i < count; i++)
+	{
+		TestResult6510 result;
+
+		RunTest6510(state, &tests[i], &result);
+		printf("%-20s %-8s %-13llu %-13llu %-8.3f %.1f", tests[i].name, status_text[result.status],
+			(unsigned long long)result.instructions, (unsigned long long)result.cycles, result.seconds,
+			result.seconds > 0 ? (double)result.instructions / result.seconds / 1e6 : 0.0);
+		if (result.status == TEST_FAIL)
+			printf("  $%04X=%02X, expected %02X", tests[i].result, result.value, tests[i].expected);
+		if (result.status == TEST_ERROR)
+			printf("  couldn't load %s", tests[i].file);
+		printf("\n");
+		if (result.status == TEST_PASS)
+			passed++;
+	}
+	printf("%d of %d passed\n", passed, count);
+
+	C64_FreeMemory(state);
+	FreeTestManifest6510(tests, count);
+	return passed == count ? 0 : 1;
+}
+
+/*****************************************************************************
+ *** BATCH: many short jobs on a work-stealing pool of threads             ***
+ ***                                                                       ***
+ *** Every worker owns one machine for all its jobs and starts with an     ***
+ *** equal share of the job list. A share is a range of job numbers,       ***
+ *** packed in one word (first | end << 32). The worker takes jobs from    ***
+ *** the front, a worker that runs out steals the back half of another     ***
+ *** worker's range. Both sides change a range with compare and exchange,  ***
+ *** so there is no lock. A range only shrinks or is refilled with jobs    ***
+ *** nobody else has seen, so an old value never comes back (no ABA).      ***
+ ***                                                                       ***
+ *** Results are written as one JSON object per line as the jobs finish,   ***
+ *** then one summary line.                                                ***
+ *****************************************************************************/
+#define BATCH_LINE		512
+#define BATCH_CACHE_LINE	64
+
+typedef struct BatchWorker {
+	volatile uint64_t range;    // jobs left: first | end << 32
+	struct BatchPool *pool;
+	int      index;
+	uint64_t jobs;              // out: jobs run
+	uint64_t passed;
+	uint64_t steals;
+	uint64_t instructions;
+	uint64_t cycles;
+	int      started;           // the thread runs
+} BatchWorker;
+
+/*
+  A worker rounded up to whole cache lines. The slots are page aligned, so
+  no two workers share a line: one thread's counters and another one's range
+  would otherwise bounce between the cores with every job.
+*/
+typedef union BatchSlot {
+	BatchWorker worker;
+	uint8_t  lines[(sizeof(BatchWorker) + BATCH_CACHE_LINE - 1) / BATCH_CACHE_LINE * BATCH_CACHE_LINE];
+} BatchSlot;
+
+typedef struct BatchPool {
+	const C64ROMSet *rom;
+	const TestCase6510 *jobs;
+	BatchSlot *workers;         // AllocatePages, count slots
+	int      count;             // workers
+	C64Pool  *machines;         // one per worker
+} BatchPool;
+
+#define RANGE(first, end)	((uint64_t)(first) | ((uint64_t)(end) << 32))
+#define RANGE_FIRST(range)	((uint32_t)(range))
+#define RANGE_END(range)	((uint32_t)((range) >> 32))
+
+/*
+  Takes the first job of the worker's own range, -1 when it is empty
+*/
+static int64_t TakeJob(BatchWorker* worker)
+{
+	for (;;)
+	{
+		uint64_t range = AtomicLoad64(&worker->range);
+		uint32_t first = RANGE_FIRST(range);
+		uint32_t end = RANGE_END(range);
+
+		if (first >= end)
+			return -1;
+		if (AtomicCompareExchange64(&worker->range, range, RANGE(first + 1, end)))
+			return first;
+	}
+}
+
+/*
+  Moves the back half of another worker's range to this worker and
+  returns its first job, -1 when all ranges are empty
+*/
+static int64_t StealJob(BatchWorker* worker)
+{
+	BatchPool* pool = worker->pool;
+
+	for (int i = 1; i < pool->count; i++)
+	{
+		BatchWorker* victim = &pool->workers[(worker->index + i) % pool->count].worker;
+
+		for (;;)
+		{
+			uint64_t range = AtomicLoad64(&victim->range);
+			uint32_t first = RANGE_FIRST(range);
+			uint32_t end = RANGE_END(range);
+			uint32_t half = (end - first + 1) / 2;
+
+			if (first >= end)
+				break;
+			if (AtomicCompareExchange64(&victim->range, range, RANGE(first, end - half)))
+			{
+				AtomicStore64(&worker->range, RANGE(end - half + 1, end));
+				worker->steals++;
+				return end - half;
+			}
+		}
+	}
+	return -1;
+}
+
+/*
+  Copies text into a JSON string without the quotes
+*/
+static char* PutJsonString(char* p, const char* text)
+{
+	for (; *text; text++)
+	{
+		if (*text == '"' || *text == '\\')
+			*p++ = '\\';
+		if ((unsigned char)*text >= 0x20)
+			*p++ = *text;
+	}
+	return p;
+}
+
+static void PrintJobLine(int job, const TestCase6510* test, const TestResult6510* result, int worker)
+{
+	static const char* status_text[] = { "pass", "fail", "timeout", "error" };
+	char line[BATCH_LINE];
+	char* p = line;
+
+	p += sprintf(p, "{\"job\":%d,\"name\":\"", job);
+	p = PutJsonString(p, test->name);
+	p += sprintf(p, "\",\"status\":\"%s\",\"result\":%u,\"expected\":%u,\"instructions\":%llu,\"cycles\":%llu,"
+		"\"seconds\":%.6f,\"mips\":%.1f,\"worker\":%d}\n",
+		status_text[result->status], result->value, test->expected,
+		(unsigned long long)result->instructions, (unsigned long long)result->cycles, result->seconds,
+		result->seconds > 0 ? (double)result->instructions / result->seconds / 1e6 : 0.0, worker);
+	// One write per line, the C library keeps lines of different threads apart
+	fwrite(line, 1, (size_t)(p - line), stdout);
+}
+
+static void BatchWorkerRun(void* arg)
+{
+	BatchWorker* worker = (BatchWorker*)arg;
+	State6510* state = C64_TakeMachine(worker->pool->machines);
+	int64_t job;
+
+	// Without a machine the other workers steal this worker's jobs
+	if (state == NULL)
+		return;
+	while ((job = TakeJob(worker)) >= 0 || (job = StealJob(worker)) >= 0)
+	{
+		const TestCase6510* test = &worker->pool->jobs[job];
+		TestResult6510 result;
+
+		RunTest6510(state, test, &result);
+		PrintJobLine((int)job, test, &result, worker->index);
+		worker->jobs++;
+		worker->passed += result.status == TEST_PASS;
+		worker->instructions += result.instructions;
+		worker->cycles += result.cycles;
+	}
+	C64_ReturnMachine(worker->pool->machines, state);
+}
+
+static int RunBatch(const C64ROMSet* rom, const TestCase6510* jobs, int count, int threads)
+{
+	BatchPool pool;
+	Thread6510* handles = (Thread6510*)calloc(threads, sizeof(Thread6510));
+	uint64_t done = 0, passed = 0, steals = 0, instructions = 0, cycles = 0;
+	double start, seconds;
+	int started = 0;
+
+	pool.rom = rom;
+	pool.jobs = jobs;
+	pool.count = threads;
+	pool.workers = (BatchSlot*)AllocatePages((size_t)threads * sizeof(BatchSlot));
+	pool.machines = C64_CreatePool(rom, threads);
+	if (handles == NULL || pool.workers == NULL || pool.machines == NULL)
+	{
+		printf("error: Couldn't allocate %d machines\n", threads);
+		free(handles);
+		FreePages(pool.workers, (size_t)threads * sizeof(BatchSlot));
+		C64_FreePool(pool.machines);
+		return 1;
+	}
+	for (int i = 0; i < threads; i++)
+	{
+		pool.workers[i].worker.pool = &pool;
+		pool.workers[i].worker.index = i;
+		pool.workers[i].worker.range = RANGE((int64_t)count * i / threads, (int64_t)count * (i + 1) / threads);
+	}
+
+	start = TimerSeconds();
+	for (int i = 0; i < threads; i++)
+	{
+		// The jobs of a worker that did not start go to the others
+		pool.workers[i].worker.started = StartThread(&handles[i], BatchWorkerRun, &pool.workers[i].worker) == 0;
+		started += pool.workers[i].worker.started;
+	}
+	if (started == 0)
+		BatchWorkerRun(&pool.workers[0].worker);
+	for (int i = 0; i < threads; i++)
+	{
+		if (pool.workers[i].worker.started)
+			JoinThread(handles[i]);
+	}
+	seconds = TimerSeconds() - start;
+
+	for (int i = 0; i < threads; i++)
+	{
+		done += pool.workers[i].worker.jobs;
+		passed += pool.workers[i].worker.passed;
+		steals += pool.workers[i].worker.steals;
+		instructions += pool.workers[i].worker.instructions;
+		cycles += pool.workers[i].worker.cycles;
+	}
+	printf("{\"summary\":true,\"jobs\":%d,\"done\":%llu,\"passed\":%llu,\"failed\":%llu,\"threads\":%d,\"steals\":%llu,"
+		"\"instructions\":%llu,\"cycles\":%llu,\"seconds\":%.6f,\"mips\":%.1f,\"jobs_per_second\":%.1f}\n",
+		count, (unsigned long long)done, (unsigned long long)passed, (unsigned long long)(done - passed), threads,
+		(unsigned long long)steals, (unsigned long long)instructions, (unsigned long long)cycles, seconds,
+		seconds > 0 ? (double)instructions / seconds / 1e6 : 0.0, seconds > 0 ? (double)done / seconds : 0.0);
+
+	free(handles);
+	FreePages(pool.workers, (size_t)threads * sizeof(BatchSlot));
+	C64_FreePool(pool.machines);
+	return (done == (uint64_t)count && passed == done) ? 0 : 1;
+}
+
+/*****************************************************************************
+ *** BATCH: command line                                                   ***
+ ***      6502 batch <jobs> [threads] [repeat]                             ***
+ ***           jobs = a manifest, threads = host cores by default, repeat  ***
+ ***           = run the list that many times (for throughput runs)        ***
+ ***                                                                       ***
+ *** Returns 1 when a job did not pass.                                    ***
+ *****************************************************************************/
+int BatchMain(const C64ROMSet* rom, int argc, char** argv)
+{
+	TestCase6510* tests = NULL;
+	TestCase6510* jobs;
+	int threads = (argc >= 2) ? atoi(argv[1]) : HostCores();
+	int repeat = (argc >= 3) ? atoi(argv[2]) : 1;
+	int count;
+	int result;
+
+	if (argc < 1 || threads < 1 || repeat < 1)
+	{
+		printf("usage: 6502 batch <jobs> [threads] [repeat]\n");
+		return 1;
+	}
+	count = LoadTestManifest6510(argv[0], &tests);
+	if (count < 0)
+		return 1;
+	if (count == 0 || (int64_t)count * repeat > 0x7FFFFFFF)
+	{
+		printf("error: %s has no jobs or too many\n", argv[0]);
+		FreeTestManifest6510(tests, count);
+		return 1;
+	}
+	jobs = (TestCase6510*)malloc((size_t)count * repeat * sizeof(TestCase6510));
+	if (jobs == NULL)
+	{
+		FreeTestManifest6510(tests, count);
+		return 1;
+	}
+	for (int i = 0; i < repeat; i++)
+		memcpy(jobs + (size_t)count * i, tests, count * sizeof(TestCase6510));
+
+	result = RunBatch(rom, jobs, count * repeat, threads);
+	free(jobs);
+	FreeTestManifest6510(tests, count);
+	return result;
+}
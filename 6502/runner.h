@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "6502.h"
+
+/*
+	Conformance runner
+
+	A manifest lists test programs, one per line:
+
+		name  file  load  entry  result  expected  [max instructions [max cycles]]
+
+	load is the hex address of a headerless file, or prg for a PRG file
+	that starts with its load address. entry and result are hex addresses,
+	expected is the hex byte the program leaves at result when it passes.
+	The program is loaded into a cleared machine (Reset6510) and run from
+	entry until it halts on BRK or reaches a limit: max instructions
+	(TEST_MAX_INSTRUCTIONS when left out) or max cycles, 0 = no limit.
+
+	After a line "archive <file>" the files are members of that archive
+	(see C64_WriteArchive), "archive -" goes back to files. Empty lines and
+	lines starting with '#' are skipped.
+
+	Batch: the same list run as jobs on a pool of threads, see BatchMain.
+*/
+#define TEST_NAME				32
+#define TEST_FILE				256
+#define TEST_MAX_INSTRUCTIONS	100000000ULL
+#define TEST_MANIFEST			"./test_files/tests.txt"
+
+typedef enum TestStatus6510 {
+	TEST_PASS,
+	TEST_FAIL,     // halted with the wrong byte at result
+	TEST_TIMEOUT,  // still running after max instructions or cycles
+	TEST_ERROR     // file not found
+} TestStatus6510;
+
+typedef struct TestCase6510 {
+	char     name[TEST_NAME];
+	char     file[TEST_FILE];
+	C64Archive *archive;        // file is a member of it, NULL = a file
+	int      member;
+	int32_t  load;              // C64_PRG_HEADER = from the file
+	uint16_t entry;
+	uint16_t result;
+	uint8_t  expected;
+	uint64_t max_instructions; // 0 = no limit
+	uint64_t max_cycles;       // 0 = no limit
+} TestCase6510;
+
+typedef struct TestResult6510 {
+	TestStatus6510 status;
+	uint8_t  value;         // byte at result when the program stopped
+	uint64_t instructions;
+	uint64_t cycles;
+	double   seconds;
+} TestResult6510;
+
+int LoadTestManifest6510(const char* filename, TestCase6510** tests);
+void FreeTestManifest6510(TestCase6510* tests, int count);
+int LoadTest6510(State6510* state, const TestCase6510* test);
+void RunTest6510(State6510* state, const TestCase6510* test, TestResult6510* result);
+int TestMain(const C64ROMSet* rom, int argc, char** argv);
+int BatchMain(const C64ROMSet* rom, int argc, char** argv);
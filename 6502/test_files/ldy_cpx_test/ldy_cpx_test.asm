@@ -0,0 +1,34 @@
+// verify ldy $ff and cpx $ff (zero page)
+//
+// stops on brk with error = 0 if the test passes, error = 1 if the test fails
+//
+// ldy zp loads y and leaves x alone, cpx zp compares x with the byte at
+// the zero page address itself (not at the address plus x).
+//
+BasicUpstart2(test)
+
+test:
+     lda #1
+     sta error   // store 1 in error until the test passes
+     lda #$42
+     sta $10
+     lda #$07
+     sta $11
+     ldx #$07
+     ldy #$00
+     ldy $10     // y = $42, x stays $07
+     cpy #$42
+     bne done
+     cpx #$07
+     bne done
+     cpx $11     // $07 - $07: z = 1
+     bne done
+     ldx #$06
+     cpx $11     // $06 - $07: c = 0
+     bcs done
+     lda #0
+     sta error   // all tests pass, so store 0 in error
+done:
+     brk
+
+error: .byte 0
@@ -0,0 +1,83 @@
+// verify the stack bytes of jsr, rts and txs, and the wrap inside page 1
+//
+// stops on brk with error = 0 if the test passes, error = 1 if the test fails
+//
+// jsr pushes the address of its own last byte, high byte first, so the
+// high byte ends up at the higher address. the stack is always in page 1:
+// a push at $0100 goes on at $01ff and a pull at $01ff goes on at $0100.
+//
+BasicUpstart2(test)
+
+test:
+     lda #1
+     sta error   // store 1 in error until the test passes
+     ldx #$f0
+     txs         // the stack pointer is $01f0 (not $00f0)
+     jsr sub
+back:
+     tsx
+     cpx #$f0    // rts pulled both bytes again
+     bne done
+//
+// push and pull across the bottom of page 1
+//
+     ldx #$00
+     txs         // the stack pointer is $0100
+     lda #$55
+     pha         // to $0100
+     pha         // to $01ff, not $00ff in zero page
+     tsx
+     cpx #$fe
+     bne done
+     lda $01ff
+     cmp #$55
+     bne done
+     pla         // from $01ff
+     pla         // from $0100
+     tsx
+     cpx #$00
+     bne done
+     jsr wrap    // high byte to $0100, low byte to $01ff
+wrapback:
+     tsx
+     cpx #$00    // rts pulled from $01ff and $0100
+     bne done
+     lda #0
+     sta error   // all tests pass, so store 0 in error
+done:
+     brk
+//
+// check what jsr pushed: back - 1 at $01ef (low) and $01f0 (high)
+//
+sub:
+     lda $01f0
+     cmp #>(back - 1)
+     bne fail
+     lda $01ef
+     cmp #<(back - 1)
+     bne fail
+     tsx
+     cpx #$ee    // two bytes pushed
+     bne fail
+     rts         // returns to back when it pulls the bytes in the right order
+fail:
+     pla         // drop the return address, error stays 1
+     pla
+     jmp done
+//
+// check what jsr pushed at the bottom of page 1: wrapback - 1 at $01ff (low) and $0100 (high)
+//
+wrap:
+     lda $0100
+     cmp #>(wrapback - 1)
+     bne wrapfail
+     lda $01ff
+     cmp #<(wrapback - 1)
+     bne wrapfail
+     rts         // returns to wrapback when the pulls wrap too
+wrapfail:
+     pla         // drop the return address, error stays 1
+     pla
+     jmp done
+
+error: .byte 0
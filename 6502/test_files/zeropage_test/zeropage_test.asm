@@ -0,0 +1,56 @@
+// verify that zero page indexing wraps around inside page zero
+//
+// stops on brk with error = 0 if the test passes, error = 1 if the test fails
+//
+// $f0,x with x = $20 is $10, not $0110. the same holds for zp,y and for
+// the pointers of (zp,x) and (zp),y: a pointer at $ff takes its high
+// byte from $00 (the data direction register, $2f after a reset).
+//
+BasicUpstart2(test)
+
+test:
+     lda #1
+     sta error   // store 1 in error until the test passes
+     lda #$5a
+     sta $10     // what lda $f0,x must read
+     lda #0
+     sta $0110   // and what it must not
+     ldx #$20
+     lda $f0,x   // zp,x read
+     cmp #$5a
+     bne done
+     lda #$a5
+     sta $f1,x   // zp,x write lands in $11
+     lda $11
+     cmp #$a5
+     bne done
+     lda #$3c
+     sta $12
+     ldy #$20
+     ldx $f2,y   // zp,y read
+     cpx #$3c
+     bne done
+     lda #$40    // pointer at $20/$21 to $0340
+     sta $20
+     lda #$03
+     sta $21
+     lda #$77
+     sta $0340
+     ldx #$40
+     lda ($e0,x) // pointer at $e0 + $40 = $20
+     cmp #$77
+     bne done
+     lda #$80    // pointer at $ff/$00 to $2f80
+     sta $ff
+     lda #$99
+     sta $2f81
+     ldy #1
+     lda ($ff),y
+     cmp #$99
+     bne done
+     lda #0
+     sta error   // all tests pass, so store 0 in error
+done:
+     brk
+
+error: .byte 0
@@ -0,0 +1,256 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "trace.h"
+#include "platform.h"
+
+/*****************************************************************************
+ *** Ring buffer                                                           ***
+ *****************************************************************************/
+/*
+  Makes the records written so far visible to the thread
+*/
+void TracePublish6510(Trace6510* trace)
+{
+	AtomicStore64(&trace->published, trace->head);
+}
+
+/*
+  Called by the core when head reaches limit: publishes and waits until
+  there is room for at least one more record.
+*/
+void TraceReserve6510(Trace6510* trace)
+{
+	uint64_t end;
+
+	TracePublish6510(trace);
+	while (trace->head - AtomicLoad64(&trace->tail) >= TRACE_RECORDS)
+	{
+		trace->stalls++;
+		SleepMilliseconds(1);
+	}
+	end = AtomicLoad64(&trace->tail) + TRACE_RECORDS;
+	trace->limit = (end - trace->head > TRACE_PUBLISH) ? trace->head + TRACE_PUBLISH : end;
+}
+
+/*
+  The thread: writes published records to the file until it is stopped
+  and has caught up
+*/
+static void TraceDrain(void* arg)
+{
+	Trace6510* trace = (Trace6510*)arg;
+
+	for (;;)
+	{
+		uint64_t stop = AtomicLoad64(&trace->stop);
+		uint64_t published = AtomicLoad64(&trace->published);
+		uint64_t tail = trace->tail;
+
+		if (tail == published)
+		{
+			if (stop)
+				return;
+			SleepMilliseconds(1);
+			continue;
+		}
+		while (tail != published)
+		{
+			uint64_t index = tail & (TRACE_RECORDS - 1);
+			uint64_t count = published - tail;
+
+			if (count > TRACE_RECORDS - index)
+				count = TRACE_RECORDS - index;
+			if (!trace->error && fwrite(&trace->records[index], sizeof(TraceRecord6510), (size_t)count, trace->file) != count)
+				trace->error = 1;
+			tail += count;
+			AtomicStore64(&trace->tail, tail);
+		}
+	}
+}
+
+/*****************************************************************************
+ *** START TRACE: Write every instruction of the machine to a file         ***
+ ***                                                                       ***
+ *** returns 0 when the trace runs                                         ***
+ *****************************************************************************/
+int StartTrace6510(State6510* state, const char* filename)
+{
+	Trace6510* trace;
+	uint32_t header[2] = { sizeof(TraceRecord6510), 0 };
+
+	if (state->trace != NULL)
+		return 1;
+	trace = (Trace6510*)calloc(1, sizeof(Trace6510));
+	if (trace == NULL)
+		return 1;
+	trace->records = (TraceRecord6510*)malloc(TRACE_RECORDS * sizeof(TraceRecord6510));
+	trace->file = fopen(filename, "wb");
+	if (trace->records == NULL || trace->file == NULL)
+	{
+		printf("error: Couldn't start the trace to %s\n", filename);
+		if (trace->file != NULL)
+			fclose(trace->file);
+		free(trace->records);
+		free(trace);
+		return 1;
+	}
+	fwrite(TRACE_MAGIC, 1, 8, trace->file);
+	fwrite(header, sizeof(header), 1, trace->file);
+	trace->limit = TRACE_PUBLISH;
+	if (StartThread(&trace->thread, TraceDrain, trace))
+	{
+		fclose(trace->file);
+		free(trace->records);
+		free(trace);
+		return 1;
+	}
+	state->trace = trace;
+	return 0;
+}
+
+/*****************************************************************************
+ *** STOP TRACE: Write the rest of the records and close the file          ***
+ ***                                                                       ***
+ *** returns 0 when all records were written                               ***
+ *****************************************************************************/
+int StopTrace6510(State6510* state)
+{
+	Trace6510* trace = state->trace;
+	int error;
+
+	if (trace == NULL)
+		return 1;
+	TracePublish6510(trace);
+	AtomicStore64(&trace->stop, 1);
+	JoinThread(trace->thread);
+	error = trace->error | (fclose(trace->file) != 0);
+	if (trace->stalls > 0)
+		printf("trace: %llu records, waited %llu times for the disk\n",
+			(unsigned long long)trace->head, (unsigned long long)trace->stalls);
+	free(trace->records);
+	free(trace);
+	state->trace = NULL;
+	return error;
+}
+
+/*****************************************************************************
+ *** RENDER TRACE: Print a trace file as text                              ***
+ ***                                                                       ***
+ *** One line per record: the instruction, then the flags and registers    ***
+ *** before it. The lines are collected in a buffer and written in large   ***
+ *** chunks.                                                               ***
+ *****************************************************************************/
+#define RENDER_LINE		128
+#define RENDER_BUFFER	(1 << 16)
+#define RENDER_RECORDS	4096
+
+static const char Hex[] = "0123456789ABCDEF";
+
+static char* PutRegister(char* p, const char* name, unsigned value, int digits)
+{
+	while (*name)
+		*p++ = *name++;
+	while (digits-- > 0)
+		*p++ = Hex[(value >> (digits * 4)) & 15];
+	return p;
+}
+
+/*
+  Writes the line for one record, returns its length. Formatted by hand,
+  printf would take most of the time here.
+*/
+static size_t RenderRecord(char* line, const TraceRecord6510* record)
+{
+	static const char flags[] = "NV_BDIZC";
+	char digits[20];
+	char* p = line;
+	uint64_t cycles = record->cycles;
+	int n = 0;
+
+	DisassembleInstruction6510(record->pc, record->opcode, p);
+	p += strlen(p);
+	while (p < line + 26)
+		*p++ = ' ';
+	*p++ = ' ';
+	for (int bit = 0; bit < 8; bit++)
+	{
+		uint8_t set = record->p & (0x80 >> bit);
+
+		if (bit == 2)
+			*p++ = set ? '_' : '0';
+		else
+			*p++ = set ? flags[bit] : (char)(flags[bit] + 'a' - 'A');
+	}
+	p = PutRegister(p, " A=$", record->a, 2);
+	p = PutRegister(p, ",X=$", record->x, 2);
+	p = PutRegister(p, ",Y=$", record->y, 2);
+	p = PutRegister(p, ",SP=$", record->sp, 4);
+	p = PutRegister(p, ",SR=$", record->p, 2);
+	p = PutRegister(p, ",cycles=", 0, 0);
+	do
+	{
+		digits[n++] = (char)('0' + cycles % 10);
+		cycles /= 10;
+	}
+	while (cycles != 0);
+	while (n > 0)
+		*p++ = digits[--n];
+	*p++ = '\n';
+	return (size_t)(p - line);
+}
+
+int RenderTrace6510(const char* filename)
+{
+	FILE* f = fopen(filename, "rb");
+	char magic[8];
+	uint32_t header[2];
+	TraceRecord6510* records;
+	char* buffer;
+	size_t used = 0;
+	size_t count;
+
+	if (f == NULL)
+	{
+		printf("error: Couldn't open %s\n", filename);
+		return 1;
+	}
+	if (fread(magic, 1, 8, f) != 8 || memcmp(magic, TRACE_MAGIC, 8) != 0 ||
+		fread(header, sizeof(header), 1, f) != 1 || header[0] != sizeof(TraceRecord6510))
+	{
+		printf("error: %s is not a trace file\n", filename);
+		fclose(f);
+		return 1;
+	}
+	buffer = (char*)malloc(RENDER_BUFFER);
+	records = (TraceRecord6510*)malloc(RENDER_RECORDS * sizeof(TraceRecord6510));
+	if (buffer == NULL || records == NULL)
+	{
+		free(buffer);
+		free(records);
+		fclose(f);
+		return 1;
+	}
+
+	while ((count = fread(records, sizeof(TraceRecord6510), RENDER_RECORDS, f)) > 0)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			if (RENDER_BUFFER - used < RENDER_LINE)
+			{
+				fwrite(buffer, 1, used, stdout);
+				used = 0;
+			}
+			used += RenderRecord(buffer + used, &records[i]);
+		}
+	}
+	fwrite(buffer, 1, used, stdout);
+
+	free(records);
+	free(buffer);
+	fclose(f);
+	return 0;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "platform.h"
+
+/*
+	Binary instruction trace
+
+	While a trace runs, the core writes one record per instruction, before
+	running it, into a ring buffer in memory. A background thread writes
+	the records to a file. Only the core writes and only the thread reads,
+	so the ring needs no lock: the core publishes how far it has written
+	every TRACE_PUBLISH records and the thread how far it has read.
+	The core only waits when the ring is full (the disk can't keep up).
+
+	File: "6510TRC1", the record size (uint32), 4 reserved bytes, then the
+	records as below, little endian.
+*/
+#define TRACE_RECORDS		(1 << 20)	// ring size, power of two
+#define TRACE_PUBLISH		1024
+#define TRACE_MAGIC			"6510TRC1"
+
+typedef struct TraceRecord6510 {
+	uint64_t cycles;    // before the instruction
+	uint16_t pc;
+	uint16_t sp;
+	uint8_t  opcode[3]; // instruction bytes, the ones after the instruction are undefined
+	uint8_t  a;
+	uint8_t  x;
+	uint8_t  y;
+	uint8_t  p;         // status register NV_BDIZC
+	uint8_t  reserved[5];
+} TraceRecord6510;
+
+struct Trace6510 {
+	TraceRecord6510 *records;
+	uint64_t head;                // core: next record to write
+	uint64_t limit;               // core: can write up to here without looking at tail
+	volatile uint64_t published;  // records the thread may read
+	volatile uint64_t tail;       // thread: records written to the file
+	volatile uint64_t stop;
+	uint64_t stalls;              // times the core waited for the thread
+	FILE *file;
+	Thread6510 thread;
+	int error;                    // thread: writing the file failed
+};
+
+int StartTrace6510(State6510* state, const char* filename);
+int StopTrace6510(State6510* state);
+void TraceReserve6510(Trace6510* trace);
+void TracePublish6510(Trace6510* trace);
+int RenderTrace6510(const char* filename);
@@ -0,0 +1,954 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "6502.h"
+#include "vic.h"
+
+#ifndef VIC_SIMD
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VIC_SIMD 1
+#else
+#define VIC_SIMD 0
+#endif
+#endif
+
+#if VIC_SIMD
+#include <emmintrin.h>
+#endif
+
+/*****************************************************************************
+ *** VIC-II 6569: PAL, 312 raster lines of 63 cycles                       ***
+ ***                                                                       ***
+ *** An event at the end of every line renders it (with a screen), moves   ***
+ *** the raster on and raises the raster IRQ. Everything is done for the   ***
+ *** whole line from what the registers and memory hold when it ends, a    ***
+ *** change in the middle of a line shows on all of it. The light pen and  ***
+ *** the cycles of the bad lines and sprite fetches are not there. The     ***
+ *** text rows are placed by YSCROLL as it is on each line.                ***
+ *****************************************************************************/
+#define VIC_DISPLAY_FIRST	0x30	// first line that can be a bad line
+
+const uint8_t VICPalette[16][3] = {
+	{ 0x00, 0x00, 0x00 }, { 0xFF, 0xFF, 0xFF }, { 0x68, 0x37, 0x2B }, { 0x70, 0xA4, 0xB2 },
+	{ 0x6F, 0x3D, 0x86 }, { 0x58, 0x8D, 0x43 }, { 0x35, 0x28, 0x79 }, { 0xB8, 0xC7, 0x6F },
+	{ 0x6F, 0x4F, 0x25 }, { 0x43, 0x39, 0x00 }, { 0x9A, 0x67, 0x59 }, { 0x44, 0x44, 0x44 },
+	{ 0x6C, 0x6C, 0x6C }, { 0x9A, 0xD2, 0x84 }, { 0x6C, 0x5E, 0xB5 }, { 0x95, 0x95, 0x95 },
+};
+
+static uint8_t ReadVIC(State6510* state, uint16_t address);
+static void WriteVIC(State6510* state, uint16_t address, uint8_t value);
+static void WriteY4MFrame(Screen6569* screen);
+
+static uint16_t CurrentRaster(const State6510* state)
+{
+	const VIC6569* vic = &state->vic;
+
+	// The line event may not have run yet
+	return (uint16_t)((vic->raster + (state->cycles - vic->line_start) / C64_CYCLES_PER_LINE) % C64_RASTER_LINES);
+}
+
+static void UpdateIRQ(State6510* state)
+{
+	C64_SetIRQ(state, C64_IRQ_VIC, (state->vic.irq & state->vic.mask & 0x0F) != 0);
+}
+
+/*****************************************************************************
+ *** MEMORY: what the VIC sees in its 16K bank                             ***
+ ***                                                                       ***
+ *** The bank is selected by the inverted bits 0 - 1 of port A of CIA 2.   ***
+ *** The VIC always reads RAM, except $1000 - $1FFF of banks 0 and 2 where ***
+ *** it sees the char ROM. Colour RAM is kept at $D800 of state->memory,   ***
+ *** that page is never shared with a snapshot.                            ***
+ *****************************************************************************/
+static uint16_t VICBank(const State6510* state)
+{
+	const CIA6526* cia = &state->cia[1];
+
+	return (uint16_t)((~(cia->pra | ~cia->ddra) & 0x03) << 14);
+}
+
+static uint8_t VICByte(const State6510* state, uint16_t address)
+{
+	uint8_t page = address >> 8;
+	const uint8_t* ram = state->cow[page] != NULL ? state->cow[page] : state->memory + (page << 8);
+
+	if ((address & 0x7000) == 0x1000 && state->rom != NULL)
+		return state->rom->pCharROM[address & 0x0FFF];
+	return ram[address & 0xFF];
+}
+
+/*
+  Bad line: the screen codes and colours of a text row, the real chip
+  reads them on the first line of the row
+*/
+static void FetchRow(State6510* state, int row)
+{
+	VIC6569* vic = &state->vic;
+	uint16_t matrix = VICBank(state) | ((vic->regs[0x18] & 0xF0) << 6);
+
+	for (int column = 0; column < 40; column++)
+	{
+		vic->matrix[column] = VICByte(state, (uint16_t)(matrix + row * 40 + column));
+		vic->colors[column] = state->memory[0xD800 + row * 40 + column] & 0x0F;
+	}
+	vic->fetched = (uint16_t)(matrix + row * 40);
+}
+
+/*****************************************************************************
+ *** PIXELS: one row of 8 pixel wide cells from the bytes of their glyphs  ***
+ ***                                                                       ***
+ *** Hires: bit 1 = fg, 0 = bg. Multicolor: pairs of bits, double wide     ***
+ *** pixels of c0 - c3. Every cell has colours of its own. With SSE2 two   ***
+ *** cells are done at a time: their bytes spread over 8 lanes each, the   ***
+ *** bits (or pairs) of a pixel picked out and compared into masks that    ***
+ *** select the colours.                                                   ***
+ *****************************************************************************/
+static void HiresCell(uint8_t* out, uint8_t bits, uint8_t fg, uint8_t bg)
+{
+	for (int x = 0; x < 8; x++)
+		out[x] = (bits & (0x80 >> x)) ? fg : bg;
+}
+
+static void MulticolorCell(uint8_t* out, uint8_t bits, uint8_t c0, uint8_t c1, uint8_t c2, uint8_t c3)
+{
+	const uint8_t colors[4] = { c0, c1, c2, c3 };
+
+	for (int x = 0; x < 8; x += 2)
+		out[x] = out[x + 1] = colors[(bits >> (6 - x)) & 0x03];
+}
+
+#if VIC_SIMD
+/*
+  a in lanes 0 - 7, b in lanes 8 - 15
+*/
+static __m128i Spread2(uint8_t a, uint8_t b)
+{
+	__m128i v = _mm_cvtsi32_si128(a | (b << 8));
+
+	v = _mm_unpacklo_epi8(v, v);
+	v = _mm_unpacklo_epi16(v, v);
+	return _mm_unpacklo_epi32(v, v);
+}
+
+static __m128i Select(__m128i mask, __m128i a, __m128i b)
+{
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static void HiresRow(uint8_t* out, const uint8_t* bits, const uint8_t* fg, const uint8_t* bg, int count)
+{
+	const __m128i pixel = _mm_set_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+	int i;
+
+	for (i = 0; i + 2 <= count; i += 2)
+	{
+		__m128i set = _mm_cmpeq_epi8(_mm_and_si128(Spread2(bits[i], bits[i + 1]), pixel), pixel);
+
+		_mm_storeu_si128((__m128i*)(out + i * 8), Select(set, Spread2(fg[i], fg[i + 1]), Spread2(bg[i], bg[i + 1])));
+	}
+	for (; i < count; i++)
+		HiresCell(out + i * 8, bits[i], fg[i], bg[i]);
+}
+
+static void MulticolorRow(uint8_t* out, const uint8_t* bits, const uint8_t* c0, const uint8_t* c1,
+	const uint8_t* c2, const uint8_t* c3, int count)
+{
+	const __m128i pair = _mm_set_epi8(3, 3, 12, 12, 48, 48, -64, -64, 3, 3, 12, 12, 48, 48, -64, -64);
+	const __m128i is01 = _mm_set_epi8(1, 1, 4, 4, 16, 16, 64, 64, 1, 1, 4, 4, 16, 16, 64, 64);
+	const __m128i is10 = _mm_set_epi8(2, 2, 8, 8, 32, 32, -128, -128, 2, 2, 8, 8, 32, 32, -128, -128);
+	int i;
+
+	for (i = 0; i + 2 <= count; i += 2)
+	{
+		__m128i value = _mm_and_si128(Spread2(bits[i], bits[i + 1]), pair);
+		__m128i pixels = Spread2(c0[i], c0[i + 1]);
+
+		pixels = Select(_mm_cmpeq_epi8(value, is01), Spread2(c1[i], c1[i + 1]), pixels);
+		pixels = Select(_mm_cmpeq_epi8(value, is10), Spread2(c2[i], c2[i + 1]), pixels);
+		pixels = Select(_mm_cmpeq_epi8(value, pair), Spread2(c3[i], c3[i + 1]), pixels);
+		_mm_storeu_si128((__m128i*)(out + i * 8), pixels);
+	}
+	for (; i < count; i++)
+		MulticolorCell(out + i * 8, bits[i], c0[i], c1[i], c2[i], c3[i]);
+}
+#else
+static void HiresRow(uint8_t* out, const uint8_t* bits, const uint8_t* fg, const uint8_t* bg, int count)
+{
+	for (int i = 0; i < count; i++)
+		HiresCell(out + i * 8, bits[i], fg[i], bg[i]);
+}
+
+static void MulticolorRow(uint8_t* out, const uint8_t* bits, const uint8_t* c0, const uint8_t* c1,
+	const uint8_t* c2, const uint8_t* c3, int count)
+{
+	for (int i = 0; i < count; i++)
+		MulticolorCell(out + i * 8, bits[i], c0[i], c1[i], c2[i], c3[i]);
+}
+#endif
+
+/*****************************************************************************
+ *** RENDER: one raster line into the screen                               ***
+ ***                                                                       ***
+ *** Mode = ECM, BMM ($D011 bits 6, 5) and MCM ($D016 bit 4):              ***
+ ***   0 text             glyph bit: colour RAM / $D021                    ***
+ ***   1 multicolor text  colour RAM bit 3 = 0: as text, 1: pairs of       ***
+ ***                      $D021, $D022, $D023, colour RAM bits 0 - 2       ***
+ ***   2 bitmap           bit: screen high nibble / low nibble             ***
+ ***   3 multicolor bitmap pairs of $D021, screen high, low, colour RAM    ***
+ ***   4 extended colour  glyph of code & $3F on $D021 - $D024 by code >> 6***
+ ***   5 - 7 invalid      black                                            ***
+ *****************************************************************************/
+static int FetchGraphics(State6510* state, int line, uint8_t bits[40])
+{
+	VIC6569* vic = &state->vic;
+	uint8_t* regs = vic->regs;
+	int y = line - VIC_DISPLAY_FIRST - (regs[0x11] & 0x07);
+	int mode = ((regs[0x11] >> 4) & 0x06) | ((regs[0x16] >> 4) & 0x01);
+	uint16_t chars = VICBank(state) | ((regs[0x18] & 0x0E) << 10);
+	uint16_t bitmap = VICBank(state) | ((regs[0x18] & 0x08) << 10);
+
+	// Idle: no text row on this line
+	if (vic->border || !vic->display || y < 0 || y >= 200)
+		return -1;
+	for (int column = 0; column < 40; column++)
+	{
+		if (mode & 0x02)
+			bits[column] = VICByte(state, (uint16_t)(bitmap + ((y >> 3) * 40 + column) * 8 + (y & 7)));
+		else
+			bits[column] = VICByte(state, (uint16_t)(chars + (vic->matrix[column] & (mode & 0x04 ? 0x3F : 0xFF)) * 8 + (y & 7)));
+	}
+	return mode;
+}
+
+static void RenderGraphics(State6510* state, int mode, const uint8_t* bits, uint8_t* out)
+{
+	VIC6569* vic = &state->vic;
+	uint8_t* regs = vic->regs;
+	uint8_t background = regs[0x21] & 0x0F;
+	int xscroll = regs[0x16] & 0x07;
+	uint8_t c0[40], c1[40], c2[40], c3[40];
+
+	if (mode < 0)
+	{
+		memset(out, background, 320 + xscroll);
+		return;
+	}
+	memset(out, background, xscroll);
+	out += xscroll;
+	for (int column = 0; column < 40; column++)
+	{
+		uint8_t code = vic->matrix[column];
+		uint8_t color = vic->colors[column];
+
+		switch (mode)
+		{
+		case 0:
+		case 1:
+			c0[column] = background;
+			c1[column] = regs[0x22] & 0x0F;
+			c2[column] = regs[0x23] & 0x0F;
+			c3[column] = color & 0x07;
+			break;
+		case 2:
+			c0[column] = code & 0x0F;
+			c1[column] = code >> 4;
+			break;
+		case 3:
+			c0[column] = background;
+			c1[column] = code >> 4;
+			c2[column] = code & 0x0F;
+			c3[column] = color;
+			break;
+		case 4:
+			c0[column] = regs[0x21 + (code >> 6)] & 0x0F;
+			c1[column] = color;
+			break;
+		}
+	}
+
+	switch (mode)
+	{
+	case 0:
+		HiresRow(out, bits, vic->colors, c0, 40);
+		break;
+	case 1:
+		MulticolorRow(out, bits, c0, c1, c2, c3, 40);
+		// The cells with bit 3 of the colour clear are hires after all
+		for (int column = 0; column < 40; column++)
+			if (!(vic->colors[column] & 0x08))
+				HiresCell(out + column * 8, bits[column], vic->colors[column], background);
+		break;
+	case 2:
+	case 4:
+		HiresRow(out, bits, c1, c0, 40);
+		break;
+	case 3:
+		MulticolorRow(out, bits, c0, c1, c2, c3, 40);
+		break;
+	default:
+		memset(out, 0, 320);
+		break;
+	}
+}
+
+/*****************************************************************************
+ *** SPRITES                                                               ***
+ ***                                                                       ***
+ *** A line is a row of bits, one per pixel from X = 0 (24 pixels left of  ***
+ *** the display window), the leftmost in bit 63 of the first word. Every  ***
+ *** sprite on the line is its 24 bits (48 expanded) of opaque pixels put  ***
+ *** at its X, the graphics are the bits of their foreground pixels. The   ***
+ *** collisions are ANDs of those words: the pixels two sprites cover are  ***
+ *** collected over all sprites in one pass, a sprite collides if it has   ***
+ *** one of them, or one of the foreground.                                ***
+ *****************************************************************************/
+#define VIC_LINE_WORDS		9		// X up to 511 + 48 pixels
+
+typedef struct SpriteLine {
+	uint8_t  on;            // sprites shown on the line, a bit each
+	uint32_t data[8];       // their 3 bytes, the leftmost pixel in bit 23
+	uint64_t mask[8][2];    // opaque pixels, in line words word[n] and word[n] + 1
+	int      word[8];
+} SpriteLine;
+
+static int SpriteX(const uint8_t* regs, int n)
+{
+	return regs[n * 2] | (((regs[0x10] >> n) & 1) << 8);
+}
+
+/*
+  Or the width leftmost bits of value into the line at pixel x
+*/
+static void PlaceBits(uint64_t* words, int x, uint64_t value, int width)
+{
+	int shift = 64 - (x & 63) - width;
+
+	if (shift >= 0)
+		words[x >> 6] |= value << shift;
+	else
+	{
+		words[x >> 6] |= value >> -shift;
+		words[(x >> 6) + 1] |= value << (64 + shift);
+	}
+}
+
+/*
+  Every bit twice: 24 bits to 48 for a sprite expanded in X
+*/
+static uint64_t DoubleBits(uint32_t bits)
+{
+	uint64_t x = bits;
+
+	x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+	x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+	x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+	x = (x | (x << 2)) & 0x3333333333333333ull;
+	x = (x | (x << 1)) & 0x5555555555555555ull;
+	return x | (x << 1);
+}
+
+/*
+  Moves the sprites on by the line: a sprite starts when the line before
+  matched its Y and stops after 21 rows. Fetches the rows shown.
+*/
+static void FetchSprites(State6510* state, int line, SpriteLine* sprites)
+{
+	VIC6569* vic = &state->vic;
+	uint8_t* regs = vic->regs;
+	uint16_t bank = VICBank(state);
+	uint16_t pointers = bank | ((regs[0x18] & 0xF0) << 6) | 0x3F8;
+	int previous = (line + C64_RASTER_LINES - 1) % C64_RASTER_LINES;
+
+	sprites->on = 0;
+	for (int n = 0; n < 8; n++)
+	{
+		int expand = (regs[0x17] >> n) & 1;
+		uint16_t address;
+		uint32_t data;
+		uint64_t opaque, mask[2] = { 0, 0 };
+		int width = 24;
+		int x;
+
+		if (!(regs[0x15] & (1 << n)))
+		{
+			vic->sprite_line[n] = 0;
+			continue;
+		}
+		if (vic->sprite_line[n] == 0)
+		{
+			if (regs[n * 2 + 1] != (previous & 0xFF))
+				continue;
+			vic->sprite_line[n] = 1;
+		}
+
+		address = (uint16_t)(bank | (VICByte(state, (uint16_t)(pointers + n)) << 6) | ((vic->sprite_line[n] - 1) >> expand) * 3);
+		data = (VICByte(state, address) << 16) | (VICByte(state, (uint16_t)(address + 1)) << 8) | VICByte(state, (uint16_t)(address + 2));
+		if (++vic->sprite_line[n] > (21 << expand))
+			vic->sprite_line[n] = 0;
+
+		opaque = data;
+		if (regs[0x1C] & (1 << n))
+		{
+			// Pairs of pixels, 00 is transparent
+			opaque = (data | (data >> 1)) & 0x555555;
+			opaque |= opaque << 1;
+		}
+		if (regs[0x1D] & (1 << n))
+		{
+			opaque = DoubleBits((uint32_t)opaque);
+			width = 48;
+		}
+		x = SpriteX(regs, n);
+		PlaceBits(mask, x & 63, opaque, width);
+		sprites->data[n] = data;
+		sprites->mask[n][0] = mask[0];
+		sprites->mask[n][1] = mask[1];
+		sprites->word[n] = x >> 6;
+		sprites->on |= 1 << n;
+	}
+}
+
+/*
+  The foreground pixels of the graphics: the 1 bits of hires, the pairs
+  10 and 11 of multicolor. None on an idle line.
+*/
+static void ForegroundMask(const State6510* state, int mode, const uint8_t* bits, uint64_t* foreground)
+{
+	const VIC6569* vic = &state->vic;
+	int x = 24 + (vic->regs[0x16] & 0x07);
+
+	memset(foreground, 0, VIC_LINE_WORDS * sizeof(uint64_t));
+	if (mode < 0)
+		return;
+	for (int column = 0; column < 40; column += 8)
+	{
+		uint64_t word = 0;
+
+		for (int i = column; i < column + 8; i++)
+		{
+			uint8_t byte = bits[i];
+
+			if ((mode & 0x01) && ((mode & 0x02) || (vic->colors[i] & 0x08)))
+			{
+				byte &= 0xAA;
+				byte |= byte >> 1;
+			}
+			word = (word << 8) | byte;
+		}
+		PlaceBits(foreground, x + column * 8, word, 64);
+	}
+}
+
+/*
+  Adds the collisions on the line to $D01E and $D01F, the first one
+  since the register was read raises its IRQ
+*/
+static void Collide(State6510* state, const SpriteLine* sprites, const uint64_t* foreground)
+{
+	VIC6569* vic = &state->vic;
+	uint64_t any[VIC_LINE_WORDS] = { 0 }, twice[VIC_LINE_WORDS] = { 0 };
+	uint8_t sprite = 0, background = 0;
+
+	if (sprites->on & (sprites->on - 1))
+	{
+		for (int n = 0; n < 8; n++)
+		{
+			int word = sprites->word[n];
+
+			if (!(sprites->on & (1 << n)))
+				continue;
+			twice[word] |= any[word] & sprites->mask[n][0];
+			twice[word + 1] |= any[word + 1] & sprites->mask[n][1];
+			any[word] |= sprites->mask[n][0];
+			any[word + 1] |= sprites->mask[n][1];
+		}
+	}
+	for (int n = 0; n < 8; n++)
+	{
+		int word = sprites->word[n];
+
+		if (!(sprites->on & (1 << n)))
+			continue;
+		if ((twice[word] & sprites->mask[n][0]) | (twice[word + 1] & sprites->mask[n][1]))
+			sprite |= 1 << n;
+		if ((foreground[word] & sprites->mask[n][0]) | (foreground[word + 1] & sprites->mask[n][1]))
+			background |= 1 << n;
+	}
+
+	if (sprite && !vic->regs[0x1E])
+		vic->irq |= 0x04;
+	if (background && !vic->regs[0x1F])
+		vic->irq |= 0x02;
+	vic->regs[0x1E] |= sprite;
+	vic->regs[0x1F] |= background;
+	if (sprite | background)
+		UpdateIRQ(state);
+}
+
+/*
+  The lowest sprite opaque on a pixel has it, even when it is behind the
+  foreground there and does not show
+*/
+static void DrawSprites(const State6510* state, const SpriteLine* sprites, const uint64_t* foreground, uint8_t* out)
+{
+	const uint8_t* regs = state->vic.regs;
+	uint64_t taken[VIC_LINE_WORDS] = { 0 };
+
+	for (int n = 0; n < 8; n++)
+	{
+		uint8_t colors[4] = { 0, regs[0x25] & 0x0F, regs[0x27 + n] & 0x0F, regs[0x26] & 0x0F };
+		int multicolor = (regs[0x1C] >> n) & 1;
+		int wide = (regs[0x1D] >> n) & 1;
+		int behind = (regs[0x1B] >> n) & 1;
+		int x = SpriteX(regs, n);
+
+		if (!(sprites->on & (1 << n)))
+			continue;
+		for (int pixel = 0; pixel < (24 << wide); pixel++, x++)
+		{
+			int bit = 23 - (pixel >> wide);
+			int column = x - 24 + VIC_BORDER_LEFT;
+			uint64_t at = 1ull << (63 - (x & 63));
+			int color;
+
+			if (column >= VIC_WIDTH)
+				break;
+			if (multicolor)
+				color = (sprites->data[n] >> (bit & ~1)) & 3;
+			else
+				color = ((sprites->data[n] >> bit) & 1) << 1;
+			if (!color || (taken[x >> 6] & at))
+				continue;
+			taken[x >> 6] |= at;
+			if (!(behind && (foreground[x >> 6] & at)))
+				out[column] = colors[color];
+		}
+	}
+}
+
+static void RenderLine(State6510* state, int line, int mode, const uint8_t* bits,
+	const SpriteLine* sprites, const uint64_t* foreground)
+{
+	uint8_t* out = state->screen->pixels[line - VIC_FIRST_LINE];
+	uint8_t border = state->vic.regs[0x20] & 0x0F;
+	// 38 columns (CSEL = 0): 7 pixels more border left, 9 right
+	int narrow = !(state->vic.regs[0x16] & 0x08);
+	int left = VIC_BORDER_LEFT + (narrow ? 7 : 0);
+	int right = VIC_BORDER_LEFT + (narrow ? 311 : 320);
+
+	if (state->vic.border)
+	{
+		memset(out, border, VIC_WIDTH);
+		return;
+	}
+	RenderGraphics(state, mode, bits, out + VIC_BORDER_LEFT);
+	if (sprites->on)
+		DrawSprites(state, sprites, foreground, out);
+	memset(out, border, left);
+	memset(out + right, border, VIC_WIDTH - right);
+}
+
+/*****************************************************************************
+ *** DIRTY TRACKING: render only the lines that changed, see vic.h         ***
+ ***                                                                       ***
+ *** screen->watched tells what the watched pages are for. When the VIC    ***
+ *** bank, $D018 or the bitmap mode change, other pages are watched and    ***
+ *** all rows are dirty.                                                   ***
+ *****************************************************************************/
+#define VIC_UNWATCHED		0xFFFFFFFF	// screen->watched: to be watched again
+#define VIC_WATCH_BITMAP	0x400		// screen->watched: the bitmap, not the chars
+
+static uint32_t WatchedFor(const State6510* state)
+{
+	const uint8_t* regs = state->vic.regs;
+
+	return (uint32_t)(VICBank(state) >> 14) | (regs[0x18] << 2) | ((regs[0x11] & 0x20) << 5);
+}
+
+static void WatchPages(State6510* state)
+{
+	Screen6569* screen = state->screen;
+	const uint8_t* regs = state->vic.regs;
+	uint16_t bank = VICBank(state);
+	uint8_t watch[256] = { 0 };
+	int page;
+
+	screen->watched = WatchedFor(state);
+	screen->matrix = bank | ((regs[0x18] & 0xF0) << 6);
+	screen->chars = bank | ((regs[0x18] & 0x0E) << 10);
+	screen->bitmap = bank | ((regs[0x18] & 0x08) << 10);
+	for (page = 0; page < 4; page++)
+		watch[0xD8 + page] = watch[(screen->matrix >> 8) + page] = 1;
+	if (screen->watched & VIC_WATCH_BITMAP)
+		for (page = 0; page < 32; page++)
+			watch[(screen->bitmap >> 8) + page] = 1;
+	else
+		for (page = 0; page < 8; page++)
+			watch[(screen->chars >> 8) + page] = 1;
+	for (page = 0x00; page <= 0xFF; page++)
+	{
+		// The VIC sees the char ROM there, not the RAM
+		if (((page << 8) & 0x7000) == 0x1000 && state->rom != NULL)
+			watch[page] = 0;
+		if (watch[page] != state->screenpage[page])
+			C64_WatchPage(state, (uint8_t)page, watch[page]);
+	}
+	screen->dirty = VIC_ALL_ROWS;
+}
+
+static void UnwatchPages(State6510* state)
+{
+	for (int page = 0x00; page <= 0xFF; page++)
+		if (state->screenpage[page])
+			C64_WatchPage(state, (uint8_t)page, 0);
+}
+
+/*
+  1 when the line has to be rendered: its registers (with where the
+  screen codes came from) are not the ones it was rendered with, or its
+  text row was written. Its row by YSCROLL and the row the screen codes
+  were fetched for differ when YSCROLL changed in between.
+*/
+static int LineChanged(State6510* state, int line, uint8_t sprites)
+{
+	Screen6569* screen = state->screen;
+	const VIC6569* vic = &state->vic;
+	uint8_t* last = screen->keys[line - VIC_FIRST_LINE];
+	uint8_t key[VIC_LINE_KEY];
+	int y = line - VIC_DISPLAY_FIRST - (vic->regs[0x11] & 0x07);
+	uint32_t rows = (1u << ((y >> 3) & 0x1F)) | (1u << (vic->fetched & 0x3FF) / 40);
+	int changed;
+
+	key[0] = vic->regs[0x11] & 0x7F;
+	key[1] = vic->regs[0x16];
+	key[2] = vic->regs[0x18];
+	memcpy(key + 3, vic->regs + 0x20, 5);
+	key[8] = VICBank(state) >> 8;
+	key[9] = vic->border | (vic->display << 1);
+	key[10] = vic->fetched & 0xFF;
+	key[11] = vic->fetched >> 8;
+	key[12] = sprites;
+	changed = memcmp(key, last, VIC_LINE_KEY) != 0;
+	// The sprites are not tracked, a line with one is always rendered
+	if (sprites)
+		changed = 1;
+	if (!vic->border && vic->display && y >= 0 && y < 200 && ((screen->dirty | screen->redraw) & rows))
+		changed = 1;
+	if (changed)
+		memcpy(last, key, VIC_LINE_KEY);
+	return changed;
+}
+
+/*
+  Renders every line of the next frames until the writes are seen again
+*/
+void C64_RedrawScreen(State6510* state)
+{
+	Screen6569* screen = state->screen;
+
+	if (screen == NULL)
+		return;
+	memset(screen->keys, 0xFF, sizeof(screen->keys));
+	screen->dirty = VIC_ALL_ROWS;
+	screen->watched = VIC_UNWATCHED;
+}
+
+/*
+  Called by the core after a write into a watched page: marks the text
+  row the byte is shown in
+*/
+void C64_ScreenWrite(State6510* state, uint16_t address)
+{
+	Screen6569* screen = state->screen;
+	uint16_t offset;
+
+	if (screen == NULL)
+		return;
+	offset = (uint16_t)(address - 0xD800);
+	if (offset < 1000)
+		screen->dirty |= 1u << (offset / 40);
+	offset = (uint16_t)(address - screen->matrix);
+	if (offset < 1000)
+		screen->dirty |= 1u << (offset / 40);
+	if (screen->watched & VIC_WATCH_BITMAP)
+	{
+		offset = (uint16_t)(address - screen->bitmap);
+		if (offset < 8000)
+			screen->dirty |= 1u << (offset / 320);
+	}
+	else if ((uint16_t)(address - screen->chars) < 0x800)
+		screen->dirty = VIC_ALL_ROWS;
+}
+
+/*****************************************************************************
+ *** LINE EVENT: the end of a raster line                                  ***
+ *****************************************************************************/
+static void LineEvent(State6510* state, int event, uint64_t cycle)
+{
+	VIC6569* vic = &state->vic;
+	int line = vic->raster;
+	// 25 rows (RSEL = 1): lines $33 - $FA, 24 rows: $37 - $F6
+	int top = (vic->regs[0x11] & 0x08) ? 0x33 : 0x37;
+	int bottom = (vic->regs[0x11] & 0x08) ? 0xFB : 0xF7;
+	int y = line - VIC_DISPLAY_FIRST - (vic->regs[0x11] & 0x07);
+	SpriteLine sprites;
+	uint64_t foreground[VIC_LINE_WORDS];
+	uint8_t bits[40];
+	int mode = -1, render = 0;
+
+	if (line == VIC_DISPLAY_FIRST)
+		vic->display = (vic->regs[0x11] & 0x10) != 0;
+	if (line == bottom)
+		vic->border = 1;
+	else if (line == top && (vic->regs[0x11] & 0x10))
+		vic->border = 0;
+	if (vic->display && y >= 0 && y < 200 && (y & 7) == 0)
+		FetchRow(state, y >> 3);
+
+	FetchSprites(state, line, &sprites);
+	if (state->screen != NULL && line >= VIC_FIRST_LINE && line < VIC_FIRST_LINE + VIC_HEIGHT)
+	{
+		if (state->screen->watched != WatchedFor(state))
+			WatchPages(state);
+		render = LineChanged(state, line, sprites.on) || state->screen->full;
+		if (render)
+			state->screen->rendered++;
+		else
+			state->screen->skipped++;
+	}
+	// Collisions are there without a screen too
+	if (render || sprites.on)
+		mode = FetchGraphics(state, line, bits);
+	if (sprites.on)
+	{
+		ForegroundMask(state, mode, bits, foreground);
+		Collide(state, &sprites, foreground);
+	}
+	if (render)
+		RenderLine(state, line, mode, bits, &sprites, foreground);
+
+	if (++vic->raster == C64_RASTER_LINES)
+	{
+		vic->raster = 0;
+		if (state->screen != NULL)
+		{
+			state->screen->frames++;
+			state->screen->redraw = state->screen->dirty;
+			state->screen->dirty = 0;
+			if (state->screen->video != NULL)
+				WriteY4MFrame(state->screen);
+		}
+	}
+	vic->line_start = cycle;
+	if (vic->raster == vic->compare)
+	{
+		vic->irq |= 0x01;
+		UpdateIRQ(state);
+	}
+	C64_ScheduleEvent(state, event, cycle + C64_CYCLES_PER_LINE, LineEvent);
+}
+
+/*****************************************************************************
+ *** REGISTERS: $D000 - $D03F, repeated up to $D3FF                        ***
+ *****************************************************************************/
+static uint8_t ReadVIC(State6510* state, uint16_t address)
+{
+	VIC6569* vic = &state->vic;
+	int reg = address & 0x3F;
+	uint16_t raster;
+	uint8_t value;
+
+	switch (reg)
+	{
+	case 0x11:
+		raster = CurrentRaster(state);
+		return (vic->regs[0x11] & 0x7F) | ((raster >> 1) & 0x80);
+	case 0x12: return CurrentRaster(state) & 0xFF;
+	case 0x16: return vic->regs[0x16] | 0xC0;
+	case 0x18: return vic->regs[0x18] | 0x01;
+	case 0x19: return vic->irq | 0x70 | ((vic->irq & vic->mask & 0x0F) ? 0x80 : 0);
+	case 0x1A: return vic->mask | 0xF0;
+	case 0x1E:
+	case 0x1F:
+		// Sprite collisions, cleared by reading
+		value = vic->regs[reg];
+		vic->regs[reg] = 0;
+		return value;
+	default:
+		if (reg >= 0x2F)
+			return 0xFF;
+		if (reg >= 0x20)
+			return vic->regs[reg] | 0xF0;
+		return vic->regs[reg];
+	}
+}
+
+static void WriteVIC(State6510* state, uint16_t address, uint8_t value)
+{
+	VIC6569* vic = &state->vic;
+	int reg = address & 0x3F;
+
+	switch (reg)
+	{
+	case 0x11:
+		vic->regs[0x11] = value;
+		vic->compare = (vic->compare & 0xFF) | ((value & 0x80) << 1);
+		break;
+	case 0x12:
+		vic->compare = (vic->compare & 0x100) | value;
+		break;
+	case 0x19:
+		// 1 bits acknowledge
+		vic->irq &= ~value & 0x0F;
+		UpdateIRQ(state);
+		break;
+	case 0x1A:
+		vic->mask = value & 0x0F;
+		UpdateIRQ(state);
+		break;
+	case 0x1E:
+	case 0x1F:
+		break;
+	default:
+		vic->regs[reg] = value;
+		break;
+	}
+}
+
+/*
+  The VIC to the state after a reset: all registers 0, the raster at the
+  top of the frame. Reset6510 resets it again, it stays attached.
+*/
+void C64_ResetVIC(State6510* state)
+{
+	memset(&state->vic, 0, sizeof(state->vic));
+	state->vic.border = 1;
+	state->vic.line_start = state->cycles;
+	C64_SetIRQ(state, C64_IRQ_VIC, 0);
+	C64_RedrawScreen(state);
+	if (state->chippeek[0] == ReadVIC)
+		C64_ScheduleEvent(state, C64_EVENT_VIC, state->cycles + C64_CYCLES_PER_LINE, LineEvent);
+	else
+		C64_CancelEvent(state, C64_EVENT_VIC);
+}
+
+/*
+  Puts the VIC at $D000 - $D3FF, reset. It runs the raster without a
+  screen, C64_StartScreen renders it.
+*/
+void C64_AttachVIC(State6510* state)
+{
+	for (int page = 0xD0; page <= 0xD3; page++)
+		C64_SetIOChip(state, (uint8_t)page, ReadVIC, WriteVIC);
+	C64_ResetVIC(state);
+}
+
+/*****************************************************************************
+ *** SCREEN: render the frames of the machine, see vic.h                   ***
+ ***                                                                       ***
+ *** returns 0 when the screen runs                                        ***
+ *****************************************************************************/
+int C64_StartScreen(State6510* state)
+{
+	if (state->screen != NULL)
+		return 1;
+	state->screen = (Screen6569*)calloc(1, sizeof(Screen6569));
+	if (state->screen == NULL)
+		return 1;
+	C64_RedrawScreen(state);
+	return 0;
+}
+
+/*
+  Stops the recording and drops the screen. Returns 0 when the video (if
+  any) was written completely.
+*/
+int C64_StopScreen(State6510* state)
+{
+	Screen6569* screen = state->screen;
+	int error;
+
+	if (screen == NULL)
+		return 1;
+	error = screen->error;
+	if (screen->video != NULL)
+		error |= fclose(screen->video) != 0;
+	UnwatchPages(state);
+	free(screen);
+	state->screen = NULL;
+	return error;
+}
+
+/*****************************************************************************
+ *** EXPORT: PPM (binary RGB) and Y4M (YUV 4:4:4, BT.601 video range)      ***
+ *****************************************************************************/
+int C64_SavePPM(const Screen6569* screen, const char* filename)
+{
+	FILE* f = fopen(filename, "wb");
+	uint8_t row[VIC_WIDTH * 3];
+	int error;
+
+	if (f == NULL)
+	{
+		printf("error: Couldn't write %s\n", filename);
+		return 1;
+	}
+	fprintf(f, "P6\n%d %d\n255\n", VIC_WIDTH, VIC_HEIGHT);
+	for (int y = 0; y < VIC_HEIGHT; y++)
+	{
+		for (int x = 0; x < VIC_WIDTH; x++)
+			memcpy(row + x * 3, VICPalette[screen->pixels[y][x]], 3);
+		fwrite(row, 1, sizeof(row), f);
+	}
+	error = ferror(f) != 0;
+	error |= fclose(f) != 0;
+	return error;
+}
+
+/*
+  Starts writing every frame that ends from now on to a Y4M file, until
+  C64_StopScreen
+*/
+int C64_RecordY4M(State6510* state, const char* filename)
+{
+	Screen6569* screen = state->screen;
+
+	if (screen == NULL || screen->video != NULL)
+		return 1;
+	screen->video = fopen(filename, "wb");
+	if (screen->video == NULL)
+	{
+		printf("error: Couldn't write %s\n", filename);
+		return 1;
+	}
+	fprintf(screen->video, "YUV4MPEG2 W%d H%d F%d:%d Ip A1:1 C444\n",
+		VIC_WIDTH, VIC_HEIGHT, C64_CYCLES_PER_SECOND, C64_CYCLES_PER_FRAME);
+	return 0;
+}
+
+static void WriteY4MFrame(Screen6569* screen)
+{
+	uint8_t yuv[3][16];
+	uint8_t row[VIC_WIDTH];
+
+	for (int i = 0; i < 16; i++)
+	{
+		int r = VICPalette[i][0], g = VICPalette[i][1], b = VICPalette[i][2];
+
+		yuv[0][i] = (uint8_t)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+		yuv[1][i] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+		yuv[2][i] = (uint8_t)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+	}
+	fputs("FRAME\n", screen->video);
+	for (int plane = 0; plane < 3; plane++)
+		for (int y = 0; y < VIC_HEIGHT; y++)
+		{
+			for (int x = 0; x < VIC_WIDTH; x++)
+				row[x] = yuv[plane][screen->pixels[y][x]];
+			fwrite(row, 1, VIC_WIDTH, screen->video);
+		}
+	if (ferror(screen->video))
+		screen->error = 1;
+}
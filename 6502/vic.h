@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include "6502.h"
+
+/*
+	VIC-II screen
+
+	While a machine has a screen, every raster line in the visible part of
+	the frame is rendered into pixels when it ends: one byte per pixel,
+	the colour 0 - 15. The frame is the display window of 320 x 200 with
+	32 pixels of border left and right, 35 above and 37 below. Sprites
+	are drawn over the graphics (or behind their foreground, $D01B) and
+	under the border, sprite 0 in front.
+
+	Frames can be saved as PPM (one frame) or recorded as Y4M (every frame
+	from then on, 4:4:4 at the PAL frame rate) for checking them offline.
+
+	The character and bitmap modes expand a row of glyph or bitmap bytes
+	into pixels with SSE2 where the host has it, /DVIC_SIMD=0 uses plain C.
+
+	Dirty tracking: a line is only rendered again when something it is
+	made of changed, otherwise the pixels of the last frame stay. Every
+	line keeps the registers it was rendered with. The pages of screen
+	RAM, colour RAM and the chars (or the bitmap) are watched (see
+	C64_WatchPage), a write into them marks the text row it lands in
+	dirty, a write into the chars all rows. A dirty row is rendered until
+	the end of the next frame. Writes straight into state->memory are not
+	seen, call C64_RedrawScreen after them (C64_OwnMemoryRange does).
+	Sprites are not tracked: a line with a sprite on it is always rendered,
+	and so is the line after it has gone.
+*/
+#define VIC_WIDTH			384
+#define VIC_HEIGHT			272
+#define VIC_FIRST_LINE		16		// raster line of the first row of pixels
+#define VIC_BORDER_LEFT		32		// pixels left of the display window
+#define VIC_LINE_KEY		13		// bytes of registers per line
+#define VIC_ALL_ROWS		0x1FFFFFF
+
+struct Screen6569 {
+	uint8_t  pixels[VIC_HEIGHT][VIC_WIDTH];
+	uint64_t frames;    // completed since C64_StartScreen
+	FILE     *video;    // Y4M being recorded, NULL = none
+	int      error;     // writing the video failed
+	uint64_t rendered;  // lines rendered
+	uint64_t skipped;   // lines left as they were
+	uint8_t  full;      // 1 = render every line, no dirty tracking
+	uint32_t dirty;     // text rows written since the frame started, a bit per row
+	uint32_t redraw;    // rows written during the last frame
+	uint32_t watched;   // VIC bank, $D018 and BMM the watched pages are for
+	uint16_t matrix, chars, bitmap; // what is watched
+	uint8_t  keys[VIC_HEIGHT][VIC_LINE_KEY]; // registers each line was rendered with
+};
+
+extern const uint8_t VICPalette[16][3]; // RGB
+
+int C64_StartScreen(State6510* state);
+int C64_StopScreen(State6510* state);
+int C64_SavePPM(const Screen6569* screen, const char* filename);
+int C64_RecordY4M(State6510* state, const char* filename);
+void C64_RedrawScreen(State6510* state);
+void C64_ScreenWrite(State6510* state, uint16_t address);